@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/compressed_file_reader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using namespace OCLRT;
+
+// Decompresses AUB file captured with AubDumpCompressionBlockSize set,
+// "-" selects stdin/stdout so the output can be piped directly to AUB consumers
+int main(int argc, const char *argv[]) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s <compressed_file|-> [output_file|-]\n", argv[0]);
+        return 1;
+    }
+
+    const char *inputName = argv[1];
+    const char *outputName = argc == 3 ? argv[2] : "-";
+
+#if defined(_WIN32)
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+    std::ifstream inputFile;
+    if (strcmp(inputName, "-") != 0) {
+        inputFile.open(inputName, std::ifstream::binary);
+        if (!inputFile.is_open()) {
+            fprintf(stderr, "Cannot open input file %s\n", inputName);
+            return 1;
+        }
+    }
+    std::ofstream outputFile;
+    if (strcmp(outputName, "-") != 0) {
+        outputFile.open(outputName, std::ofstream::binary);
+        if (!outputFile.is_open()) {
+            fprintf(stderr, "Cannot open output file %s\n", outputName);
+            return 1;
+        }
+    }
+
+    std::istream &input = inputFile.is_open() ? inputFile : std::cin;
+    std::ostream &output = outputFile.is_open() ? outputFile : std::cout;
+
+    CompressedFileReader reader(input);
+    if (!reader.isValid()) {
+        fprintf(stderr, "%s is not a compressed file or uses unknown codec\n", inputName);
+        return 1;
+    }
+    if (!reader.decompress(output)) {
+        fprintf(stderr, "%s is corrupted\n", inputName);
+        return 1;
+    }
+    output.flush();
+    return 0;
+}
@@ -9,82 +9,96 @@
 #include <string.h>
 
 namespace CLElfLib {
-CElfReader::CElfReader(ElfBinaryStorage &elfBinary) {
-    validateElfBinary(elfBinary);
+CElfReaderView::CElfReaderView(const char *elfBinary, size_t elfBinarySize) : beginBinary(elfBinary), binarySize(elfBinarySize) {
+    validateElfBinary();
 }
 
-void CElfReader::validateElfBinary(ElfBinaryStorage &elfBinary) {
-    const char *nameTable = nullptr;
-    const char *end = nullptr;
-    size_t ourSize = 0u;
-    size_t entrySize = 0u;
-    size_t indexedSectionHeaderOffset = 0u;
-    beginBinary = elfBinary.data();
-
-    if (elfBinary.size() >= sizeof(SElf64Header)) {
-        // calculate a pointer to the end
-        end = beginBinary + elfBinary.size();
-        elf64Header = reinterpret_cast<const SElf64Header *>(elfBinary.data());
-
-        if (!((elf64Header->Identity[ELFConstants::idIdxMagic0] == ELFConstants::elfMag0) &&
-              (elf64Header->Identity[ELFConstants::idIdxMagic1] == ELFConstants::elfMag1) &&
-              (elf64Header->Identity[ELFConstants::idIdxMagic2] == ELFConstants::elfMag2) &&
-              (elf64Header->Identity[ELFConstants::idIdxMagic3] == ELFConstants::elfMag3) &&
-              (elf64Header->Identity[ELFConstants::idIdxClass] == static_cast<uint32_t>(E_EH_CLASS::EH_CLASS_64)))) {
-            throw ElfException();
-        }
-        ourSize += elf64Header->ElfHeaderSize;
-    } else {
+void CElfReaderView::validateElfBinary() {
+    if (beginBinary == nullptr || binarySize < sizeof(SElf64Header)) {
         throw ElfException();
     }
+    elf64Header = reinterpret_cast<const SElf64Header *>(beginBinary);
 
-    entrySize = elf64Header->SectionHeaderEntrySize;
-
-    if (elf64Header->SectionNameTableIndex < elf64Header->NumSectionHeaderEntries) {
-        indexedSectionHeaderOffset = static_cast<size_t>(elf64Header->SectionHeadersOffset) + (elf64Header->SectionNameTableIndex * entrySize);
+    if (!((elf64Header->Identity[ELFConstants::idIdxMagic0] == ELFConstants::elfMag0) &&
+          (elf64Header->Identity[ELFConstants::idIdxMagic1] == ELFConstants::elfMag1) &&
+          (elf64Header->Identity[ELFConstants::idIdxMagic2] == ELFConstants::elfMag2) &&
+          (elf64Header->Identity[ELFConstants::idIdxMagic3] == ELFConstants::elfMag3) &&
+          (elf64Header->Identity[ELFConstants::idIdxClass] == static_cast<uint32_t>(E_EH_CLASS::EH_CLASS_64)))) {
+        throw ElfException();
+    }
 
-        if ((beginBinary + indexedSectionHeaderOffset) <= end) {
-            nameTable = beginBinary + indexedSectionHeaderOffset;
-        }
+    size_t entrySize = elf64Header->SectionHeaderEntrySize;
+    if (elf64Header->NumSectionHeaderEntries > 0 && entrySize < sizeof(SElf64SectionHeader)) {
+        throw ElfException();
     }
 
-    for (uint16_t i = 0u; i < elf64Header->NumSectionHeaderEntries; ++i) {
-        indexedSectionHeaderOffset = static_cast<size_t>(elf64Header->SectionHeadersOffset) + (i * entrySize);
+    // sizes are compared against remaining space, so offsets read from binary cannot overflow
+    size_t ourSize = elf64Header->ElfHeaderSize;
+    for (size_t i = 0u; i < elf64Header->NumSectionHeaderEntries; ++i) {
+        if ((elf64Header->SectionHeadersOffset > binarySize) ||
+            ((i * entrySize + sizeof(SElf64SectionHeader)) > (binarySize - elf64Header->SectionHeadersOffset))) {
+            throw ElfException();
+        }
 
-        // check section header offset
-        if ((beginBinary + indexedSectionHeaderOffset) > end) {
+        auto sectionHeader = getSectionHeader(i);
+        if ((sectionHeader.DataOffset > binarySize) ||
+            (sectionHeader.DataSize > binarySize - sectionHeader.DataOffset)) {
             throw ElfException();
         }
 
-        const SElf64SectionHeader *sectionHeader = nullptr;
+        // tally up the sizes
+        ourSize += static_cast<size_t>(sectionHeader.DataSize);
+        ourSize += entrySize;
+    }
 
-        sectionHeader = reinterpret_cast<const SElf64SectionHeader *>(beginBinary + indexedSectionHeaderOffset);
+    if (ourSize != binarySize) {
+        throw ElfException();
+    }
+}
 
-        // check section data
-        if ((beginBinary + sectionHeader->DataOffset + sectionHeader->DataSize) > end) {
-            throw ElfException();
-        }
+SElf64SectionHeader CElfReaderView::getSectionHeader(size_t index) const {
+    // headers are copied out, binary does not have to be aligned
+    SElf64SectionHeader sectionHeader;
+    memcpy(&sectionHeader, beginBinary + elf64Header->SectionHeadersOffset + index * elf64Header->SectionHeaderEntrySize, sizeof(SElf64SectionHeader));
+    return sectionHeader;
+}
 
-        // check section name index
-        if ((nameTable + sectionHeader->Name) > end) {
-            throw ElfException();
-        }
+SSectionView CElfReaderView::getSection(size_t index) const {
+    auto sectionHeader = getSectionHeader(index);
 
-        SElf64SectionHeader stringSectionHeader = {0};
-        stringSectionHeader.Type = sectionHeader->Type;
-        stringSectionHeader.Flags = sectionHeader->Flags;
-        stringSectionHeader.DataOffset = sectionHeader->DataOffset;
-        stringSectionHeader.DataSize = sectionHeader->DataSize;
-        stringSectionHeader.Name = sectionHeader->Name;
-        sectionHeaders.push_back(std::move(stringSectionHeader));
+    SSectionView section;
+    section.type = sectionHeader.Type;
+    section.flag = sectionHeader.Flags;
+    section.name = getSectionName(sectionHeader);
+    section.data = beginBinary + sectionHeader.DataOffset;
+    section.dataSize = static_cast<size_t>(sectionHeader.DataSize);
+    return section;
+}
 
-        // tally up the sizes
-        ourSize += static_cast<size_t>(sectionHeader->DataSize);
-        ourSize += static_cast<size_t>(entrySize);
+const char *CElfReaderView::getSectionName(const SElf64SectionHeader &sectionHeader) const {
+    if (elf64Header->SectionNameTableIndex >= elf64Header->NumSectionHeaderEntries) {
+        return "";
+    }
+    auto nameTableHeader = getSectionHeader(elf64Header->SectionNameTableIndex);
+    // names are only returned from a null terminated string table
+    if ((sectionHeader.Name >= nameTableHeader.DataSize) ||
+        (beginBinary[nameTableHeader.DataOffset + nameTableHeader.DataSize - 1] != '\0')) {
+        return "";
     }
+    return beginBinary + nameTableHeader.DataOffset + sectionHeader.Name;
+}
 
-    if (ourSize != elfBinary.size()) {
-        throw ElfException();
+CElfReader::CElfReader(ElfBinaryStorage &elfBinary) {
+    validateElfBinary(elfBinary);
+}
+
+void CElfReader::validateElfBinary(ElfBinaryStorage &elfBinary) {
+    CElfReaderView elfView(elfBinary.data(), elfBinary.size());
+
+    beginBinary = elfBinary.data();
+    elf64Header = elfView.getElfHeader();
+    for (size_t i = 0u; i < elfView.getNumSections(); ++i) {
+        sectionHeaders.push_back(elfView.getSectionHeader(i));
     }
 }
 
@@ -92,6 +106,19 @@ char *CElfReader::getSectionData(Elf64_Off dataOffset) {
     return beginBinary + dataOffset;
 }
 
+const char *CElfReader::getSectionName(const SElf64SectionHeader &sectionHeader) {
+    if (elf64Header->SectionNameTableIndex >= sectionHeaders.size()) {
+        return "";
+    }
+    const auto &nameTableHeader = sectionHeaders[elf64Header->SectionNameTableIndex];
+    // names are only returned from a null terminated string table
+    if ((sectionHeader.Name >= nameTableHeader.DataSize) ||
+        (beginBinary[nameTableHeader.DataOffset + nameTableHeader.DataSize - 1] != '\0')) {
+        return "";
+    }
+    return beginBinary + nameTableHeader.DataOffset + sectionHeader.Name;
+}
+
 const SElf64Header *CElfReader::getElfHeader() {
     return elf64Header;
 }
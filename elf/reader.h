@@ -10,6 +10,51 @@
 
 namespace CLElfLib {
 using ElfSectionHeaderStorage = std::vector<SElf64SectionHeader>;
+
+// Section of binary validated by CElfReaderView, name and data point into that binary.
+struct SSectionView {
+    E_SH_TYPE type = E_SH_TYPE::SH_TYPE_NULL;
+    E_SH_FLAG flag = E_SH_FLAG::SH_FLAG_NONE;
+    const char *name = "";
+    const char *data = nullptr;
+    size_t dataSize = 0u;
+};
+
+/******************************************************************************\
+
+ Class:         CElfReaderView
+
+ Description:   Validates ELF binary in place, without copying it. Binary
+                (e.g. user memory or mapped file) has to outlive the view and
+                returned sections. ElfException is thrown for invalid binary.
+
+\******************************************************************************/
+class CElfReaderView {
+  public:
+    CElfReaderView(const char *elfBinary, size_t elfBinarySize);
+
+    const SElf64Header *getElfHeader() const {
+        return elf64Header;
+    }
+    size_t getNumSections() const {
+        return elf64Header->NumSectionHeaderEntries;
+    }
+    const char *getBinary() const {
+        return beginBinary;
+    }
+
+    SElf64SectionHeader getSectionHeader(size_t index) const;
+    SSectionView getSection(size_t index) const;
+    const char *getSectionName(const SElf64SectionHeader &sectionHeader) const;
+
+  protected:
+    void validateElfBinary();
+
+    const char *beginBinary;
+    size_t binarySize;
+    const SElf64Header *elf64Header = nullptr;
+};
+
 /******************************************************************************\
 
  Class:         CElfReader
@@ -28,6 +73,7 @@ class CElfReader {
 
     const SElf64Header *getElfHeader();
     char *getSectionData(Elf64_Off dataOffset);
+    const char *getSectionName(const SElf64SectionHeader &sectionHeader);
 
   protected:
     void validateElfBinary(ElfBinaryStorage &elfBinary);
@@ -17,6 +17,9 @@ struct ElfException : std::exception {
 };
 
 using ElfBinaryStorage = std::vector<char>;
+
+// device binary sections of multi-target binaries are named with this prefix followed by the target device name
+constexpr const char *devBinarySectionNamePrefix = "Intel(R) OpenCL Device Binary ";
 /******************************************************************************\
  ELF Enumerates
 \******************************************************************************/
@@ -27,7 +27,10 @@
 #include <iomanip>
 #include <list>
 #include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <sstream>
+#include <thread>
 
 #ifdef _WIN32
 #include <direct.h>
@@ -192,16 +195,185 @@ int OfflineCompiler::buildSourceCode() {
 int OfflineCompiler::build() {
     int retVal = CL_SUCCESS;
 
+    if (isMultiTarget()) {
+        retVal = buildTargets();
+
+        if (retVal == CL_SUCCESS) {
+            if (!generateMultiTargetElfBinary()) {
+                return CL_BUILD_PROGRAM_FAILURE;
+            }
+            writeOutTargetFiles();
+        }
+        return retVal;
+    }
+
     retVal = buildSourceCode();
 
     if (retVal == CL_SUCCESS) {
-        generateElfBinary();
+        if (!generateElfBinary()) {
+            return CL_BUILD_PROGRAM_FAILURE;
+        }
         writeOutAllFiles();
     }
 
     return retVal;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// buildIntermediateRepresentation
+////////////////////////////////////////////////////////////////////////////////
+int OfflineCompiler::buildIntermediateRepresentation(IntermediateRepresentation &ir) {
+    if (inputFileLlvm || inputFileSpirV) {
+        // use the binary input "as is"
+        ir.binary = sourceCode;
+        ir.codeType = inputFileSpirV ? IGC::CodeType::spirV : IGC::CodeType::llvmBc;
+        ir.fromSource = false;
+        return CL_SUCCESS;
+    }
+    UNRECOVERABLE_IF(fclDeviceCtx == nullptr);
+
+    ir.codeType = useLlvmText ? IGC::CodeType::llvmLl : preferredIntermediateRepresentation;
+    ir.fromSource = true;
+
+    // sourceCode.size() returns the number of characters without null terminated char
+    auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), sourceCode.c_str(), sourceCode.size() + 1);
+    auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), options.c_str(), options.size());
+    auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), ir.internalOptions.c_str(), ir.internalOptions.size());
+
+    fclDeviceCtx->SetOclApiVersion(ir.clVersion * 10);
+    auto fclTranslationCtx = fclDeviceCtx->CreateTranslationCtx(IGC::CodeType::oclC, ir.codeType);
+
+    if (false == OCLRT::areNotNullptr(fclSrc.get(), fclOptions.get(), fclInternalOptions.get(), fclTranslationCtx.get())) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    auto fclOutput = fclTranslationCtx->Translate(fclSrc.get(), fclOptions.get(),
+                                                  fclInternalOptions.get(), nullptr, 0);
+    if (fclOutput == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    UNRECOVERABLE_IF(fclOutput->GetBuildLog() == nullptr);
+    UNRECOVERABLE_IF(fclOutput->GetOutput() == nullptr);
+    updateBuildLog(fclOutput->GetBuildLog()->GetMemory<char>(), fclOutput->GetBuildLog()->GetSizeRaw());
+
+    if (fclOutput->Successful() == false) {
+        return CL_BUILD_PROGRAM_FAILURE;
+    }
+
+    ir.binary.assign(fclOutput->GetOutput()->GetMemory<char>(), fclOutput->GetOutput()->GetSizeRaw());
+    return CL_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// buildTargetBinary
+////////////////////////////////////////////////////////////////////////////////
+void OfflineCompiler::buildTargetBinary(DeviceTarget &target, const IntermediateRepresentation &ir, std::mutex &igcMutex) {
+    // compiler interfaces are created and released under the lock, only translations of targets run concurrently
+    std::unique_lock<std::mutex> lock(igcMutex);
+
+    CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> targetDeviceCtx;
+    target.retVal = initializeIgcDeviceCtx(*target.hwInfo, targetDeviceCtx);
+    if (target.retVal != CL_SUCCESS) {
+        return;
+    }
+
+    auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), ir.binary.c_str(), ir.binary.size());
+    auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), ir.fromSource ? options.c_str() : nullptr, ir.fromSource ? options.size() : 0);
+    auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), target.internalOptions.c_str(), target.internalOptions.size());
+    auto igcTranslationCtx = targetDeviceCtx->CreateTranslationCtx(ir.codeType, IGC::CodeType::oclGenBin);
+
+    if (false == OCLRT::areNotNullptr(igcSrc.get(), igcOptions.get(), igcInternalOptions.get(), igcTranslationCtx.get())) {
+        target.retVal = CL_OUT_OF_HOST_MEMORY;
+        return;
+    }
+
+    lock.unlock();
+    auto igcOutput = igcTranslationCtx->Translate(igcSrc.get(), igcOptions.get(), igcInternalOptions.get(), nullptr, 0);
+    lock.lock();
+
+    if (igcOutput == nullptr) {
+        target.retVal = CL_OUT_OF_HOST_MEMORY;
+        return;
+    }
+    UNRECOVERABLE_IF(igcOutput->GetBuildLog() == nullptr);
+    UNRECOVERABLE_IF(igcOutput->GetOutput() == nullptr);
+    target.genBinary.assign(igcOutput->GetOutput()->GetMemory<char>(), igcOutput->GetOutput()->GetSizeRaw());
+    target.buildLog.assign(igcOutput->GetBuildLog()->GetMemory<char>(), igcOutput->GetBuildLog()->GetSizeRaw());
+
+    if (igcOutput->GetDebugData()->GetSizeRaw() != 0) {
+        target.debugData.assign(igcOutput->GetDebugData()->GetMemory<char>(), igcOutput->GetDebugData()->GetSizeRaw());
+    }
+    target.retVal = igcOutput->Successful() ? CL_SUCCESS : CL_BUILD_PROGRAM_FAILURE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// buildTargets
+////////////////////////////////////////////////////////////////////////////////
+int OfflineCompiler::buildTargets() {
+    if (sourceCode.empty()) {
+        return CL_INVALID_PROGRAM;
+    }
+
+    // frontend translation is done once for all targets sharing OpenCL version and enabled extensions
+    intermediateRepresentations.clear();
+    for (auto &target : targets) {
+        std::string extensionsList = getExtensionsList(*target.hwInfo);
+        target.internalOptions = internalOptions + convertEnabledExtensionsToCompilerInternalOptions(extensionsList.c_str());
+        auto clVersion = target.hwInfo->capabilityTable.clVersionSupport;
+
+        auto sharedIr = std::find_if(intermediateRepresentations.begin(), intermediateRepresentations.end(), [&](const IntermediateRepresentation &ir) {
+            return ir.clVersion == clVersion && ir.internalOptions == target.internalOptions;
+        });
+        target.irIndex = static_cast<size_t>(sharedIr - intermediateRepresentations.begin());
+        if (sharedIr == intermediateRepresentations.end()) {
+            IntermediateRepresentation ir;
+            ir.clVersion = clVersion;
+            ir.internalOptions = target.internalOptions;
+            intermediateRepresentations.push_back(std::move(ir));
+        }
+    }
+
+    for (auto &ir : intermediateRepresentations) {
+        auto retVal = buildIntermediateRepresentation(ir);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+
+    // backends run concurrently, calling thread builds targets as well
+    uint32_t threadsCount = backendThreadsCount ? backendThreadsCount : std::max(1u, std::thread::hardware_concurrency());
+    threadsCount = std::min(threadsCount, static_cast<uint32_t>(targets.size()));
+    std::mutex igcMutex;
+    std::atomic<size_t> nextTarget{0};
+    auto buildPendingTargets = [&]() {
+        for (auto i = nextTarget++; i < targets.size(); i = nextTarget++) {
+            buildTargetBinary(targets[i], intermediateRepresentations[targets[i].irIndex], igcMutex);
+        }
+    };
+
+    std::vector<std::thread> backendThreads;
+    for (uint32_t i = 1; i < threadsCount; i++) {
+        backendThreads.emplace_back(buildPendingTargets);
+    }
+    buildPendingTargets();
+    for (auto &backendThread : backendThreads) {
+        backendThread.join();
+    }
+
+    int retVal = CL_SUCCESS;
+    for (const auto &target : targets) {
+        if (target.buildLog.empty() == false && target.buildLog[0] != '\0') {
+            std::string targetBuildLog = target.deviceName + ": " + target.buildLog;
+            updateBuildLog(targetBuildLog.c_str(), targetBuildLog.size());
+        }
+        if (retVal == CL_SUCCESS) {
+            retVal = target.retVal;
+        }
+    }
+    return retVal;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // updateBuildLog
 ////////////////////////////////////////////////////////////////////////////////
@@ -245,6 +417,50 @@ int OfflineCompiler::getHardwareInfo(const char *pDeviceName) {
     return retVal;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// parseDeviceNames
+////////////////////////////////////////////////////////////////////////////////
+int OfflineCompiler::parseDeviceNames(const std::string &devices) {
+    std::vector<std::string> names;
+
+    if (devices == "all") {
+        for (unsigned int productId = 0; productId < IGFX_MAX_PRODUCT; ++productId) {
+            if (hardwarePrefix[productId] && hardwareInfoTable[productId]) {
+                names.push_back(hardwarePrefix[productId]);
+            }
+        }
+    } else {
+        std::istringstream devicesStream(devices);
+        std::string name;
+        while (std::getline(devicesStream, name, ',')) {
+            if (!name.empty() && std::find(names.begin(), names.end(), name) == names.end()) {
+                names.push_back(name);
+            }
+        }
+    }
+
+    targets.clear();
+    for (const auto &name : names) {
+        if (getHardwareInfo(name.c_str()) != CL_SUCCESS) {
+            printf("Error: Cannot get HW Info for device %s.\n", name.c_str());
+            return CL_INVALID_DEVICE;
+        }
+        DeviceTarget target;
+        target.deviceName = name;
+        target.hwInfo = hwInfo;
+        target.familyNameWithType = familyNameWithType;
+        targets.push_back(std::move(target));
+    }
+
+    if (targets.empty()) {
+        printf("Error: Cannot get HW Info for device %s.\n", devices.c_str());
+        return CL_INVALID_DEVICE;
+    }
+
+    // first target sets up the frontend
+    return getHardwareInfo(targets[0].deviceName.c_str());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // getStringWithinDelimiters
 ////////////////////////////////////////////////////////////////////////////////
@@ -374,52 +590,59 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
         return CL_OUT_OF_HOST_MEMORY;
     }
 
-    this->igcDeviceCtx = this->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
-    if (this->igcDeviceCtx == nullptr) {
+    return initializeIgcDeviceCtx(*hwInfo, this->igcDeviceCtx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// initializeIgcDeviceCtx
+////////////////////////////////////////////////////////////////////////////////
+int OfflineCompiler::initializeIgcDeviceCtx(const HardwareInfo &targetHwInfo, CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> &deviceCtx) {
+    deviceCtx = this->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
+    if (deviceCtx == nullptr) {
         return CL_OUT_OF_HOST_MEMORY;
     }
-    this->igcDeviceCtx->SetProfilingTimerResolution(static_cast<float>(hwInfo->capabilityTable.defaultProfilingTimerResolution));
-    auto igcPlatform = this->igcDeviceCtx->GetPlatformHandle();
-    auto igcGtSystemInfo = this->igcDeviceCtx->GetGTSystemInfoHandle();
-    auto igcFeWa = this->igcDeviceCtx->GetIgcFeaturesAndWorkaroundsHandle();
+    deviceCtx->SetProfilingTimerResolution(static_cast<float>(targetHwInfo.capabilityTable.defaultProfilingTimerResolution));
+    auto igcPlatform = deviceCtx->GetPlatformHandle();
+    auto igcGtSystemInfo = deviceCtx->GetGTSystemInfoHandle();
+    auto igcFeWa = deviceCtx->GetIgcFeaturesAndWorkaroundsHandle();
     if ((igcPlatform == nullptr) || (igcGtSystemInfo == nullptr) || (igcFeWa == nullptr)) {
         return CL_OUT_OF_HOST_MEMORY;
     }
-    IGC::PlatformHelper::PopulateInterfaceWith(*igcPlatform.get(), *hwInfo->pPlatform);
-    IGC::GtSysInfoHelper::PopulateInterfaceWith(*igcGtSystemInfo.get(), *hwInfo->pSysInfo);
+    IGC::PlatformHelper::PopulateInterfaceWith(*igcPlatform.get(), *targetHwInfo.pPlatform);
+    IGC::GtSysInfoHelper::PopulateInterfaceWith(*igcGtSystemInfo.get(), *targetHwInfo.pSysInfo);
     // populate with features
-    igcFeWa.get()->SetFtrDesktop(hwInfo->pSkuTable->ftrDesktop);
-    igcFeWa.get()->SetFtrChannelSwizzlingXOREnabled(hwInfo->pSkuTable->ftrChannelSwizzlingXOREnabled);
-
-    igcFeWa.get()->SetFtrGtBigDie(hwInfo->pSkuTable->ftrGtBigDie);
-    igcFeWa.get()->SetFtrGtMediumDie(hwInfo->pSkuTable->ftrGtMediumDie);
-    igcFeWa.get()->SetFtrGtSmallDie(hwInfo->pSkuTable->ftrGtSmallDie);
-
-    igcFeWa.get()->SetFtrGT1(hwInfo->pSkuTable->ftrGT1);
-    igcFeWa.get()->SetFtrGT1_5(hwInfo->pSkuTable->ftrGT1_5);
-    igcFeWa.get()->SetFtrGT2(hwInfo->pSkuTable->ftrGT2);
-    igcFeWa.get()->SetFtrGT3(hwInfo->pSkuTable->ftrGT3);
-    igcFeWa.get()->SetFtrGT4(hwInfo->pSkuTable->ftrGT4);
-
-    igcFeWa.get()->SetFtrIVBM0M1Platform(hwInfo->pSkuTable->ftrIVBM0M1Platform);
-    igcFeWa.get()->SetFtrGTL(hwInfo->pSkuTable->ftrGT1);
-    igcFeWa.get()->SetFtrGTM(hwInfo->pSkuTable->ftrGT2);
-    igcFeWa.get()->SetFtrGTH(hwInfo->pSkuTable->ftrGT3);
-
-    igcFeWa.get()->SetFtrSGTPVSKUStrapPresent(hwInfo->pSkuTable->ftrSGTPVSKUStrapPresent);
-    igcFeWa.get()->SetFtrGTA(hwInfo->pSkuTable->ftrGTA);
-    igcFeWa.get()->SetFtrGTC(hwInfo->pSkuTable->ftrGTC);
-    igcFeWa.get()->SetFtrGTX(hwInfo->pSkuTable->ftrGTX);
-    igcFeWa.get()->SetFtr5Slice(hwInfo->pSkuTable->ftr5Slice);
-
-    igcFeWa.get()->SetFtrGpGpuMidThreadLevelPreempt(hwInfo->pSkuTable->ftrGpGpuMidThreadLevelPreempt);
-    igcFeWa.get()->SetFtrIoMmuPageFaulting(hwInfo->pSkuTable->ftrIoMmuPageFaulting);
-    igcFeWa.get()->SetFtrWddm2Svm(hwInfo->pSkuTable->ftrWddm2Svm);
-    igcFeWa.get()->SetFtrPooledEuEnabled(hwInfo->pSkuTable->ftrPooledEuEnabled);
-
-    igcFeWa.get()->SetFtrResourceStreamer(hwInfo->pSkuTable->ftrResourceStreamer);
-
-    return retVal;
+    igcFeWa.get()->SetFtrDesktop(targetHwInfo.pSkuTable->ftrDesktop);
+    igcFeWa.get()->SetFtrChannelSwizzlingXOREnabled(targetHwInfo.pSkuTable->ftrChannelSwizzlingXOREnabled);
+
+    igcFeWa.get()->SetFtrGtBigDie(targetHwInfo.pSkuTable->ftrGtBigDie);
+    igcFeWa.get()->SetFtrGtMediumDie(targetHwInfo.pSkuTable->ftrGtMediumDie);
+    igcFeWa.get()->SetFtrGtSmallDie(targetHwInfo.pSkuTable->ftrGtSmallDie);
+
+    igcFeWa.get()->SetFtrGT1(targetHwInfo.pSkuTable->ftrGT1);
+    igcFeWa.get()->SetFtrGT1_5(targetHwInfo.pSkuTable->ftrGT1_5);
+    igcFeWa.get()->SetFtrGT2(targetHwInfo.pSkuTable->ftrGT2);
+    igcFeWa.get()->SetFtrGT3(targetHwInfo.pSkuTable->ftrGT3);
+    igcFeWa.get()->SetFtrGT4(targetHwInfo.pSkuTable->ftrGT4);
+
+    igcFeWa.get()->SetFtrIVBM0M1Platform(targetHwInfo.pSkuTable->ftrIVBM0M1Platform);
+    igcFeWa.get()->SetFtrGTL(targetHwInfo.pSkuTable->ftrGT1);
+    igcFeWa.get()->SetFtrGTM(targetHwInfo.pSkuTable->ftrGT2);
+    igcFeWa.get()->SetFtrGTH(targetHwInfo.pSkuTable->ftrGT3);
+
+    igcFeWa.get()->SetFtrSGTPVSKUStrapPresent(targetHwInfo.pSkuTable->ftrSGTPVSKUStrapPresent);
+    igcFeWa.get()->SetFtrGTA(targetHwInfo.pSkuTable->ftrGTA);
+    igcFeWa.get()->SetFtrGTC(targetHwInfo.pSkuTable->ftrGTC);
+    igcFeWa.get()->SetFtrGTX(targetHwInfo.pSkuTable->ftrGTX);
+    igcFeWa.get()->SetFtr5Slice(targetHwInfo.pSkuTable->ftr5Slice);
+
+    igcFeWa.get()->SetFtrGpGpuMidThreadLevelPreempt(targetHwInfo.pSkuTable->ftrGpGpuMidThreadLevelPreempt);
+    igcFeWa.get()->SetFtrIoMmuPageFaulting(targetHwInfo.pSkuTable->ftrIoMmuPageFaulting);
+    igcFeWa.get()->SetFtrWddm2Svm(targetHwInfo.pSkuTable->ftrWddm2Svm);
+    igcFeWa.get()->SetFtrPooledEuEnabled(targetHwInfo.pSkuTable->ftrPooledEuEnabled);
+
+    igcFeWa.get()->SetFtrResourceStreamer(targetHwInfo.pSkuTable->ftrResourceStreamer);
+
+    return CL_SUCCESS;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -478,6 +701,10 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const char *const *argv) {
                    (argIndex + 1 < numArgs)) {
             outputDirectory = argv[argIndex + 1];
             argIndex++;
+        } else if ((stringsAreEqual(argv[argIndex], "-threads")) &&
+                   (argIndex + 1 < numArgs)) {
+            backendThreadsCount = static_cast<uint32_t>(std::max(0, atoi(argv[argIndex + 1])));
+            argIndex++;
         } else if (stringsAreEqual(argv[argIndex], "-q")) {
             quiet = true;
         } else if (stringsAreEqual(argv[argIndex], "-?")) {
@@ -504,10 +731,9 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const char *const *argv) {
             printf("Error: Input file %s missing.\n", inputFile.c_str());
             retVal = INVALID_FILE;
         } else {
-            retVal = getHardwareInfo(deviceName.c_str());
-            if (retVal != CL_SUCCESS) {
-                printf("Error: Cannot get HW Info for device %s.\n", deviceName.c_str());
-            } else {
+            retVal = parseDeviceNames(deviceName);
+            if (retVal == CL_SUCCESS && !isMultiTarget()) {
+                // targets of multi-target build get extensions of their own device
                 std::string extensionsList = getExtensionsList(*hwInfo);
                 internalOptions.append(convertEnabledExtensionsToCompilerInternalOptions(extensionsList.c_str()));
             }
@@ -624,6 +850,8 @@ void OfflineCompiler::printUsage() {
     printf("  -file <filename>             Indicates the CL kernel file to be compiled.\n");
     printf("  -device <device_type>        Indicates which device for which we will compile.\n");
     printf("                               <device_type> can be: %s\n", getDevicesTypes().c_str());
+    printf("                               Comma separated list of devices or \"all\" builds\n");
+    printf("                               a single binary with a device section for each target.\n");
     printf("\n");
     printf("  -output <filename>           Indicates output files core name.\n");
     printf("  -out_dir <output_dir>        Indicates the directory into which the compiled files\n");
@@ -639,6 +867,8 @@ void OfflineCompiler::printUsage() {
     printf("  -spirv_input                  Indicates input file is a SpirV binary\n");
     printf("  -options <options>           Compiler options.\n");
     printf("  -options_name                Add suffix with compile options to filename\n");
+    printf("  -threads <count>             Maximum number of targets compiled concurrently when\n");
+    printf("                               building for multiple devices.\n");
     printf("  -q                           Be more quiet. print only warnings and errors.\n");
     printf("  -?                           Print this usage message.\n");
 }
@@ -694,17 +924,40 @@ bool OfflineCompiler::generateElfBinary() {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// WriteOutAllFiles
+// GenerateMultiTargetElfBinary
 ////////////////////////////////////////////////////////////////////////////////
-void OfflineCompiler::writeOutAllFiles() {
-    std::string fileBase;
-    std::string fileTrunk = getFileNameTrunk(inputFile);
-    if (outputFile.empty()) {
-        fileBase = fileTrunk + "_" + familyNameWithType;
-    } else {
-        fileBase = outputFile + "_" + familyNameWithType;
+bool OfflineCompiler::generateMultiTargetElfBinary() {
+    for (const auto &target : targets) {
+        if (target.genBinary.empty()) {
+            return false;
+        }
     }
 
+    CLElfLib::CElfWriter elfWriter(CLElfLib::E_EH_TYPE::EH_TYPE_OPENCL_EXECUTABLE, CLElfLib::E_EH_MACHINE::EH_MACHINE_NONE, 0);
+
+    elfWriter.addSection(CLElfLib::SSectionNode(CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_OPTIONS, CLElfLib::E_SH_FLAG::SH_FLAG_NONE, "BuildOptions", options, static_cast<uint32_t>(strlen(options.c_str()) + 1u)));
+
+    // intermediate representation is stored only when it is common for all targets
+    if (intermediateRepresentations.size() == 1) {
+        const auto &ir = intermediateRepresentations[0];
+        elfWriter.addSection(CLElfLib::SSectionNode(ir.codeType == IGC::CodeType::spirV ? CLElfLib::E_SH_TYPE::SH_TYPE_SPIRV : CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_LLVM_BINARY, CLElfLib::E_SH_FLAG::SH_FLAG_NONE, "Intel(R) OpenCL LLVM Object", ir.binary, static_cast<uint32_t>(ir.binary.size())));
+    }
+
+    for (const auto &target : targets) {
+        elfWriter.addSection(CLElfLib::SSectionNode(CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, CLElfLib::E_SH_FLAG::SH_FLAG_NONE, CLElfLib::devBinarySectionNamePrefix + target.deviceName, target.genBinary, static_cast<uint32_t>(target.genBinary.size())));
+    }
+
+    elfBinarySize = elfWriter.getTotalBinarySize();
+    elfBinary.resize(elfBinarySize);
+    elfWriter.resolveBinary(elfBinary);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CreateOutputDirectory
+////////////////////////////////////////////////////////////////////////////////
+void OfflineCompiler::createOutputDirectory() {
     if (outputDirectory != "") {
         std::list<std::string> dirList;
         std::string tmp = outputDirectory;
@@ -721,6 +974,73 @@ void OfflineCompiler::writeOutAllFiles() {
             dirList.pop_back();
         }
     }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// WriteOutTargetFiles
+////////////////////////////////////////////////////////////////////////////////
+void OfflineCompiler::writeOutTargetFiles() {
+    std::string fileTrunk = getFileNameTrunk(inputFile);
+    std::string fileBase = outputFile.empty() ? fileTrunk : outputFile;
+
+    createOutputDirectory();
+
+    for (const auto &ir : intermediateRepresentations) {
+        if (!ir.fromSource) {
+            continue;
+        }
+        // file of intermediate representation not shared by all targets is named after the first target using it
+        std::string irFileBase = fileBase;
+        if (intermediateRepresentations.size() > 1) {
+            auto irIndex = static_cast<size_t>(&ir - intermediateRepresentations.data());
+            auto firstTarget = std::find_if(targets.begin(), targets.end(), [irIndex](const DeviceTarget &target) { return target.irIndex == irIndex; });
+            irFileBase += "_" + firstTarget->deviceName;
+        }
+        isSpirV = ir.codeType == IGC::CodeType::spirV;
+        std::string irOutputFileName = generateFilePathForIr(irFileBase) + generateOptsSuffix();
+        writeDataToFile(irOutputFileName.c_str(), ir.binary.c_str(), ir.binary.size());
+    }
+
+    for (const auto &target : targets) {
+        std::string targetFileBase = fileBase + "_" + target.deviceName;
+
+        if (!target.genBinary.empty()) {
+            std::string genOutputFile = generateFilePath(outputDirectory, targetFileBase, ".gen") + generateOptsSuffix();
+            writeDataToFile(genOutputFile.c_str(), target.genBinary.c_str(), target.genBinary.size());
+
+            if (useCppFile) {
+                familyNameWithType = target.familyNameWithType;
+                std::string cppOutputFile = generateFilePath(outputDirectory, targetFileBase, ".cpp");
+                std::string cpp = parseBinAsCharArray(reinterpret_cast<uint8_t *>(const_cast<char *>(target.genBinary.data())), target.genBinary.size(), fileTrunk);
+                writeDataToFile(cppOutputFile.c_str(), cpp.c_str(), cpp.size());
+            }
+        }
+
+        if (!target.debugData.empty()) {
+            std::string debugOutputFile = generateFilePath(outputDirectory, targetFileBase, ".dbg") + generateOptsSuffix();
+            writeDataToFile(debugOutputFile.c_str(), target.debugData.c_str(), target.debugData.size());
+        }
+    }
+
+    if (!elfBinary.empty()) {
+        std::string elfOutputFile = generateFilePath(outputDirectory, fileBase, ".bin") + generateOptsSuffix();
+        writeDataToFile(elfOutputFile.c_str(), elfBinary.data(), elfBinarySize);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// WriteOutAllFiles
+////////////////////////////////////////////////////////////////////////////////
+void OfflineCompiler::writeOutAllFiles() {
+    std::string fileBase;
+    std::string fileTrunk = getFileNameTrunk(inputFile);
+    if (outputFile.empty()) {
+        fileBase = fileTrunk + "_" + familyNameWithType;
+    } else {
+        fileBase = outputFile + "_" + familyNameWithType;
+    }
+
+    createOutputDirectory();
 
     if (irBinary) {
         std::string irOutputFileName = generateFilePathForIr(fileBase) + generateOptsSuffix();
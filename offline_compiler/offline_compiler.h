@@ -13,6 +13,8 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace OCLRT {
 
@@ -71,9 +73,46 @@ class OfflineCompiler {
         return suffix;
     }
     void writeOutAllFiles();
+
+    // source translated once by the frontend and shared by all targets using the same OpenCL version and internal options
+    struct IntermediateRepresentation {
+        unsigned int clVersion = 0;
+        std::string internalOptions;
+        std::string binary;
+        IGC::CodeType::CodeType_t codeType;
+        bool fromSource = false;
+    };
+
+    struct DeviceTarget {
+        std::string deviceName;
+        const HardwareInfo *hwInfo = nullptr;
+        std::string familyNameWithType;
+        std::string internalOptions;
+        size_t irIndex = 0;
+        std::string genBinary;
+        std::string debugData;
+        std::string buildLog;
+        int retVal = 0;
+    };
+
+    int parseDeviceNames(const std::string &devices);
+    int initializeIgcDeviceCtx(const HardwareInfo &targetHwInfo, CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> &deviceCtx);
+    int buildIntermediateRepresentation(IntermediateRepresentation &ir);
+    void buildTargetBinary(DeviceTarget &target, const IntermediateRepresentation &ir, std::mutex &igcMutex);
+    int buildTargets();
+    bool generateMultiTargetElfBinary();
+    void writeOutTargetFiles();
+    void createOutputDirectory();
+    bool isMultiTarget() const {
+        return targets.size() > 1;
+    }
+
     const HardwareInfo *hwInfo = nullptr;
 
     std::string deviceName;
+    std::vector<DeviceTarget> targets;
+    std::vector<IntermediateRepresentation> intermediateRepresentations;
+    uint32_t backendThreadsCount = 0;
     std::string familyNameWithType;
     std::string inputFile;
     std::string outputFile;
@@ -36,6 +36,15 @@
 /* performance counter */
 #define CL_PROFILING_COMMAND_PERFCOUNTERS_INTEL 0x407F
 
+/**********************************
+ * Internal only queue properties *
+ **********************************/
+// Number of command buffers prepared for reuse at queue creation, nonzero value also requests
+// allocation of all other resources used by first enqueue, at most 8 command buffers are accepted
+#define CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL 0x10002
+// Maximal per-thread scratch size in bytes of kernels enqueued to the queue, 0 means no limit
+#define CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL 0x10003
+
 /**************************
  * Internal only cl types *
  **************************/
@@ -1436,9 +1436,8 @@ cl_kernel CL_API_CALL clCreateKernel(cl_program clProgram,
             break;
         }
 
-        const KernelInfo *pKernelInfo = pProgram->getKernelInfo(kernelName);
+        const KernelInfo *pKernelInfo = pProgram->getKernelInfo(kernelName, &retVal);
         if (!pKernelInfo) {
-            retVal = CL_INVALID_KERNEL_NAME;
             break;
         }
 
@@ -1485,8 +1484,16 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
             }
 
             for (unsigned int ordinal = 0; ordinal < numKernelsInProgram; ++ordinal) {
-                const auto kernelInfo = program->getKernelInfo(ordinal);
-                DEBUG_BREAK_IF(kernelInfo == nullptr);
+                const auto kernelInfo = program->getKernelInfo(ordinal, &retVal);
+                if (kernelInfo == nullptr) {
+                    for (unsigned int createdOrdinal = 0; createdOrdinal < ordinal; ++createdOrdinal) {
+                        if (kernels[createdOrdinal] != nullptr) {
+                            castToObjectOrAbort<Kernel>(kernels[createdOrdinal])->release();
+                            kernels[createdOrdinal] = nullptr;
+                        }
+                    }
+                    return retVal;
+                }
                 DEBUG_BREAK_IF(!kernelInfo->isValid);
                 kernels[ordinal] = Kernel::create(
                     program,
@@ -3864,6 +3871,8 @@ cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context conte
             tokenValue != CL_QUEUE_SIZE &&
             tokenValue != CL_QUEUE_PRIORITY_KHR &&
             tokenValue != CL_QUEUE_THROTTLE_KHR &&
+            tokenValue != CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL &&
+            tokenValue != CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL &&
             !processExtraTokens(pDevice, propertiesAddress)) {
             err.set(CL_INVALID_VALUE);
             return commandQueue;
@@ -3872,6 +3881,11 @@ cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context conte
         tokenValue = *propertiesAddress;
     }
 
+    if (getCmdQueueProperties<cl_uint>(properties, CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL) > CSRequirements::maxWarmUpCommandBuffersCount) {
+        err.set(CL_INVALID_VALUE);
+        return commandQueue;
+    }
+
     auto commandQueueProperties = getCmdQueueProperties<cl_command_queue_properties>(properties);
     uint32_t maxOnDeviceQueueSize = pDevice->getDeviceInfo().queueOnDeviceMaxSize;
     uint32_t maxOnDeviceQueues = pDevice->getDeviceInfo().maxOnDeviceQueues;
@@ -3912,6 +3926,11 @@ cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context conte
             err.set(CL_INVALID_QUEUE_PROPERTIES);
             return commandQueue;
         }
+        if (getCmdQueueProperties<cl_uint>(properties, CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL) ||
+            getCmdQueueProperties<cl_uint>(properties, CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL)) {
+            err.set(CL_INVALID_QUEUE_PROPERTIES);
+            return commandQueue;
+        }
     }
 
     auto maskedFlags = commandQueueProperties & minimumCreateDeviceQueueFlags;
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub/aub_dumped_pages_tracker.h"
+#include "runtime/helpers/hash.h"
+
+namespace OCLRT {
+
+bool AubDumpedPagesTracker::updatePage(uint64_t physAddress, const void *memory, size_t size, uint64_t entryBits) {
+    auto contentHash = Hash::hash(reinterpret_cast<const char *>(memory), size);
+
+    auto it = dumpedPages.find(physAddress);
+    if (it != dumpedPages.end()) {
+        auto &page = it->second;
+        if (page.contentHash == contentHash && page.entryBits == entryBits && page.size == size) {
+            skippedPagesCount++;
+            return false;
+        }
+        page = {contentHash, entryBits, size};
+        return true;
+    }
+
+    dumpedPages.insert({physAddress, {contentHash, entryBits, size}});
+    return true;
+}
+} // namespace OCLRT
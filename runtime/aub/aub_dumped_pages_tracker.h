@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace OCLRT {
+
+// Remembers the contents of every physical page already written into the AUB file
+// so that subsequent dumps of the same allocation can skip pages that did not change.
+class AubDumpedPagesTracker {
+  public:
+    // Returns true when the page has to be written, i.e. it was never dumped before
+    // or its contents/PTE bits differ from the last dump. The new state is recorded.
+    bool updatePage(uint64_t physAddress, const void *memory, size_t size, uint64_t entryBits);
+
+    void reset() {
+        dumpedPages.clear();
+    }
+
+    size_t getTrackedPagesCount() const {
+        return dumpedPages.size();
+    }
+
+    uint64_t peekSkippedPagesCount() const {
+        return skippedPagesCount;
+    }
+
+  protected:
+    struct DumpedPage {
+        uint64_t contentHash;
+        uint64_t entryBits;
+        size_t size;
+    };
+
+    std::unordered_map<uint64_t, DumpedPage> dumpedPages;
+    uint64_t skippedPagesCount = 0;
+};
+} // namespace OCLRT
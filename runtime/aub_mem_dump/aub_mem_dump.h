@@ -9,6 +9,7 @@
 #include <cstdio>
 #include <cstdint>
 #include <fstream>
+#include <memory>
 #include <mutex>
 
 #ifndef BIT
@@ -16,6 +17,7 @@
 #endif
 
 #include "runtime/aub_mem_dump/aub_data.h"
+#include "runtime/utilities/async_file_writer.h"
 
 namespace OCLRT {
 class AubHelper;
@@ -136,6 +138,7 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    std::unique_ptr<OCLRT::AsyncFileWriter> asyncWriter;
 };
 
 template <int addressingBits>
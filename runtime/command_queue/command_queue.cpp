@@ -28,6 +28,7 @@
 #include "runtime/memory_manager/internal_allocation_storage.h"
 #include "runtime/helpers/string.h"
 #include "CL/cl_ext.h"
+#include "public/cl_ext_private.h"
 #include "runtime/utilities/api_intercept.h"
 #include "runtime/utilities/tag_allocator.h"
 #include "runtime/helpers/convert_color.h"
@@ -75,11 +76,17 @@ CommandQueue::CommandQueue(Context *context,
     }
 
     commandQueueProperties = getCmdQueueProperties<cl_command_queue_properties>(properties);
+    scratchSizeLimit = getCmdQueueProperties<cl_uint>(properties, CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL);
     flushStamp.reset(new FlushStampTracker(true));
 
     if (device && device->getCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         timestampPacketContainer = std::make_unique<TimestampPacketContainer>(device->getMemoryManager());
     }
+
+    auto warmUpCommandBuffersCount = getCmdQueueProperties<cl_uint>(properties, CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL);
+    if (device && warmUpCommandBuffersCount > 0) {
+        warmUp(warmUpCommandBuffersCount);
+    }
 }
 
 CommandQueue::~CommandQueue() {
@@ -550,6 +557,16 @@ bool CommandQueue::setupDebugSurface(Kernel *kernel) {
     return true;
 }
 
+bool CommandQueue::isScratchSizeAllowed(uint32_t perThreadScratchSize) const {
+    return scratchSizeLimit == 0 || ScratchSpaceManager::getTierSize(perThreadScratchSize) <= scratchSizeLimit;
+}
+
+void CommandQueue::warmUp(uint32_t commandBuffersCount) {
+    device->getCommandStreamReceiver().warmUp(commandBuffersCount);
+    // whole warmed up command buffer is available to the command stream
+    getCS(CSRequirements::warmUpCommandBufferSize - CSRequirements::minCommandQueueCommandStreamSize - CSRequirements::csOverfetchSize);
+}
+
 IndirectHeap &CommandQueue::getIndirectHeap(IndirectHeap::Type heapType, size_t minRequiredSize) {
     return this->getDevice().getCommandStreamReceiver().getIndirectHeap(heapType, minRequiredSize);
 }
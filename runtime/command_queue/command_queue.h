@@ -329,6 +329,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     Context *getContextPtr() { return context; }
 
     MOCKABLE_VIRTUAL LinearStream &getCS(size_t minRequiredSize);
+    // prepares resources of first enqueue, one of warmed up command buffers becomes command stream of the queue
+    void warmUp(uint32_t commandBuffersCount);
     IndirectHeap &getIndirectHeap(IndirectHeap::Type heapType,
                                   size_t minRequiredSize);
 
@@ -379,6 +381,13 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return throttle;
     }
 
+    uint32_t getScratchSizeLimit() const {
+        return scratchSizeLimit;
+    }
+
+    // scratch of kernel is rounded up to its tier, as this is how much it makes command stream receiver allocate
+    bool isScratchSizeAllowed(uint32_t perThreadScratchSize) const;
+
     void enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList,
                                          size_t numEventsInWaitlist,
                                          MapOperationType opType,
@@ -424,6 +433,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     QueuePriority priority;
     QueueThrottle throttle;
+    uint32_t scratchSizeLimit = 0;
 
     bool perfCountersEnabled;
     cl_uint perfCountersConfig;
@@ -225,8 +225,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                 eventBuilder.getEvent()->addTimestampPacketNodes(*timestampPacketContainer);
             }
             if (this->isProfilingEnabled()) {
-                // Get allocation for timestamps
-                hwTimeStamps = eventBuilder.getEvent()->getHwTimeStamp();
+                if (commandStreamReceiver.peekTimestampPacketProfilingEnabled() && !parentKernel) {
+                    // Timestamps are written to TimestampPacket nodes already assigned to the event
+                    eventBuilder.getEvent()->setTimestampPacketProfilingPath(true);
+                } else {
+                    // Get allocation for timestamps
+                    hwTimeStamps = eventBuilder.getEvent()->getHwTimeStamp();
+                }
                 if (this->isPerfCountersEnabled()) {
                     hwPerfCounter = eventBuilder.getEvent()->getHwPerfCounter();
                     // PERF COUNTER: copy current configuration from queue to event
@@ -548,7 +553,9 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     if (isProfilingEnabled() && eventBuilder.getEvent()) {
         this->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
         eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
-        this->getDevice().getCommandStreamReceiver().makeResident(*eventBuilder.getEvent()->getHwTimeStampAllocation());
+        if (!eventBuilder.getEvent()->isTimestampPacketProfilingPath()) {
+            this->getDevice().getCommandStreamReceiver().makeResident(*eventBuilder.getEvent()->getHwTimeStampAllocation());
+        }
         if (isPerfCountersEnabled()) {
             this->getDevice().getCommandStreamReceiver().makeResident(*eventBuilder.getEvent()->getHwPerfCounterAllocation());
         }
@@ -595,6 +602,17 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         dispatchFlags.outOfDeviceDependencies = &eventsRequest;
     }
     dispatchFlags.numGrfRequired = numGrfRequired;
+
+    SurfacesAccess surfacesAccess;
+    if (commandStreamReceiver.peekDispatchMode() == DispatchMode::BatchedDispatch && !DebugManager.flags.DisableBatchedDependencyAnalysis.get()) {
+        auto surfacesAccessKnown = true;
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            surfacesAccessKnown &= dispatchInfo.getKernel()->getSurfacesAccess(surfacesAccess);
+        }
+        if (surfacesAccessKnown) {
+            dispatchFlags.surfacesAccess = &surfacesAccess;
+        }
+    }
     DEBUG_BREAK_IF(taskLevel >= Event::eventNotReady);
 
     if (gtpinIsGTPinInitialized()) {
@@ -45,6 +45,14 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         return CL_INVALID_KERNEL_ARGS;
     }
 
+    if (!isScratchSizeAllowed(kernel.getScratchSize())) {
+        if (event) {
+            *event = nullptr;
+        }
+
+        return CL_OUT_OF_RESOURCES;
+    }
+
     if (kernel.isUsingSharedObjArgs()) {
         kernel.resetSharedObjectsPatchAddresses();
     }
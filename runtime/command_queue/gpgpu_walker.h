@@ -52,6 +52,7 @@ constexpr int32_t ALU_REGISTER_R_SRCB = 0x21;
 constexpr int32_t ALU_REGISTER_R_ACCU = 0x31;
 
 constexpr uint32_t GP_THREAD_TIME_REG_ADDRESS_OFFSET_LOW = 0x23A8;
+constexpr uint32_t REG_GLOBAL_TIMESTAMP_LDW = 0x2358;
 
 void computeWorkgroupSize1D(
     uint32_t maxWorkGroupSize,
@@ -189,7 +190,8 @@ class GpgpuWalkerHelper {
         LinearStream *cmdStream,
         WALKER_TYPE<GfxFamily> *walkerCmd,
         TimestampPacket *timestampPacket,
-        TimestampPacket::WriteOperationType writeOperationType);
+        TimestampPacket::WriteOperationType writeOperationType,
+        bool writeProfilingData);
 
     static void dispatchScheduler(
         CommandQueue &commandQueue,
@@ -214,6 +216,7 @@ struct EnqueueOperation {
     static size_t getTotalSizeRequiredCS(uint32_t eventType, cl_uint numEventsInWaitList, bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue, const MultiDispatchInfo &multiDispatchInfo);
     static size_t getSizeRequiredCS(uint32_t cmdType, bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue, const Kernel *pKernel);
     static size_t getSizeRequiredForTimestampPacketWrite();
+    static size_t getSizeRequiredForTimestampPacketProfiling();
 
   private:
     static size_t getSizeRequiredCSKernel(bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue, const Kernel *pKernel);
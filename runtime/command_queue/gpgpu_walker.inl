@@ -414,6 +414,9 @@ size_t EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(uint32_t eventType, c
         auto atomicSize = sizeof(typename GfxFamily::MI_ATOMIC);
 
         expectedSizeCS += EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketWrite();
+        if (commandQueue.getDevice().getCommandStreamReceiver().peekTimestampPacketProfilingEnabled()) {
+            expectedSizeCS += multiDispatchInfo.size() * EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketProfiling();
+        }
         expectedSizeCS += numEventsInWaitList * (semaphoreSize + atomicSize);
         if (!commandQueue.isOOQEnabled()) {
             expectedSizeCS += semaphoreSize + atomicSize;
@@ -485,4 +488,9 @@ size_t EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketWrite() {
     return sizeof(PIPE_CONTROL);
 }
 
+template <typename GfxFamily>
+size_t EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketProfiling() {
+    return 4 * sizeof(typename GfxFamily::MI_STORE_REGISTER_MEM);
+}
+
 } // namespace OCLRT
@@ -180,12 +180,35 @@ void GpgpuWalkerHelper<GfxFamily>::setupTimestampPacket(
     LinearStream *cmdStream,
     WALKER_TYPE<GfxFamily> *walkerCmd,
     TimestampPacket *timestampPacket,
-    TimestampPacket::WriteOperationType writeOperationType) {
+    TimestampPacket::WriteOperationType writeOperationType,
+    bool writeProfilingData) {
+    using MI_STORE_REGISTER_MEM = typename GfxFamily::MI_STORE_REGISTER_MEM;
+
+    auto storeTimestamp = [&](uint32_t registerAddress, TimestampPacket::DataIndex dataIndex) {
+        auto pMICmd = static_cast<MI_STORE_REGISTER_MEM *>(cmdStream->getSpace(sizeof(MI_STORE_REGISTER_MEM)));
+        *pMICmd = MI_STORE_REGISTER_MEM::sInit();
+        pMICmd->setRegisterAddress(registerAddress);
+        pMICmd->setMemoryAddress(timestampPacket->pickAddressForDataWrite(dataIndex));
+    };
+
+    if (TimestampPacket::WriteOperationType::BeforeWalker == writeOperationType && writeProfilingData) {
+        storeTimestamp(GP_THREAD_TIME_REG_ADDRESS_OFFSET_LOW, TimestampPacket::DataIndex::ContextStart);
+        storeTimestamp(REG_GLOBAL_TIMESTAMP_LDW, TimestampPacket::DataIndex::GlobalStart);
+    }
 
     if (TimestampPacket::WriteOperationType::AfterWalker == writeOperationType) {
-        uint64_t address = timestampPacket->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd);
-
-        KernelCommandsHelper<GfxFamily>::programPipeControlDataWriteWithCsStall(*cmdStream, address, 0);
+        if (writeProfilingData) {
+            // CS stall waits for the walker, end timestamps written afterwards also complete the packet
+            auto pPipeControlCmd = static_cast<PIPE_CONTROL *>(cmdStream->getSpace(sizeof(PIPE_CONTROL)));
+            *pPipeControlCmd = PIPE_CONTROL::sInit();
+            pPipeControlCmd->setCommandStreamerStallEnable(true);
+
+            storeTimestamp(GP_THREAD_TIME_REG_ADDRESS_OFFSET_LOW, TimestampPacket::DataIndex::ContextEnd);
+            storeTimestamp(REG_GLOBAL_TIMESTAMP_LDW, TimestampPacket::DataIndex::GlobalEnd);
+        } else {
+            uint64_t address = timestampPacket->pickAddressForDataWrite(TimestampPacket::DataIndex::ContextEnd);
+            KernelCommandsHelper<GfxFamily>::programPipeControlDataWriteWithCsStall(*cmdStream, address, 0);
+        }
     }
 }
 
@@ -10,7 +10,9 @@
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/options.h"
 #include "runtime/memory_manager/os_agnostic_memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_inc_base.h"
+#include "runtime/utilities/compressed_file_writer.h"
 #include <algorithm>
 #include <cstring>
 #include <sstream>
@@ -64,18 +66,46 @@ extern const size_t g_dwordCountMax;
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    if (!fileHandle.is_open()) {
+        return;
+    }
+
+    auto compressionBlockSize = OCLRT::DebugManager.flags.AubDumpCompressionBlockSize.get();
+    if (compressionBlockSize > 0) {
+        auto codec = OCLRT::createBlockCodec(static_cast<uint32_t>(OCLRT::DebugManager.flags.AubDumpCompressionCodec.get()));
+        if (codec) {
+            asyncWriter = std::make_unique<OCLRT::CompressedFileWriter>(fileHandle, static_cast<size_t>(compressionBlockSize), std::move(codec));
+            return;
+        }
+        DEBUG_BREAK_IF(true);
+    }
+
+    auto asyncWriteBufferSize = OCLRT::DebugManager.flags.AubDumpAsyncWriteBufferSize.get();
+    if (asyncWriteBufferSize > 0) {
+        asyncWriter = std::make_unique<OCLRT::AsyncFileWriter>(fileHandle, static_cast<size_t>(asyncWriteBufferSize));
+    }
 }
 
 void AubFileStream::close() {
+    asyncWriter.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriter) {
+        asyncWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriter) {
+        asyncWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -18,6 +18,7 @@
 
 namespace OCLRT {
 
+class AubDumpedPagesTracker;
 class AubSubCaptureManager;
 
 template <typename GfxFamily>
@@ -97,6 +98,7 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     size_t gpgpuEngineIndex = arrayCount(gpgpuEngineInstances) - 1;
 
     std::unique_ptr<AubSubCaptureManager> subCaptureManager;
+    std::unique_ptr<AubDumpedPagesTracker> dumpedPagesTracker;
     uint32_t aubDeviceId;
     bool standalone;
 
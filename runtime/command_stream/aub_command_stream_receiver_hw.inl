@@ -6,6 +6,7 @@
  */
 
 #include "hw_cmds.h"
+#include "runtime/aub/aub_dumped_pages_tracker.h"
 #include "runtime/aub/aub_helper.h"
 #include "runtime/aub_mem_dump/page_table_entry_bits.h"
 #include "runtime/command_stream/aub_stream_provider.h"
@@ -61,6 +62,9 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const Hardware
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
+    if (DebugManager.flags.AUBDumpSkipUnchangedPages.get()) {
+        dumpedPagesTracker = std::make_unique<AubDumpedPagesTracker>();
+    }
 
     setCsrProgrammingMode();
 
@@ -151,6 +155,11 @@ void AUBCommandStreamReceiverHw<GfxFamily>::initFile(const std::string &fileName
         }
         // Add the file header
         stream->init(AubMemDump::SteppingValues::A, aubDeviceId);
+
+        // new file does not contain any of the previously dumped pages
+        if (dumpedPagesTracker) {
+            dumpedPagesTracker->reset();
+        }
     }
 }
 
@@ -370,7 +379,7 @@ FlushStamp AUBCommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batchBuffer
             }
         } else {
             allocationsForResidency.push_back(batchBuffer.commandBufferAllocation);
-            batchBuffer.commandBufferAllocation->residencyTaskCount[this->deviceIndex] = this->taskCount;
+            batchBuffer.commandBufferAllocation->updateResidencyTaskCount(this->taskCount, this->deviceIndex);
         }
     }
     processResidency(allocationsForResidency, osContext);
@@ -617,13 +626,41 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     }
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
+    auto additionalBits = getPPGTTAdditionalBits(&gfxAllocation);
+    auto addressSpace = AubHelper::getMemTrace(additionalBits);
+
+    // pages backed by physically contiguous memory are emitted as a single MemoryWrite record
+    uint64_t pendingPhysAddress = 0;
+    size_t pendingOffset = 0;
+    size_t pendingSize = 0;
+    auto writePendingPages = [&]() {
+        if (pendingSize != 0) {
+            AUB::addMemoryWrite(*stream, pendingPhysAddress, ptrOffset(cpuAddress, pendingOffset), pendingSize, addressSpace);
+            pendingSize = 0;
+        }
+    };
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
-        AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, getPPGTTAdditionalBits(&gfxAllocation),
-                                              aubHelperHw);
+        auto vmAddr = (static_cast<uintptr_t>(gpuAddress) + offset) & ~(MemoryConstants::pageSize - 1);
+        auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+        if (dumpedPagesTracker && !dumpedPagesTracker->updatePage(physAddress, ptrOffset(cpuAddress, offset), size, entryBits)) {
+            writePendingPages();
+            return;
+        }
+        AUB::reserveAddressPPGTT(*stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelperHw);
+
+        if (pendingSize != 0 && pendingPhysAddress + pendingSize == physAddress && pendingOffset + pendingSize == offset) {
+            pendingSize += size;
+            return;
+        }
+        writePendingPages();
+        pendingPhysAddress = physAddress;
+        pendingOffset = offset;
+        pendingSize = size;
     };
 
-    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, getPPGTTAdditionalBits(&gfxAllocation), walker, this->getMemoryBank(&gfxAllocation));
+    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, additionalBits, walker, this->getMemoryBank(&gfxAllocation));
+    writePendingPages();
 
     if (gfxAllocation.isLocked()) {
         this->getMemoryManager()->unlockResource(&gfxAllocation);
@@ -658,7 +695,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::expectMMIO(uint32_t mmioRegister, ui
     header.readMaskHigh = 0xffffffff;
     header.dwordCount = (sizeof(header) / sizeof(uint32_t)) - 1;
 
-    this->getAubStream()->fileHandle.write(reinterpret_cast<char *>(&header), sizeof(header));
+    this->getAubStream()->write(reinterpret_cast<char *>(&header), sizeof(header));
 }
 
 template <typename GfxFamily>
@@ -696,7 +733,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(ResidencyContainer
         if (!writeMemory(*gfxAllocation)) {
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) || !gfxAllocation->isAubWritable()));
         }
-        gfxAllocation->residencyTaskCount[this->deviceIndex] = this->taskCount + 1;
+        gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->deviceIndex);
     }
 
     dumpAubNonWritable = false;
@@ -704,9 +741,9 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(ResidencyContainer
 
 template <typename GfxFamily>
 void AUBCommandStreamReceiverHw<GfxFamily>::makeNonResident(GraphicsAllocation &gfxAllocation) {
-    if (gfxAllocation.residencyTaskCount[this->deviceIndex] != ObjectNotResident) {
+    if (gfxAllocation.getResidencyTaskCount(this->deviceIndex) != ObjectNotResident) {
         this->getEvictionAllocations().push_back(&gfxAllocation);
-        gfxAllocation.residencyTaskCount[this->deviceIndex] = ObjectNotResident;
+        gfxAllocation.updateResidencyTaskCount(ObjectNotResident, this->deviceIndex);
     }
 }
 
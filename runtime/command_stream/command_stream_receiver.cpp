@@ -20,6 +20,9 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/surface.h"
 #include "runtime/os_interface/os_interface.h"
+#include "runtime/utilities/timeline_tracer.h"
+
+#include <algorithm>
 
 namespace OCLRT {
 // Global table of CommandStreamReceiver factories for HW and tests
@@ -42,6 +45,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    if (DebugManager.flags.PrintScratchSpaceStats.get() && requiredScratchSize) {
+        scratchSpaceManager.printStats(requiredScratchSize);
+    }
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         if (indirectHeap[i] != nullptr) {
             auto allocation = indirectHeap[i]->getGraphicsAllocation();
@@ -59,14 +65,15 @@ CommandStreamReceiver::~CommandStreamReceiver() {
 
 void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
     auto submissionTaskCount = this->taskCount + 1;
-    if (gfxAllocation.residencyTaskCount[deviceIndex] < (int)submissionTaskCount) {
+    auto residencyTaskCount = gfxAllocation.getResidencyTaskCount(deviceIndex);
+    if (residencyTaskCount < (int)submissionTaskCount) {
         this->getResidencyAllocations().push_back(&gfxAllocation);
         gfxAllocation.updateTaskCount(submissionTaskCount, deviceIndex);
-        if (gfxAllocation.residencyTaskCount[deviceIndex] == ObjectNotResident) {
+        if (residencyTaskCount == ObjectNotResident) {
             this->totalMemoryUsed += gfxAllocation.getUnderlyingBufferSize();
         }
     }
-    gfxAllocation.residencyTaskCount[deviceIndex] = submissionTaskCount;
+    gfxAllocation.updateResidencyTaskCount(submissionTaskCount, deviceIndex);
 }
 
 void CommandStreamReceiver::processEviction(OsContext &osContext) {
@@ -74,7 +81,7 @@ void CommandStreamReceiver::processEviction(OsContext &osContext) {
 }
 
 void CommandStreamReceiver::makeNonResident(GraphicsAllocation &gfxAllocation) {
-    if (gfxAllocation.residencyTaskCount[deviceIndex] != ObjectNotResident) {
+    if (gfxAllocation.getResidencyTaskCount(deviceIndex) != ObjectNotResident) {
         makeCoherent(gfxAllocation);
         if (gfxAllocation.peekEvictable()) {
             this->getEvictionAllocations().push_back(&gfxAllocation);
@@ -83,7 +90,7 @@ void CommandStreamReceiver::makeNonResident(GraphicsAllocation &gfxAllocation) {
         }
     }
 
-    gfxAllocation.residencyTaskCount[deviceIndex] = ObjectNotResident;
+    gfxAllocation.updateResidencyTaskCount(ObjectNotResident, deviceIndex);
 }
 
 void CommandStreamReceiver::makeSurfacePackNonResident(ResidencyContainer &allocationsForResidency, OsContext &osContext) {
@@ -96,6 +103,44 @@ void CommandStreamReceiver::makeSurfacePackNonResident(ResidencyContainer &alloc
     this->processEviction(osContext);
 }
 
+void CommandStreamReceiver::traceFlush(TimelineTracer &tracer, uint64_t flushStartTimestamp, const ResidencyContainer &allocationsForResidency) {
+    uint64_t residencySize = 0;
+    for (auto &surface : allocationsForResidency) {
+        residencySize += surface->getUnderlyingBufferSize();
+    }
+    auto flushEndTimestamp = tracer.getTimestamp();
+    tracer.recordSpan("csr", "CSR flush", flushStartTimestamp, flushEndTimestamp, "taskCount", latestFlushedTaskCount);
+    tracer.recordCounter("csr", "Flushed taskCount", flushEndTimestamp, latestFlushedTaskCount);
+    tracer.recordCounter("csr", "Completed taskCount", flushEndTimestamp, tagAddress ? *tagAddress : 0);
+    tracer.recordCounter("csr", "Residency size", flushEndTimestamp, residencySize);
+    auto scratchSpaceStats = scratchSpaceManager.getStats();
+    tracer.recordCounter("csr", "Scratch reallocations", flushEndTimestamp, scratchSpaceStats.reallocationsCount);
+    tracer.recordCounter("csr", "VFE reprograms", flushEndTimestamp, scratchSpaceStats.vfeReprogramsCount);
+    tracer.recordCounter("csr", "SBA programs", flushEndTimestamp, flushTaskStats.stateBaseAddressCount);
+    tracer.recordCounter("csr", "Elided dependency PIPE_CONTROLs", flushEndTimestamp, flushTaskStats.elidedDependencyPipeControlCount);
+}
+
+void CommandStreamReceiver::recordFlushTaskStats(const FlushTaskStats &flushStats) {
+    flushTaskStats.flushesCount += flushStats.flushesCount;
+    flushTaskStats.stateBaseAddressCount += flushStats.stateBaseAddressCount;
+    flushTaskStats.mediaVfeStateCount += flushStats.mediaVfeStateCount;
+    flushTaskStats.dependencyPipeControlCount += flushStats.dependencyPipeControlCount;
+    flushTaskStats.elidedDependencyPipeControlCount += flushStats.elidedDependencyPipeControlCount;
+    flushTaskStats.csrStreamBytes += flushStats.csrStreamBytes;
+    flushTaskStats.taskStreamBytes += flushStats.taskStreamBytes;
+
+    if (DebugManager.flags.PrintFlushTaskStats.get()) {
+        printDebugString(true, stdout, "flushTask %u: %llu STATE_BASE_ADDRESS, %llu MEDIA_VFE_STATE, %llu dependency PIPE_CONTROL (%llu elided), CSR stream %llu bytes, task stream %llu bytes\n",
+                         taskCount + 1,
+                         static_cast<unsigned long long>(flushStats.stateBaseAddressCount),
+                         static_cast<unsigned long long>(flushStats.mediaVfeStateCount),
+                         static_cast<unsigned long long>(flushStats.dependencyPipeControlCount),
+                         static_cast<unsigned long long>(flushStats.elidedDependencyPipeControlCount),
+                         static_cast<unsigned long long>(flushStats.csrStreamBytes),
+                         static_cast<unsigned long long>(flushStats.taskStreamBytes));
+    }
+}
+
 void CommandStreamReceiver::makeResidentHostPtrAllocation(GraphicsAllocation *gfxAllocation) {
     makeResident(*gfxAllocation);
     if (!gfxAllocation->isL3Capable()) {
@@ -209,8 +254,9 @@ void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
 }
 
 void CommandStreamReceiver::setRequiredScratchSize(uint32_t newRequiredScratchSize) {
-    if (newRequiredScratchSize > requiredScratchSize) {
-        requiredScratchSize = newRequiredScratchSize;
+    auto tierSize = ScratchSpaceManager::getTierSize(newRequiredScratchSize);
+    if (tierSize > requiredScratchSize) {
+        requiredScratchSize = tierSize;
     }
 }
 
@@ -225,6 +271,7 @@ void CommandStreamReceiver::initProgrammingFlags() {
     lastMediaSamplerConfig = -1;
     lastPreemptionMode = PreemptionMode::Initial;
     latestSentStatelessMocsConfig = 0;
+    lastSentGeneralStateBaseAddress = 0;
 }
 
 ResidencyContainer &CommandStreamReceiver::getResidencyAllocations() {
@@ -322,6 +369,31 @@ void CommandStreamReceiver::releaseIndirectHeap(IndirectHeap::Type heapType) {
     }
 }
 
+void CommandStreamReceiver::warmUp(uint32_t commandBuffersCount) {
+    auto lock = obtainUniqueOwnership();
+    auto memoryManager = getMemoryManager();
+
+    getCS();
+    for (auto heapType : {IndirectHeap::DYNAMIC_STATE, IndirectHeap::INDIRECT_OBJECT, IndirectHeap::SURFACE_STATE}) {
+        getIndirectHeap(heapType, 0);
+    }
+    // stored after command stream and heaps were taken, so they are left for command streams of queues
+    commandBuffersCount = std::min(commandBuffersCount, CSRequirements::maxWarmUpCommandBuffersCount);
+    for (uint32_t i = 0; i < commandBuffersCount; i++) {
+        auto allocation = memoryManager->allocateGraphicsMemory(CSRequirements::warmUpCommandBufferSize, MemoryConstants::pageSize, true, false);
+        if (!allocation) {
+            break;
+        }
+        allocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+        internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+    }
+
+    memoryManager->getEventTsAllocator();
+    if (timestampPacketWriteEnabled) {
+        memoryManager->getTimestampPacketAllocator();
+    }
+}
+
 void CommandStreamReceiver::setExperimentalCmdBuffer(std::unique_ptr<ExperimentalCommandBuffer> &&cmdBuffer) {
     experimentalCmdBuffer = std::move(cmdBuffer);
 }
@@ -341,6 +413,11 @@ bool CommandStreamReceiver::initializeTagAllocation() {
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
+
+FlushStamp CommandStreamReceiver::obtainCurrentFlushStamp() const {
+    return flushStamp->peekStamp();
+}
+
 AllocationsList &CommandStreamReceiver::getTemporaryAllocations() { return internalAllocationStorage->getTemporaryAllocations(); }
 AllocationsList &CommandStreamReceiver::getAllocationsForReuse() { return internalAllocationStorage->getAllocationsForReuse(); }
 
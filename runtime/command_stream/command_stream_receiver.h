@@ -8,6 +8,7 @@
 #pragma once
 #include "runtime/command_stream/csr_definitions.h"
 #include "runtime/command_stream/linear_stream.h"
+#include "runtime/command_stream/scratch_space_manager.h"
 #include "runtime/command_stream/submissions_aggregator.h"
 #include "runtime/command_stream/thread_arbitration_policy.h"
 #include "runtime/helpers/address_patch.h"
@@ -35,6 +36,7 @@ class LinearStream;
 class MemoryManager;
 class OsContext;
 class OSInterface;
+class TimelineTracer;
 
 enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
@@ -103,14 +105,19 @@ class CommandStreamReceiver {
 
     uint32_t peekLatestFlushedTaskCount() const { return latestFlushedTaskCount; }
 
+    FlushStamp obtainCurrentFlushStamp() const;
+
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    DispatchMode peekDispatchMode() const { return this->dispatchMode; }
 
     virtual void overrideMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
     void setRequiredScratchSize(uint32_t newRequiredScratchSize);
     GraphicsAllocation *getScratchAllocation() { return scratchAllocation; }
+    const ScratchSpaceManager &getScratchSpaceManager() const { return scratchSpaceManager; }
+    const FlushTaskStats &getFlushTaskStats() const { return flushTaskStats; }
     GraphicsAllocation *getDebugSurfaceAllocation() { return debugSurface; }
     GraphicsAllocation *allocateDebugSurface(size_t size);
 
@@ -145,6 +152,7 @@ class CommandStreamReceiver {
     }
 
     bool peekTimestampPacketWriteEnabled() const { return timestampPacketWriteEnabled; }
+    bool peekTimestampPacketProfilingEnabled() const { return timestampPacketWriteEnabled && timestampPacketProfilingEnabled; }
 
     size_t defaultSshSize;
 
@@ -154,9 +162,13 @@ class CommandStreamReceiver {
     AllocationsList &getAllocationsForReuse();
     InternalAllocationStorage *getInternalAllocationStorage() const { return internalAllocationStorage.get(); }
     bool createAllocationForHostSurface(HostPtrSurface &surface, Device &device, bool requiresL3Flush);
+    // allocates command stream, heaps and timestamp tags, stores commandBuffersCount command buffers for reuse
+    void warmUp(uint32_t commandBuffersCount);
 
   protected:
     void cleanupResources();
+    void traceFlush(TimelineTracer &tracer, uint64_t flushStartTimestamp, const ResidencyContainer &allocationsForResidency);
+    void recordFlushTaskStats(const FlushTaskStats &flushStats);
     void setDisableL3Cache(bool val) {
         disableL3Cache = val;
     }
@@ -184,6 +196,8 @@ class CommandStreamReceiver {
     OSInterface *osInterface = nullptr;
 
     IndirectHeap *indirectHeap[IndirectHeap::NUM_TYPES];
+    ScratchSpaceManager scratchSpaceManager;
+    FlushTaskStats flushTaskStats;
 
     // current taskLevel.  Used for determining if a PIPE_CONTROL is needed.
     std::atomic<uint32_t> taskLevel{0};
@@ -200,6 +214,7 @@ class CommandStreamReceiver {
     uint32_t taskCount = 0;
     uint32_t lastSentL3Config = 0;
     uint32_t latestSentStatelessMocsConfig = 0;
+    uint64_t lastSentGeneralStateBaseAddress = 0;
     uint32_t lastSentNumGrfRequired = GrfConfig::DefaultGrfNumber;
     uint32_t requiredThreadArbitrationPolicy = ThreadArbitrationPolicy::RoundRobin;
     uint32_t lastSentThreadArbitrationPolicy = ThreadArbitrationPolicy::NotPresent;
@@ -217,6 +232,7 @@ class CommandStreamReceiver {
     bool disableL3Cache = false;
     bool stallingPipeControlOnNextFlushRequired = false;
     bool timestampPacketWriteEnabled = false;
+    bool timestampPacketProfilingEnabled = false;
     bool nTo1SubmissionModelEnabled = false;
 };
 
@@ -26,6 +26,7 @@
 #include "runtime/command_stream/preemption.h"
 #include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/timeline_tracer.h"
 
 namespace OCLRT {
 
@@ -50,6 +51,7 @@ CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(const HardwareInfo &
     if (DebugManager.flags.EnableTimestampPacket.get() != -1) {
         timestampPacketWriteEnabled = !!DebugManager.flags.EnableTimestampPacket.get();
     }
+    timestampPacketProfilingEnabled = DebugManager.flags.EnableTimestampPacketProfiling.get();
 }
 
 template <typename GfxFamily>
@@ -157,7 +159,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     auto levelClosed = false;
     void *currentPipeControlForNooping = nullptr;
+    void *independentPipeControlForNooping = nullptr;
     void *epiloguePipeControlLocation = nullptr;
+    void *dependencyPipeControlLocation = nullptr;
 
     if (DebugManager.flags.ForceCsrFlushing.get()) {
         flushBatchedSubmissions();
@@ -182,6 +186,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         if ((dispatchFlags.outOfOrderExecutionAllowed || timestampPacketWriteEnabled) &&
             !dispatchFlags.dcFlush) {
             currentPipeControlForNooping = epiloguePipeControlLocation;
+        } else if (!dispatchFlags.dcFlush) {
+            //in-order walkers of the next batched task need this stall only if they depend on walkers before it
+            independentPipeControlForNooping = epiloguePipeControlLocation;
         }
 
         //Some architectures (SKL) requires to have pipe control prior to pipe control with tag write, add it here
@@ -243,23 +250,23 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     size_t requiredScratchSizeInBytes = requiredScratchSize * device.getDeviceInfo().computeUnitsUsedForScratch;
 
     auto force32BitAllocations = getMemoryManager()->peekForce32BitAllocations();
+    auto vfeReprogramsCount = scratchSpaceManager.getVfeReprogramsCount();
 
-    bool stateBaseAddressDirty = false;
-
-    if (requiredScratchSize && (!scratchAllocation || scratchAllocation->getUnderlyingBufferSize() < requiredScratchSizeInBytes)) {
+    if (scratchSpaceManager.isAllocationRequired(requiredScratchSizeInBytes, scratchAllocation)) {
         if (scratchAllocation) {
             scratchAllocation->updateTaskCount(this->taskCount, this->deviceIndex);
             internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            scratchSpaceManager.recordReallocation();
         }
         createScratchSpaceAllocation(requiredScratchSizeInBytes);
         overrideMediaVFEStateDirty(true);
-        if (is64bit && !force32BitAllocations) {
-            stateBaseAddressDirty = true;
-        }
     }
 
     auto &commandStreamCSR = this->getCS(getRequiredCmdStreamSizeAligned(dispatchFlags, device));
     auto commandStreamStartCSR = commandStreamCSR.getUsed();
+    FlushTaskStats flushStats;
+    // CS stall with DC flush already programmed in this flush (SBA PIPE_CONTROL) makes dependency PIPE_CONTROL redundant
+    bool commandStreamerStalled = false;
 
     if (dispatchFlags.outOfDeviceDependencies) {
         handleEventsTimestampPacketTags(commandStreamCSR, dispatchFlags, device);
@@ -283,15 +290,20 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         this->lastSentThreadArbitrationPolicy = this->requiredThreadArbitrationPolicy;
     }
 
-    stateBaseAddressDirty |= ((GSBAFor32BitProgrammed ^ dispatchFlags.GSBA32BitRequired) && force32BitAllocations);
-
     programVFEState(commandStreamCSR, dispatchFlags);
 
+    uint64_t newGSHbase = 0;
+    if (is64bit && scratchAllocation && !force32BitAllocations) {
+        newGSHbase = (uint64_t)scratchAllocation->getUnderlyingBuffer() - PreambleHelper<GfxFamily>::getScratchSpaceOffsetFor64bit();
+    } else if (is64bit && force32BitAllocations && dispatchFlags.GSBA32BitRequired) {
+        newGSHbase = getMemoryManager()->allocator32Bit->getBase();
+    }
+
     bool dshDirty = dshState.updateAndCheck(&dsh);
     bool iohDirty = iohState.updateAndCheck(&ioh);
     bool sshDirty = sshState.updateAndCheck(&ssh);
 
-    auto isStateBaseAddressDirty = dshDirty || iohDirty || sshDirty || stateBaseAddressDirty;
+    auto isStateBaseAddressDirty = dshDirty || iohDirty || sshDirty || newGSHbase != lastSentGeneralStateBaseAddress;
 
     auto requiredL3Index = CacheSettings::l3CacheOn;
     if (this->disableL3Cache) {
@@ -308,15 +320,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         auto pCmd = addPipeControlCmd(commandStreamCSR);
         pCmd->setTextureCacheInvalidationEnable(true);
         pCmd->setDcFlushEnable(true);
+        commandStreamerStalled = true;
 
-        uint64_t newGSHbase = 0;
-        GSBAFor32BitProgrammed = false;
-        if (is64bit && scratchAllocation && !force32BitAllocations) {
-            newGSHbase = (uint64_t)scratchAllocation->getUnderlyingBuffer() - PreambleHelper<GfxFamily>::getScratchSpaceOffsetFor64bit();
-        } else if (is64bit && force32BitAllocations && dispatchFlags.GSBA32BitRequired) {
-            newGSHbase = getMemoryManager()->allocator32Bit->getBase();
-            GSBAFor32BitProgrammed = true;
-        }
+        GSBAFor32BitProgrammed = is64bit && force32BitAllocations && dispatchFlags.GSBA32BitRequired;
 
         auto stateBaseAddressCmdOffset = commandStreamCSR.getUsed();
 
@@ -338,6 +344,8 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         programStateSip(commandStreamCSR, device);
 
         latestSentStatelessMocsConfig = requiredL3Index;
+        lastSentGeneralStateBaseAddress = newGSHbase;
+        flushStats.stateBaseAddressCount++;
 
         if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
             collectStateBaseAddresPatchInfo(commandStream.getGraphicsAllocation()->getGpuAddress(), stateBaseAddressCmdOffset, dsh, ioh, ssh, newGSHbase);
@@ -361,12 +369,20 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     if (experimentalCmdBuffer.get() != nullptr) {
         size_t startingOffset = experimentalCmdBuffer->programExperimentalCommandBuffer<GfxFamily>();
         experimentalCmdBuffer->injectBufferStart<GfxFamily>(commandStreamCSR, startingOffset);
+        commandStreamerStalled = false;
     }
 
     // Add a PC if we have a dependency on a previous walker to avoid concurrency issues.
     if (taskLevel > this->taskLevel) {
         if (!timestampPacketWriteEnabled) {
-            addPipeControl(commandStreamCSR, false);
+            if (commandStreamerStalled) {
+                flushStats.elidedDependencyPipeControlCount++;
+            } else {
+                dependencyPipeControlLocation = ptrOffset(commandStreamCSR.getCpuBase(), commandStreamCSR.getUsed());
+                addPipeControl(commandStreamCSR, false);
+                flushStats.dependencyPipeControlCount++;
+                commandStreamerStalled = true;
+            }
         }
         this->taskLevel = taskLevel;
         DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "this->taskCount", this->taskCount);
@@ -450,8 +466,13 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     if (submitCSR | submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+            auto timelineTracer = TimelineTracer::get();
+            auto flushStartTimestamp = timelineTracer ? timelineTracer->getTimestamp() : 0;
             flushStamp->setStamp(this->flush(batchBuffer, engineType, this->getResidencyAllocations(), *device.getOsContext()));
             this->latestFlushedTaskCount = this->taskCount + 1;
+            if (timelineTracer) {
+                this->traceFlush(*timelineTracer, flushStartTimestamp, this->getResidencyAllocations());
+            }
             this->makeSurfacePackNonResident(this->getResidencyAllocations(), *device.getOsContext());
         } else {
             auto commandBuffer = new CommandBuffer(device);
@@ -461,13 +482,25 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->taskCount = this->taskCount + 1;
             commandBuffer->flushStamp->replaceStampObject(dispatchFlags.flushStampReference);
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
+            commandBuffer->pipeControlThatMayBeErasedIfIndependentLocation = independentPipeControlForNooping;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
+            commandBuffer->dependencyPipeControlLocation = dependencyPipeControlLocation;
+            commandBuffer->commandStreamerStalled = commandStreamerStalled;
+            if (dispatchFlags.surfacesAccess) {
+                commandBuffer->surfacesAccess.reset(new SurfacesAccess(std::move(*dispatchFlags.surfacesAccess)));
+            }
             this->submissionAggregator->recordCommandBuffer(commandBuffer);
         }
     } else {
         this->makeSurfacePackNonResident(this->getResidencyAllocations(), *device.getOsContext());
     }
 
+    flushStats.flushesCount = 1;
+    flushStats.mediaVfeStateCount = scratchSpaceManager.getVfeReprogramsCount() - vfeReprogramsCount;
+    flushStats.csrStreamBytes = commandStreamCSR.getUsed() - commandStreamStartCSR;
+    flushStats.taskStreamBytes = commandStreamTask.getUsed() - commandStreamStartTask;
+    recordFlushTaskStats(flushStats);
+
     //check if we are not over the budget, if we are do implicit flush
     if (getMemoryManager()->isMemoryBudgetExhausted()) {
         if (this->totalMemoryUsed >= device.getDeviceInfo().globalMemSize / 4) {
@@ -517,7 +550,9 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
         ResourcePackage resourcePackage;
         auto pipeControlLocationSize = getRequiredPipeControlSize();
         void *currentPipeControlForNooping = nullptr;
+        void *independentPipeControlForNooping = nullptr;
         void *epiloguePipeControlLocation = nullptr;
+        auto analyzeDependencies = !DebugManager.flags.DisableBatchedDependencyAnalysis.get();
 
         while (!commandBufferList.peekIsEmpty()) {
             size_t totalUsedSize = 0u;
@@ -531,8 +566,15 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             flushStampUpdateHelper.insert(primaryCmdBuffer->flushStamp->getStampReference());
 
             currentPipeControlForNooping = primaryCmdBuffer->pipeControlThatMayBeErasedLocation;
+            independentPipeControlForNooping = primaryCmdBuffer->pipeControlThatMayBeErasedIfIndependentLocation;
             epiloguePipeControlLocation = primaryCmdBuffer->epiloguePipeControlLocation;
 
+            BatchedDependencyTracker dependencyTracker;
+            if (primaryCmdBuffer->commandStreamerStalled) {
+                dependencyTracker.stall();
+            }
+            dependencyTracker.addCommandBuffer(primaryCmdBuffer->surfacesAccess.get());
+
             if (DebugManager.flags.FlattenBatchBufferForAUBDump.get()) {
                 flatBatchBufferHelper->registerCommandChunk(primaryCmdBuffer.get()->batchBuffer, sizeof(MI_BATCH_BUFFER_START));
             }
@@ -543,9 +585,31 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                         flatBatchBufferHelper->removePipeControlData(pipeControlLocationSize, currentPipeControlForNooping);
                     }
                     memset(currentPipeControlForNooping, 0, pipeControlLocationSize);
+                } else if (independentPipeControlForNooping && analyzeDependencies && !dependencyTracker.isDependent(nextCommandBuffer->surfacesAccess.get())) {
+                    //noop in-order epilogue pipe control if walkers of next command buffer do not access memory used since the last stall
+                    if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+                        flatBatchBufferHelper->removePipeControlData(pipeControlLocationSize, independentPipeControlForNooping);
+                    }
+                    memset(independentPipeControlForNooping, 0, pipeControlLocationSize);
+                } else if (epiloguePipeControlLocation) {
+                    dependencyTracker.stall();
+                }
+                //noop dependency pipe control if walkers of next command buffer do not access memory used since the last stall
+                if (nextCommandBuffer->dependencyPipeControlLocation) {
+                    if (analyzeDependencies && !dependencyTracker.isDependent(nextCommandBuffer->surfacesAccess.get())) {
+                        memset(nextCommandBuffer->dependencyPipeControlLocation, 0, pipeControlLocationSize);
+                        this->flushTaskStats.dependencyPipeControlCount--;
+                        this->flushTaskStats.elidedDependencyPipeControlCount++;
+                    } else {
+                        dependencyTracker.stall();
+                    }
+                } else if (nextCommandBuffer->commandStreamerStalled) {
+                    dependencyTracker.stall();
                 }
+                dependencyTracker.addCommandBuffer(nextCommandBuffer->surfacesAccess.get());
                 //obtain next candidate for nooping
                 currentPipeControlForNooping = nextCommandBuffer->pipeControlThatMayBeErasedLocation;
+                independentPipeControlForNooping = nextCommandBuffer->pipeControlThatMayBeErasedIfIndependentLocation;
                 //track epilogue pipe control
                 epiloguePipeControlLocation = nextCommandBuffer->epiloguePipeControlLocation;
 
@@ -571,6 +635,8 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             if (epiloguePipeControlLocation) {
                 ((PIPE_CONTROL *)epiloguePipeControlLocation)->setDcFlushEnable(true);
             }
+            auto timelineTracer = TimelineTracer::get();
+            auto flushStartTimestamp = timelineTracer ? timelineTracer->getTimestamp() : 0;
             auto flushStamp = this->flush(primaryCmdBuffer->batchBuffer, engineType, surfacesForSubmit, *device.getOsContext());
 
             //after flush task level is closed
@@ -580,6 +646,9 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
 
             this->latestFlushedTaskCount = lastTaskCount;
             this->flushStamp->setStamp(flushStamp);
+            if (timelineTracer) {
+                this->traceFlush(*timelineTracer, flushStartTimestamp, surfacesForSubmit);
+            }
             this->makeSurfacePackNonResident(surfacesForSubmit, *device.getOsContext());
             resourcePackage.clear();
         }
@@ -757,6 +826,7 @@ template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags) {
     if (mediaVfeStateDirty) {
         PreambleHelper<GfxFamily>::programVFEState(&csr, hwInfo, requiredScratchSize, getScratchPatchAddress());
+        scratchSpaceManager.recordVfeReprogram();
         overrideMediaVFEStateDirty(false);
     }
 }
@@ -11,9 +11,11 @@
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/kernel/grf_config.h"
 #include <limits>
+#include <vector>
 
 namespace OCLRT {
 struct FlushStampTrackingObj;
+class GraphicsAllocation;
 
 namespace CSRequirements {
 //cleanup section usually contains 1-2 pipeControls BB end and place for BB start
@@ -23,12 +25,21 @@ namespace CSRequirements {
 
 constexpr auto minCommandQueueCommandStreamSize = 2 * MemoryConstants::cacheLineSize;
 constexpr auto csOverfetchSize = MemoryConstants::pageSize;
+// size of command buffers allocated ahead of first enqueue, fits command stream of typical enqueue
+constexpr auto warmUpCommandBufferSize = 16 * MemoryConstants::pageSize;
+constexpr uint32_t maxWarmUpCommandBuffersCount = 8;
 } // namespace CSRequirements
 
 namespace TimeoutControls {
 constexpr int64_t maxTimeout = std::numeric_limits<int64_t>::max();
 }
 
+// allocations read and written by kernels of a task, batched submission uses them to find tasks that do not depend on each other
+struct SurfacesAccess {
+    std::vector<GraphicsAllocation *> readAllocations;
+    std::vector<GraphicsAllocation *> writtenAllocations;
+};
+
 struct DispatchFlags {
     bool blocking = false;
     bool dcFlush = false;
@@ -45,6 +56,7 @@ struct DispatchFlags {
     PreemptionMode preemptionMode = PreemptionMode::Disabled;
     EventsRequest *outOfDeviceDependencies = nullptr;
     uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    SurfacesAccess *surfacesAccess = nullptr;
 };
 
 struct CsrSizeRequestFlags {
@@ -55,4 +67,15 @@ struct CsrSizeRequestFlags {
     bool hasSharedHandles = false;
     bool numGrfRequiredChanged = false;
 };
+
+// commands emitted by flushTask since creation of CSR, bytes count both CSR and task command streams
+struct FlushTaskStats {
+    uint64_t flushesCount = 0;
+    uint64_t stateBaseAddressCount = 0;
+    uint64_t mediaVfeStateCount = 0;
+    uint64_t dependencyPipeControlCount = 0;
+    uint64_t elidedDependencyPipeControlCount = 0;
+    uint64_t csrStreamBytes = 0;
+    uint64_t taskStreamBytes = 0;
+};
 } // namespace OCLRT
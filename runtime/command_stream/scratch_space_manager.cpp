@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/scratch_space_manager.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+namespace OCLRT {
+
+ScratchSpaceManager::ScratchSpaceManager() : startTime(std::chrono::steady_clock::now()) {
+}
+
+uint32_t ScratchSpaceManager::getTierSize(uint32_t perThreadScratchSize) {
+    if (perThreadScratchSize == 0) {
+        return 0;
+    }
+    auto tierSize = Math::nextPowerOfTwo(perThreadScratchSize);
+    return tierSize < minPerThreadScratchSize ? minPerThreadScratchSize : tierSize;
+}
+
+bool ScratchSpaceManager::isAllocationRequired(size_t requiredSizeInBytes, GraphicsAllocation *currentAllocation) const {
+    if (requiredSizeInBytes == 0) {
+        return false;
+    }
+    return !currentAllocation || currentAllocation->getUnderlyingBufferSize() < requiredSizeInBytes;
+}
+
+ScratchSpaceStats ScratchSpaceManager::getStats() const {
+    ScratchSpaceStats stats;
+    stats.reallocationsCount = reallocationsCount;
+    stats.vfeReprogramsCount = vfeReprogramsCount;
+    stats.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return stats;
+}
+
+void ScratchSpaceManager::printStats(uint32_t perThreadScratchSize) const {
+    auto stats = getStats();
+    printDebugString(true, stdout, "Scratch space: per-thread size %u, %llu reallocations (%.2f/s), %llu VFE reprograms (%.2f/s)\n",
+                     perThreadScratchSize,
+                     static_cast<unsigned long long>(stats.reallocationsCount), stats.getReallocationsPerSecond(),
+                     static_cast<unsigned long long>(stats.vfeReprogramsCount), stats.getVfeReprogramsPerSecond());
+}
+} // namespace OCLRT
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace OCLRT {
+class GraphicsAllocation;
+
+struct ScratchSpaceStats {
+    uint64_t reallocationsCount = 0;
+    uint64_t vfeReprogramsCount = 0;
+    double elapsedSeconds = 0.0;
+
+    double getReallocationsPerSecond() const {
+        return elapsedSeconds > 0.0 ? reallocationsCount / elapsedSeconds : 0.0;
+    }
+    double getVfeReprogramsPerSecond() const {
+        return elapsedSeconds > 0.0 ? vfeReprogramsCount / elapsedSeconds : 0.0;
+    }
+};
+
+// Scratch space of a CSR only grows. Per-thread sizes are rounded up to power of two tiers, the granularity
+// MEDIA_VFE_STATE encodes them with, so kernels whose requirements differ within a tier share one scratch
+// allocation and one VFE programming instead of replacing the allocation on every small increase.
+class ScratchSpaceManager {
+  public:
+    static const uint32_t minPerThreadScratchSize = static_cast<uint32_t>(MemoryConstants::kiloByte);
+
+    ScratchSpaceManager();
+
+    // returns 0 for kernels without scratch
+    static uint32_t getTierSize(uint32_t perThreadScratchSize);
+
+    bool isAllocationRequired(size_t requiredSizeInBytes, GraphicsAllocation *currentAllocation) const;
+
+    void recordReallocation() { reallocationsCount++; }
+    void recordVfeReprogram() { vfeReprogramsCount++; }
+    uint64_t getVfeReprogramsCount() const { return vfeReprogramsCount; }
+
+    // rates are averaged since creation of the manager
+    ScratchSpaceStats getStats() const;
+    void printStats(uint32_t perThreadScratchSize) const;
+
+  protected:
+    std::chrono::steady_clock::time_point startTime;
+    uint64_t reallocationsCount = 0;
+    uint64_t vfeReprogramsCount = 0;
+};
+} // namespace OCLRT
@@ -93,6 +93,38 @@ void OCLRT::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resou
     }
 }
 
+bool OCLRT::BatchedDependencyTracker::isDependent(const SurfacesAccess *surfacesAccess) const {
+    if (!accessKnown || !surfacesAccess) {
+        return true;
+    }
+    for (auto &graphicsAllocation : surfacesAccess->readAllocations) {
+        if (writtenAllocations.count(graphicsAllocation)) {
+            return true;
+        }
+    }
+    for (auto &graphicsAllocation : surfacesAccess->writtenAllocations) {
+        if (writtenAllocations.count(graphicsAllocation) || readAllocations.count(graphicsAllocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void OCLRT::BatchedDependencyTracker::addCommandBuffer(const SurfacesAccess *surfacesAccess) {
+    if (!surfacesAccess) {
+        accessKnown = false;
+        return;
+    }
+    readAllocations.insert(surfacesAccess->readAllocations.begin(), surfacesAccess->readAllocations.end());
+    writtenAllocations.insert(surfacesAccess->writtenAllocations.begin(), surfacesAccess->writtenAllocations.end());
+}
+
+void OCLRT::BatchedDependencyTracker::stall() {
+    accessKnown = true;
+    readAllocations.clear();
+    writtenAllocations.clear();
+}
+
 OCLRT::BatchBuffer::BatchBuffer(GraphicsAllocation *commandBufferAllocation, size_t startOffset, size_t chainedBatchBufferStartOffset, GraphicsAllocation *chainedBatchBuffer, bool requiresCoherency, bool lowPriority, QueueThrottle throttle, size_t usedSize, LinearStream *stream) : commandBufferAllocation(commandBufferAllocation), startOffset(startOffset), chainedBatchBufferStartOffset(chainedBatchBufferStartOffset), chainedBatchBuffer(chainedBatchBuffer), requiresCoherency(requiresCoherency), low_priority(lowPriority), throttle(throttle), usedSize(usedSize), stream(stream) {
 }
 
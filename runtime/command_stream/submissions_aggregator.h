@@ -8,9 +8,12 @@
 #pragma once
 #include "runtime/utilities/idlist.h"
 #include "runtime/utilities/stackvec.h"
+#include "runtime/command_stream/csr_definitions.h"
 #include "runtime/command_stream/linear_stream.h"
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/memory_manager/residency_container.h"
+#include <memory>
+#include <unordered_set>
 #include <vector>
 namespace OCLRT {
 class Device;
@@ -50,7 +53,14 @@ struct CommandBuffer : public IDNode<CommandBuffer> {
     uint32_t inspectionId = 0;
     uint32_t taskCount = 0u;
     void *pipeControlThatMayBeErasedLocation = nullptr;
+    // epilogue pipe control of in-order task, may be erased when walkers of the next task do not depend on walkers before it
+    void *pipeControlThatMayBeErasedIfIndependentLocation = nullptr;
     void *epiloguePipeControlLocation = nullptr;
+    void *dependencyPipeControlLocation = nullptr;
+    // CSR stream of the task stalls command streamer before its walkers are executed
+    bool commandStreamerStalled = false;
+    // nullptr when allocations accessed by the command buffer are not known
+    std::unique_ptr<SurfacesAccess> surfacesAccess;
     std::unique_ptr<FlushStampTracker> flushStamp;
     Device &device;
 };
@@ -69,4 +79,19 @@ class SubmissionAggregator {
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
 };
+
+// Tracks allocations accessed by command buffers of aggregated chain since the last stall. Command buffer that neither
+// reads nor writes allocation written since then, nor writes allocation read since then, does not need stall before
+// its walkers. Command buffers of unknown access make every following one dependent until the next stall.
+class BatchedDependencyTracker {
+  public:
+    bool isDependent(const SurfacesAccess *surfacesAccess) const;
+    void addCommandBuffer(const SurfacesAccess *surfacesAccess);
+    void stall();
+
+  protected:
+    bool accessKnown = false;
+    std::unordered_set<GraphicsAllocation *> readAllocations;
+    std::unordered_set<GraphicsAllocation *> writtenAllocations;
+};
 } // namespace OCLRT
@@ -315,6 +315,7 @@ FlushStamp TbxCommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batchBuffer
 
         submitLRCA(engineType, contextDescriptor);
     }
+    tbxStream.flush();
 
     pollForCompletion(engineType);
     return 0;
@@ -369,7 +370,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::processResidency(ResidencyContainer
         if (!writeMemory(*gfxAllocation)) {
             DEBUG_BREAK_IF(!(gfxAllocation->getUnderlyingBufferSize() == 0));
         }
-        gfxAllocation->residencyTaskCount[this->deviceIndex] = this->taskCount + 1;
+        gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->deviceIndex);
     }
 }
 
@@ -68,6 +68,10 @@ void TbxStream::registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t de
     } while (matches == pollNotEqual && asyncMMIO);
 }
 
+void TbxStream::flush() {
+    socket->flush();
+}
+
 void TbxStream::readMemory(uint64_t physAddress, void *memory, size_t size) {
     socket->readMemory(physAddress, memory, size);
 }
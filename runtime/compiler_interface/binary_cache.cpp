@@ -14,12 +14,16 @@
 #include <runtime/helpers/hw_info.h>
 #include <runtime/os_interface/os_inc_base.h>
 #include <runtime/program/program.h>
+#include <runtime/utilities/mapped_file.h>
 
+#include <atomic>
+#include <cstdio>
 #include <cstring>
 #include <string>
 #include <sstream>
 #include <iomanip>
 #include <mutex>
+#include <random>
 
 namespace OCLRT {
 std::mutex BinaryCache::cacheAccessMtx;
@@ -60,37 +64,50 @@ bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBin
     hashFilePath.append(Os::fileSeparator);
     hashFilePath.append(kernelFileHash + ".cl_cache");
 
+    // cached files may be mapped by programs of this or other processes, so the file is never rewritten in place,
+    // complete binary is written to a file of unique name and renamed over the cached one
+    static const uint64_t processToken = (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+    static std::atomic<uint32_t> tempFilesCount{0};
+    std::stringstream tempFilePath;
+    tempFilePath << hashFilePath << "." << std::hex << processToken << "." << tempFilesCount++ << ".tmp";
+
     std::lock_guard<std::mutex> lock(cacheAccessMtx);
     if (writeDataToFile(
-            hashFilePath.c_str(),
+            tempFilePath.str().c_str(),
             pBinary,
             binarySize) == 0) {
+        std::remove(tempFilePath.str().c_str());
         return false;
     }
 
+    if (std::rename(tempFilePath.str().c_str(), hashFilePath.c_str()) != 0) {
+        // rename does not replace existing file on Windows, file that is still mapped cannot be removed there
+        if (std::remove(hashFilePath.c_str()) != 0 ||
+            std::rename(tempFilePath.str().c_str(), hashFilePath.c_str()) != 0) {
+            std::remove(tempFilePath.str().c_str());
+            return false;
+        }
+    }
+
     return true;
 }
 
 bool BinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
-    void *pBinary = nullptr;
-    size_t binarySize = 0;
-
     std::string hashFilePath = CL_CACHE_LOCATION;
     hashFilePath.append(Os::fileSeparator);
     hashFilePath.append(kernelFileHash + ".cl_cache");
 
+    std::unique_ptr<MappedFile> mappedBinary;
     {
         std::lock_guard<std::mutex> lock(cacheAccessMtx);
-        binarySize = loadDataFromFile(hashFilePath.c_str(), pBinary);
+        mappedBinary = MappedFile::open(hashFilePath.c_str());
     }
 
-    if ((pBinary == nullptr) || (binarySize == 0)) {
-        deleteDataReadFromFile(pBinary);
+    if (!mappedBinary) {
         return false;
     }
-    program.storeGenBinary(pBinary, binarySize);
-
-    deleteDataReadFromFile(pBinary);
+    // program takes the private mapping, pages are read in only when kernels are materialized
+    program.storeGenBinary(std::move(mappedBinary));
 
     return true;
 }
@@ -25,6 +25,7 @@
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/os_interface/os_time.h"
 #include "runtime/source_level_debugger/source_level_debugger.h"
+#include "runtime/utilities/timeline_tracer.h"
 #include <cstring>
 #include <map>
 
@@ -104,6 +105,9 @@ Device::~Device() {
 
         alignedFree(this->slmWindowStartAddress);
     }
+    if (osTime) {
+        TimelineTracer::clearTimeSource(osTime.get());
+    }
     executionEnvironment->decRefInternal();
 }
 
@@ -127,6 +131,9 @@ bool Device::createDeviceImpl(const HardwareInfo *pHwInfo, Device &outDevice) {
     if (!pDevice->osTime) {
         pDevice->osTime = OSTime::create(outDevice.commandStreamReceiver->getOSInterface());
     }
+    if (TimelineTracer::get()) {
+        TimelineTracer::setTimeSource(pDevice->osTime.get());
+    }
     pDevice->driverInfo.reset(DriverInfo::create(outDevice.commandStreamReceiver->getOSInterface()));
     pDevice->tagAddress = reinterpret_cast<uint32_t *>(outDevice.commandStreamReceiver->getTagAllocation()->getUnderlyingBuffer());
 
@@ -318,7 +318,7 @@ void DeviceQueueHw<GfxFamily>::setupIndirectState(IndirectHeap &surfaceStateHeap
         auto blockAllocation = pBlockInfo->getGraphicsAllocation();
         DEBUG_BREAK_IF(!blockAllocation);
 
-        auto gpuAddress = blockAllocation ? blockAllocation->getGpuAddressToPatch() : 0llu;
+        auto gpuAddress = blockAllocation ? blockAllocation->getGpuAddressToPatch() + pBlockInfo->kernelAllocationOffset : 0llu;
 
         auto bindingTableCount = pBlockInfo->patchInfo.bindingTableState->Count;
         maxBindingTableCount = std::max(maxBindingTableCount, bindingTableCount);
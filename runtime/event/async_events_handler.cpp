@@ -6,9 +6,11 @@
  */
 
 #include "runtime/event/async_events_handler.h"
+#include "runtime/command_queue/command_queue.h"
 #include "runtime/event/event.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/os_interface/os_thread.h"
+#include <algorithm>
 #include <iterator>
 
 namespace OCLRT {
@@ -33,28 +35,108 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+namespace {
+bool isEventPending(Event *event) {
+    return event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+}
+
+// Submitted events can only change state when their CSR's tag passes their task count,
+// so they can be kept ordered by task count instead of being polled on every pass
+bool isTrackedByTaskCount(Event *event) {
+    return (event->getCommandQueue() != nullptr) && !event->isExternallySynchronized() &&
+           (event->peekExecutionStatus() == CL_SUBMITTED) && (event->peekTaskCount() != Event::eventNotReady);
+}
+
+bool hasHigherTaskCount(const Event *left, const Event *right) {
+    return left->peekTaskCount() > right->peekTaskCount();
+}
+
+Event *selectSleepCandidate(Event *sleepCandidate, Event *event) {
+    if (event->peekTaskCount() == Event::eventNotReady) {
+        return sleepCandidate;
+    }
+    if (!sleepCandidate || (event->peekTaskCount() < sleepCandidate->peekTaskCount())) {
+        return event;
+    }
+    return sleepCandidate;
+}
+} // namespace
+
 Event *AsyncEventsHandler::processList() {
-    uint32_t lowestTaskCount = Event::eventNotReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
     for (auto event : list) {
         event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
-            }
-        } else {
+        if (!isEventPending(event)) {
             event->decRefInternal();
+        } else if (isTrackedByTaskCount(event)) {
+            pushToCompletionHeap(event);
+        } else {
+            pendingList.push_back(event);
+            sleepCandidate = selectSleepCandidate(sleepCandidate, event);
         }
     }
 
     list.swap(pendingList);
+    return processCompletionHeaps(sleepCandidate);
+}
+
+Event *AsyncEventsHandler::processCompletionHeaps(Event *sleepCandidate) {
+    for (auto heap = completionHeaps.begin(); heap != completionHeaps.end();) {
+        auto &events = heap->events;
+        uint32_t tag = events.empty() ? 0 : *heap->tagAddress;
+
+        while (!events.empty() && events.front()->peekTaskCount() <= tag) {
+            std::pop_heap(events.begin(), events.end(), hasHigherTaskCount);
+            auto event = events.back();
+            events.pop_back();
+
+            event->updateExecutionStatus();
+            if (isEventPending(event)) {
+                list.push_back(event);
+            } else {
+                event->decRefInternal();
+            }
+        }
+
+        // tag allocation of drained heap may be released together with its CSR
+        if (events.empty()) {
+            heap = completionHeaps.erase(heap);
+            continue;
+        }
+        sleepCandidate = selectSleepCandidate(sleepCandidate, events.front());
+        ++heap;
+    }
     return sleepCandidate;
 }
 
+void AsyncEventsHandler::pushToCompletionHeap(Event *event) {
+    auto tagAddress = event->getCommandQueue()->getHwTagAddress();
+    auto heap = std::find_if(completionHeaps.begin(), completionHeaps.end(), [tagAddress](const CompletionHeap &candidate) {
+        return candidate.tagAddress == tagAddress;
+    });
+    if (heap == completionHeaps.end()) {
+        completionHeaps.emplace_back();
+        heap = completionHeaps.end() - 1;
+        heap->tagAddress = tagAddress;
+    }
+    heap->events.push_back(event);
+    std::push_heap(heap->events.begin(), heap->events.end(), hasHigherTaskCount);
+}
+
+bool AsyncEventsHandler::hasEvents() const {
+    if (!list.empty()) {
+        return true;
+    }
+    for (auto &heap : completionHeaps) {
+        if (!heap.events.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -68,7 +150,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasEvents()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -111,6 +193,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &heap : completionHeaps) {
+        for (auto event : heap.events) {
+            event->decRefInternal();
+        }
+    }
+    completionHeaps.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace OCLRT
@@ -24,7 +24,15 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    struct CompletionHeap {
+        volatile uint32_t *tagAddress = nullptr;
+        std::vector<Event *> events; // min-heap on task count
+    };
+
     Event *processList();
+    Event *processCompletionHeaps(Event *sleepCandidate);
+    void pushToCompletionHeap(Event *event);
+    bool hasEvents() const;
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,6 +40,7 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<CompletionHeap> completionHeaps;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -13,7 +13,9 @@
 #include "runtime/device/device.h"
 #include "runtime/event/event.h"
 #include "runtime/event/event_tracker.h"
+#include "runtime/event/events_unblock_scheduler.h"
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/cl_helper.h"
 #include "runtime/helpers/get_info.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/timestamp_packet.h"
@@ -22,9 +24,12 @@
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/timeline_tracer.h"
 #include "runtime/platform/platform.h"
 #include "runtime/event/async_events_handler.h"
 
+#include <limits>
+
 namespace OCLRT {
 
 const cl_uint Event::eventNotReady = 0xFFFFFFF0;
@@ -293,6 +298,35 @@ bool Event::calcProfilingData() {
             completeTimeStamp = ((HwTimeStamps *)timeStampNode->tag)->ContextCompleteTS;
         }
 
+        dataCalculated = true;
+    } else if (!dataCalculated && profilingTimestampPacketPath && !profilingCpuPath &&
+               timestampPacketContainer && !timestampPacketContainer->peekNodes().empty()) {
+        double frequency = cmdQueue->getDevice().getDeviceInfo().profilingTimerResolution;
+        auto firstPacket = timestampPacketContainer->peekNodes().front()->tag;
+        auto lastPacket = timestampPacketContainer->peekNodes().back()->tag;
+
+        // packets hold low 32 bits of timestamps, global start is extended with high bits of preceding queue timestamp
+        uint64_t globalStart = (queueTimeStamp.GPUTimeStamp & ~static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())) |
+                               firstPacket->getData(TimestampPacket::DataIndex::GlobalStart);
+        if (globalStart < queueTimeStamp.GPUTimeStamp) {
+            globalStart += static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1;
+        }
+        uint32_t contextStart = firstPacket->getData(TimestampPacket::DataIndex::ContextStart);
+        uint32_t contextEnd = lastPacket->getData(TimestampPacket::DataIndex::ContextEnd);
+
+        c0 = queueTimeStamp.CPUTimeinNS - static_cast<uint64_t>(queueTimeStamp.GPUTimeStamp * frequency);
+        gpuDuration = static_cast<uint32_t>(contextEnd - contextStart);
+        cpuDuration = static_cast<uint64_t>(gpuDuration * frequency);
+        startTimeStamp = static_cast<uint64_t>(globalStart * frequency) + c0;
+        endTimeStamp = startTimeStamp + cpuDuration;
+        completeTimeStamp = endTimeStamp;
+
+        if (DebugManager.flags.ReturnRawGpuTimestamps.get()) {
+            startTimeStamp = contextStart;
+            endTimeStamp = contextEnd;
+            completeTimeStamp = contextEnd;
+        }
+
         dataCalculated = true;
     }
     return dataCalculated;
@@ -344,6 +378,7 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp()))) {
         transitionExecutionStatus(CL_COMPLETE);
+        traceGpuExecution();
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getDevice().getCommandStreamReceiver().getInternalAllocationStorage();
@@ -354,6 +389,16 @@ void Event::updateExecutionStatus() {
     transitionExecutionStatus(CL_SUBMITTED);
 }
 
+void Event::traceGpuExecution() {
+    auto timelineTracer = TimelineTracer::get();
+    if (timelineTracer == nullptr || !isProfilingEnabled() || profilingCpuPath || DebugManager.flags.ReturnRawGpuTimestamps.get()) {
+        return;
+    }
+    if (calcProfilingData()) {
+        timelineTracer->recordGpuSpan(cmdTypetoString(cmdType).c_str(), startTimeStamp, endTimeStamp, taskCount);
+    }
+}
+
 void Event::addChild(Event &childEvent) {
     childEvent.parentCount++;
     childEvent.incRefInternal();
@@ -386,21 +431,20 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 
     auto childEventRef = childEventsToNotify.detachNodes();
-    while (childEventRef != nullptr) {
-        auto childEvent = childEventRef->ref;
-
-        childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
-
-        if (childEvent->getCommandQueue() && childEvent->isCurrentCmdQVirtualEvent()) {
-            // Check virtual event state and delete it if possible.
-            childEvent->getCommandQueue()->isQueueBlocked();
-        }
+    if (childEventRef == nullptr) {
+        return;
+    }
 
-        childEvent->decRefInternal();
-        auto next = childEventRef->next;
-        delete childEventRef;
-        childEventRef = next;
+    // children unblocked while other notifications are processed are queued up instead of being notified recursively
+    auto activeScheduler = EventsUnblockScheduler::getActiveScheduler();
+    if (activeScheduler != nullptr) {
+        activeScheduler->scheduleChildren(*this, childEventRef, taskLevelToPropagate, transitionStatus);
+        return;
     }
+
+    EventsUnblockScheduler unblockScheduler;
+    unblockScheduler.scheduleChildren(*this, childEventRef, taskLevelToPropagate, transitionStatus);
+    unblockScheduler.run();
 }
 
 bool Event::setStatus(cl_int status) {
@@ -98,6 +98,10 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     bool isCPUProfilingPath() {
         return profilingCpuPath;
     }
+    void setTimestampPacketProfilingPath(bool isTimestampPacketPath) { this->profilingTimestampPacketPath = isTimestampPacketPath; }
+    bool isTimestampPacketProfilingPath() const {
+        return profilingTimestampPacketPath;
+    }
 
     cl_int getEventProfilingInfo(cl_profiling_info paramName,
                                  size_t paramValueSize,
@@ -330,6 +334,9 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     // guarantees that newStatus <= oldStatus
     void transitionExecutionStatus(int32_t newExecutionStatus) const;
 
+    // records gpu execution of completed profiled event in timeline trace
+    void traceGpuExecution();
+
     //vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
@@ -354,6 +361,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     // Timestamps
     bool profilingEnabled;
     bool profilingCpuPath;
+    bool profilingTimestampPacketPath = false;
     bool dataCalculated;
     TimeStampData queueTimeStamp;
     TimeStampData submitTimeStamp;
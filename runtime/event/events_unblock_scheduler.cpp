@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/events_unblock_scheduler.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/event/event.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+namespace OCLRT {
+namespace {
+thread_local EventsUnblockScheduler *activeScheduler = nullptr;
+}
+
+EventsUnblockScheduler::EventsUnblockScheduler() {
+    DEBUG_BREAK_IF(activeScheduler != nullptr);
+    activeScheduler = this;
+}
+
+EventsUnblockScheduler::~EventsUnblockScheduler() {
+    run();
+    activeScheduler = nullptr;
+}
+
+EventsUnblockScheduler *EventsUnblockScheduler::getActiveScheduler() {
+    return activeScheduler;
+}
+
+void EventsUnblockScheduler::scheduleChildren(Event &parent, IFNodeRef<Event> *children, uint32_t taskLevel, int32_t transitionStatus) {
+    if (children == nullptr) {
+        return;
+    }
+    pendingNotifications.push_back({&parent, children, taskLevel, transitionStatus});
+}
+
+void EventsUnblockScheduler::run() {
+    while (!pendingNotifications.empty()) {
+        currentLevel.swap(pendingNotifications);
+        for (auto &notification : currentLevel) {
+            notifyChildren(notification);
+        }
+        currentLevel.clear();
+        closeLevel();
+        levelsCount++;
+    }
+}
+
+void EventsUnblockScheduler::notifyChildren(const Notification &notification) {
+    auto childEventRef = notification.children;
+    while (childEventRef != nullptr) {
+        auto childEvent = childEventRef->ref;
+
+        // parent may be already destroyed at this point, it is passed for logging purposes only
+        childEvent->unblockEventBy(*notification.parent, notification.taskLevel, notification.transitionStatus);
+
+        if (childEvent->getCommandQueue() && childEvent->isCurrentCmdQVirtualEvent()) {
+            // Check virtual event state and delete it if possible.
+            childEvent->getCommandQueue()->isQueueBlocked();
+        }
+
+        // reference is released when level is closed
+        unblockedEvents.push_back(childEvent);
+        auto next = childEventRef->next;
+        delete childEventRef;
+        childEventRef = next;
+    }
+}
+
+void EventsUnblockScheduler::closeLevel() {
+    for (auto &csrSubmissions : submissions) {
+        auto &csr = *csrSubmissions.csr;
+        {
+            auto lock = csr.obtainUniqueOwnership();
+            csr.flushBatchedSubmissions();
+            if (csrSubmissions.dispatchModeOverridden) {
+                csr.overrideDispatchPolicy(csrSubmissions.previousDispatchMode);
+            }
+        }
+        if (csrSubmissions.cmdQ != nullptr) {
+            csrSubmissions.cmdQ->waitUntilComplete(csrSubmissions.taskCount, csr.obtainCurrentFlushStamp(), false);
+        }
+    }
+    submissions.clear();
+
+    for (auto event : unblockedEvents) {
+        // submitted commands are completed now, transition state to not block others
+        if (event->peekExecutionStatus() == CL_SUBMITTED) {
+            event->updateExecutionStatus();
+        }
+        event->decRefInternal();
+    }
+    unblockedEvents.clear();
+}
+
+void EventsUnblockScheduler::prepareSubmission(CommandStreamReceiver &csr) {
+    auto &csrSubmissions = obtainCsrSubmissions(csr);
+    if (!csrSubmissions.dispatchModeOverridden && DebugManager.flags.AggregateUnblockedCommandsSubmission.get()) {
+        csrSubmissions.previousDispatchMode = csr.peekDispatchMode();
+        if (csrSubmissions.previousDispatchMode != DispatchMode::BatchedDispatch) {
+            csr.overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+            csrSubmissions.dispatchModeOverridden = true;
+        }
+    }
+}
+
+void EventsUnblockScheduler::registerSubmission(CommandQueue &cmdQ, CommandStreamReceiver &csr, uint32_t taskCount) {
+    auto &csrSubmissions = obtainCsrSubmissions(csr);
+    if ((csrSubmissions.cmdQ == nullptr) || (taskCount > csrSubmissions.taskCount)) {
+        csrSubmissions.cmdQ = &cmdQ;
+        csrSubmissions.taskCount = taskCount;
+    }
+}
+
+EventsUnblockScheduler::CsrSubmissions &EventsUnblockScheduler::obtainCsrSubmissions(CommandStreamReceiver &csr) {
+    for (auto &csrSubmissions : submissions) {
+        if (csrSubmissions.csr == &csr) {
+            return csrSubmissions;
+        }
+    }
+    submissions.push_back({&csr, nullptr, 0, DispatchMode::DeviceDefault, false});
+    return submissions.back();
+}
+} // namespace OCLRT
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/iflist.h"
+#include <cstdint>
+#include <vector>
+
+namespace OCLRT {
+class CommandQueue;
+class CommandStreamReceiver;
+class Event;
+enum class DispatchMode;
+
+// Notifies child events about status transitions of their parents level by level, without recursion.
+// Kernels unblocked within one level are submitted without waiting for each of them separately,
+// the level is closed with one flush and one wait per CSR before the next level is unblocked.
+class EventsUnblockScheduler {
+  public:
+    EventsUnblockScheduler();
+    ~EventsUnblockScheduler();
+
+    EventsUnblockScheduler(const EventsUnblockScheduler &) = delete;
+    EventsUnblockScheduler &operator=(const EventsUnblockScheduler &) = delete;
+
+    // scheduler which is running on calling thread, nullptr if none
+    static EventsUnblockScheduler *getActiveScheduler();
+
+    // takes ownership of detached list of child events
+    void scheduleChildren(Event &parent, IFNodeRef<Event> *children, uint32_t taskLevel, int32_t transitionStatus);
+    void run();
+
+    // called under CSR ownership, before the unblocked command is flushed
+    void prepareSubmission(CommandStreamReceiver &csr);
+    // completion of taskCount will be awaited when current level is closed
+    void registerSubmission(CommandQueue &cmdQ, CommandStreamReceiver &csr, uint32_t taskCount);
+
+    uint32_t peekLevelsCount() const {
+        return levelsCount;
+    }
+
+  protected:
+    struct Notification {
+        Event *parent;
+        IFNodeRef<Event> *children;
+        uint32_t taskLevel;
+        int32_t transitionStatus;
+    };
+
+    struct CsrSubmissions {
+        CommandStreamReceiver *csr;
+        CommandQueue *cmdQ;
+        uint32_t taskCount;
+        DispatchMode previousDispatchMode;
+        bool dispatchModeOverridden;
+    };
+
+    void notifyChildren(const Notification &notification);
+    void closeLevel();
+    CsrSubmissions &obtainCsrSubmissions(CommandStreamReceiver &csr);
+
+    std::vector<Notification> pendingNotifications;
+    std::vector<Notification> currentLevel;
+    std::vector<Event *> unblockedEvents;
+    std::vector<CsrSubmissions> submissions;
+    uint32_t levelsCount = 0;
+};
+} // namespace OCLRT
@@ -20,7 +20,12 @@
 
 namespace OCLRT {
 ExecutionEnvironment::ExecutionEnvironment() = default;
-ExecutionEnvironment::~ExecutionEnvironment() = default;
+ExecutionEnvironment::~ExecutionEnvironment() {
+    if (memoryManager) {
+        // deferred deletions of allocations still in use are handed over to command stream receivers
+        memoryManager->waitForDeletions();
+    }
+}
 extern CommandStreamReceiver *createCommandStream(const HardwareInfo *pHwInfo, ExecutionEnvironment &executionEnvironment);
 
 void ExecutionEnvironment::initAubCenter(const HardwareInfo *pHwInfo, bool localMemoryEnabled) {
@@ -89,7 +89,7 @@ void KernelCommandsHelper<GfxFamily>::setKernelStartOffset(
     Kernel &kernel) {
 
     if (kernelAllocation) {
-        kernelStartOffset = kernelInfo.getGraphicsAllocation()->getGpuAddressToPatch();
+        kernelStartOffset = kernelInfo.getGraphicsAllocation()->getGpuAddressToPatch() + kernelInfo.kernelAllocationOffset;
     }
     kernelStartOffset += kernel.getStartOffset();
 }
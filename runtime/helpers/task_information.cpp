@@ -12,6 +12,7 @@
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
+#include "runtime/event/events_unblock_scheduler.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/string.h"
@@ -123,6 +124,13 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
 
     auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
 
+    // kernels unblocked together are flushed and awaited once per CSR by the unblock scheduler
+    auto unblockScheduler = EventsUnblockScheduler::getActiveScheduler();
+    bool deferCompletionWait = (unblockScheduler != nullptr) && !executionModelKernel && !printfHandler;
+    if (deferCompletionWait) {
+        unblockScheduler->prepareSubmission(commandStreamReceiver);
+    }
+
     if (executionModelKernel) {
         while (!devQueue->isEMCriticalSectionFree())
             ;
@@ -193,7 +201,7 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
     }
 
     DispatchFlags dispatchFlags;
-    dispatchFlags.blocking = true;
+    dispatchFlags.blocking = !deferCompletionWait;
     dispatchFlags.dcFlush = flushDC;
     dispatchFlags.useSLM = slmUsed;
     dispatchFlags.guardCommandBufferWithPipeControl = true;
@@ -219,7 +227,11 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
                                                       taskLevel,
                                                       dispatchFlags,
                                                       commandQueue.getDevice());
-    commandQueue.waitUntilComplete(completionStamp.taskCount, completionStamp.flushStamp, false);
+    if (deferCompletionWait) {
+        unblockScheduler->registerSubmission(commandQueue, commandStreamReceiver, completionStamp.taskCount);
+    } else {
+        commandQueue.waitUntilComplete(completionStamp.taskCount, completionStamp.flushStamp, false);
+    }
     if (printfHandler) {
         printfHandler.get()->printEnqueueOutput();
     }
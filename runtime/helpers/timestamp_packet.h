@@ -44,6 +44,10 @@ class TimestampPacket {
                implicitDependenciesCount.load() == 0;
     }
 
+    uint32_t getData(DataIndex operationType) const {
+        return data[static_cast<uint32_t>(operationType)];
+    }
+
     uint64_t pickAddressForDataWrite(DataIndex operationType) const {
         auto index = static_cast<uint32_t>(operationType);
         return reinterpret_cast<uint64_t>(&data[index]);
@@ -397,7 +397,7 @@ cl_int Kernel::cloneKernel(Kernel *pSourceKernel) {
 
     // copy additional information other than argument values set to source kernel with clSetKernelExecInfo
     for (auto gfxAlloc : pSourceKernel->kernelSvmGfxAllocations) {
-        kernelSvmGfxAllocations.push_back(gfxAlloc);
+        setKernelExecInfo(gfxAlloc);
     }
 
     this->isBuiltIn = pSourceKernel->isBuiltIn;
@@ -707,7 +707,13 @@ void Kernel::substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize)
     pKernelInfo->isKernelHeapSubstituted = true;
 
     auto currentAllocationSize = pKernelInfo->kernelAllocation->getUnderlyingBufferSize();
-    if (currentAllocationSize >= newKernelHeapSize) {
+    if (pKernelInfo->isKernelAllocationShared) {
+        // slot in the program's ISA pool cannot grow, substituted ISA gets its own allocation
+        pKernelInfo->kernelAllocation = nullptr;
+        pKernelInfo->kernelAllocationOffset = 0;
+        pKernelInfo->isKernelAllocationShared = false;
+        pKernelInfo->createKernelAllocation(device.getMemoryManager());
+    } else if (currentAllocationSize >= newKernelHeapSize) {
         memcpy_s(pKernelInfo->kernelAllocation->getUnderlyingBuffer(), newKernelHeapSize, newKernelHeap, newKernelHeapSize);
     } else {
         auto memoryManager = device.getMemoryManager();
@@ -896,6 +902,7 @@ void Kernel::storeKernelArg(uint32_t argIndex, kernelArgType argType, void *argO
     kernelArguments[argIndex].size = argSize;
     kernelArguments[argIndex].pSvmAlloc = argSvmAlloc;
     kernelArguments[argIndex].svmFlags = argSvmFlags;
+    argsResidencyCacheValid = false;
 }
 
 const void *Kernel::getKernelArg(uint32_t argIndex) const {
@@ -908,34 +915,57 @@ const Kernel::SimpleKernelArgInfo &Kernel::getKernelArgInfo(uint32_t argIndex) c
 
 void Kernel::setKernelExecInfo(GraphicsAllocation *argValue) {
     kernelSvmGfxAllocations.push_back(argValue);
+    argsResidencyCacheValid = false;
 }
 
 void Kernel::clearKernelExecInfo() {
     kernelSvmGfxAllocations.clear();
+    argsResidencyCacheValid = false;
 }
 
-inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceiver) {
+void Kernel::buildArgsResidencyCache() {
+    argsResidencyCache.clear();
+    argsRequireSamplerCacheFlush = false;
+
+    argsResidencyCache.insert(argsResidencyCache.end(), kernelSvmGfxAllocations.begin(), kernelSvmGfxAllocations.end());
 
     auto numArgs = kernelInfo.kernelArgInfo.size();
     for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
         if (kernelArguments[argIndex].object) {
             if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
                 auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
-                commandStreamReceiver.makeResident(*pSVMAlloc);
+                argsResidencyCache.push_back(pSVMAlloc);
             } else if (Kernel::isMemObj(kernelArguments[argIndex].type)) {
                 auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
                 auto memObj = castToObjectOrAbort<MemObj>(clMem);
                 DEBUG_BREAK_IF(memObj == nullptr);
                 if (memObj->isImageFromImage()) {
-                    commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+                    argsRequireSamplerCacheFlush = true;
                 }
-                commandStreamReceiver.makeResident(*memObj->getGraphicsAllocation());
+                argsResidencyCache.push_back(memObj->getGraphicsAllocation());
                 if (memObj->getMcsAllocation()) {
-                    commandStreamReceiver.makeResident(*memObj->getMcsAllocation());
+                    argsResidencyCache.push_back(memObj->getMcsAllocation());
                 }
             }
         }
     }
+
+    // shared objects may swap their allocations on acquire, so they are never cached
+    argsResidencyCacheValid = !usingSharedObjArgs;
+}
+
+inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceiver) {
+    if (!argsResidencyCacheValid) {
+        buildArgsResidencyCache();
+    }
+
+    if (argsRequireSamplerCacheFlush) {
+        commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+    }
+
+    for (auto gfxAlloc : argsResidencyCache) {
+        commandStreamReceiver.makeResident(*gfxAlloc);
+    }
 }
 
 void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
@@ -951,10 +981,6 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
         commandStreamReceiver.makeResident(*(program->getGlobalSurface()));
     }
 
-    for (auto gfxAlloc : kernelSvmGfxAllocations) {
-        commandStreamReceiver.makeResident(*gfxAlloc);
-    }
-
     makeArgsResident(commandStreamReceiver);
 
     auto kernelIsaAllocation = this->kernelInfo.kernelAllocation;
@@ -1010,6 +1036,64 @@ void Kernel::getResidency(std::vector<Surface *> &dst) {
     gtpinNotifyUpdateResidencyList(this, &dst);
 }
 
+bool Kernel::getSurfacesAccess(SurfacesAccess &surfacesAccess) const {
+    if (isParentKernel) {
+        return false;
+    }
+    auto &readAllocations = surfacesAccess.readAllocations;
+    auto &writtenAllocations = surfacesAccess.writtenAllocations;
+
+    if (privateSurface) {
+        writtenAllocations.push_back(privateSurface);
+    }
+    if (program->getConstantSurface()) {
+        readAllocations.push_back(program->getConstantSurface());
+    }
+    if (program->getGlobalSurface()) {
+        writtenAllocations.push_back(program->getGlobalSurface());
+    }
+    for (auto gfxAlloc : kernelSvmGfxAllocations) {
+        writtenAllocations.push_back(gfxAlloc);
+    }
+
+    auto numArgs = kernelInfo.kernelArgInfo.size();
+    for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
+        auto &argInfo = kernelInfo.kernelArgInfo[argIndex];
+        bool readOnlyArg = argInfo.accessQualifier == CL_KERNEL_ARG_ACCESS_READ_ONLY ||
+                           argInfo.addressQualifier == CL_KERNEL_ARG_ADDRESS_CONSTANT ||
+                           (argInfo.typeQualifier & CL_KERNEL_ARG_TYPE_CONST);
+
+        if (kernelArguments[argIndex].type == SVM_OBJ) {
+            auto svmAlloc = kernelArguments[argIndex].pSvmAlloc;
+            if (!svmAlloc) {
+                if (kernelArguments[argIndex].value) {
+                    return false;
+                }
+                continue;
+            }
+            readOnlyArg |= (kernelArguments[argIndex].svmFlags & CL_MEM_READ_ONLY) != 0;
+            (readOnlyArg ? readAllocations : writtenAllocations).push_back(svmAlloc);
+        } else if (kernelArguments[argIndex].object) {
+            if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
+                auto svmAlloc = reinterpret_cast<GraphicsAllocation *>(kernelArguments[argIndex].object);
+                (readOnlyArg ? readAllocations : writtenAllocations).push_back(svmAlloc);
+            } else if (Kernel::isMemObj(kernelArguments[argIndex].type)) {
+                auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
+                auto memObj = castToObjectOrAbort<MemObj>(clMem);
+                readOnlyArg |= (memObj->getFlags() & CL_MEM_READ_ONLY) != 0;
+                // read_pipe updates pipe indices, so pipe is always written regardless of qualifiers
+                readOnlyArg &= kernelArguments[argIndex].type != PIPE_OBJ;
+                (readOnlyArg ? readAllocations : writtenAllocations).push_back(memObj->getGraphicsAllocation());
+            }
+        }
+    }
+
+    if (kernelInfo.kernelAllocation) {
+        readAllocations.push_back(kernelInfo.kernelAllocation);
+    }
+    return true;
+}
+
 bool Kernel::requiresCoherency() {
     auto numArgs = kernelInfo.kernelArgInfo.size();
     for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
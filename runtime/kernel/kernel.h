@@ -20,6 +20,7 @@
 
 namespace OCLRT {
 struct CompletionStamp;
+struct SurfacesAccess;
 class Buffer;
 class GraphicsAllocation;
 class ImageTransformer;
@@ -281,7 +282,10 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     //residency for kernel surfaces
     MOCKABLE_VIRTUAL void makeResident(CommandStreamReceiver &commandStreamReceiver);
+    bool isArgsResidencyCacheValid() const { return argsResidencyCacheValid; }
     MOCKABLE_VIRTUAL void getResidency(std::vector<Surface *> &dst);
+    // returns false when kernel may access memory not known to the driver, e.g. SVM pointers without allocation
+    bool getSurfacesAccess(SurfacesAccess &surfacesAccess) const;
     bool requiresCoherency();
     void resetSharedObjectsPatchAddresses();
     bool isUsingSharedObjArgs() { return usingSharedObjArgs; }
@@ -443,6 +447,7 @@ class Kernel : public BaseObject<_cl_kernel> {
 
   protected:
     void makeArgsResident(CommandStreamReceiver &commandStreamReceiver);
+    void buildArgsResidencyCache();
 
     void *patchBufferOffset(const KernelArgInfo &argInfo, void *svmPtr, GraphicsAllocation *svmAlloc);
 
@@ -469,6 +474,11 @@ class Kernel : public BaseObject<_cl_kernel> {
     std::vector<KernelArgHandler> kernelArgHandlers;
     std::vector<GraphicsAllocation *> kernelSvmGfxAllocations;
 
+    // allocations of SVM exec info and kernel args, rebuilt only after args or exec info change
+    std::vector<GraphicsAllocation *> argsResidencyCache;
+    bool argsResidencyCacheValid = false;
+    bool argsRequireSamplerCacheFlush = false;
+
     size_t numberOfBindingTableStates;
     size_t localBindingTableOffset;
     std::unique_ptr<char[]> pSshLocal;
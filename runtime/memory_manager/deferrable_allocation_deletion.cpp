@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/deferrable_allocation_deletion.h"
+#include "runtime/memory_manager/memory_manager.h"
+
+namespace OCLRT {
+DeferrableAllocationDeletion::DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation) : memoryManager(memoryManager),
+                                                                                                                                   graphicsAllocation(&graphicsAllocation) {}
+
+bool DeferrableAllocationDeletion::apply() {
+    uint32_t contextIdInUse = 0;
+    if (memoryManager.isAllocationInUse(*graphicsAllocation, contextIdInUse)) {
+        return false;
+    }
+    memoryManager.freeGraphicsMemory(graphicsAllocation);
+    graphicsAllocation = nullptr;
+    return true;
+}
+
+DeferrableAllocationDeletion::~DeferrableAllocationDeletion() {
+    if (graphicsAllocation == nullptr) {
+        return;
+    }
+    uint32_t contextIdInUse = 0;
+    if (memoryManager.isAllocationInUse(*graphicsAllocation, contextIdInUse)) {
+        memoryManager.storeAllocationInUse(graphicsAllocation, contextIdInUse);
+    } else {
+        memoryManager.freeGraphicsMemory(graphicsAllocation);
+    }
+}
+} // namespace OCLRT
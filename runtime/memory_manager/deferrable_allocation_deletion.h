@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/deferrable_deletion.h"
+
+namespace OCLRT {
+class GraphicsAllocation;
+class MemoryManager;
+
+// Frees allocation once GPU completed its work on all contexts that used it.
+// If deleter is stopped earlier, allocation is stored in temporary allocations of a context still using it,
+// so deleter has to be stopped while command stream receivers exist.
+class DeferrableAllocationDeletion : public DeferrableDeletion {
+  public:
+    DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation);
+    ~DeferrableAllocationDeletion() override;
+    bool apply() override;
+
+    DeferrableAllocationDeletion(const DeferrableAllocationDeletion &) = delete;
+    DeferrableAllocationDeletion &operator=(const DeferrableAllocationDeletion &) = delete;
+
+  protected:
+    MemoryManager &memoryManager;
+    GraphicsAllocation *graphicsAllocation;
+};
+} // namespace OCLRT
@@ -13,7 +13,8 @@ class DeferrableDeletion : public IDNode<DeferrableDeletion> {
   public:
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
-    virtual void apply() = 0;
+    // returns false when resources are still in use, deletion is then retried later
+    virtual bool apply() = 0;
     virtual ~DeferrableDeletion() = default;
 };
 } // namespace OCLRT
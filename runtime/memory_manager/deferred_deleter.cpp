@@ -9,10 +9,18 @@
 #include "runtime/memory_manager/deferrable_deletion.h"
 #include "runtime/os_interface/os_thread.h"
 
+#include <chrono>
+
 namespace OCLRT {
+namespace {
+// GPU does not signal completion, deletions waiting for it are retried with this period
+const auto pendingDeletionsRetryPeriod = std::chrono::milliseconds(1);
+} // namespace
+
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
     elementsToRelease = 0;
+    elementsWaitingForGpu = 0;
 }
 
 void DeferredDeleter::stop() {
@@ -44,6 +52,10 @@ void DeferredDeleter::safeStop() {
 
 DeferredDeleter::~DeferredDeleter() {
     safeStop();
+    if (!pendingQueue.peekIsEmpty()) {
+        // deletions still waiting for GPU release their resources on their own
+        pendingQueue.deleteAll();
+    }
 }
 
 void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
@@ -75,8 +87,10 @@ void DeferredDeleter::ensureThread() {
     worker = Thread::create(run, reinterpret_cast<void *>(this));
 }
 
+// deletions waiting for GPU are not awaited, GPU work they depend on may not be flushed yet
 bool DeferredDeleter::areElementsReleased() {
-    return elementsToRelease == 0;
+    auto elementsCount = elementsToRelease.load();
+    return elementsCount <= elementsWaitingForGpu;
 }
 
 bool DeferredDeleter::shouldStop() {
@@ -89,7 +103,7 @@ void *DeferredDeleter::run(void *arg) {
     // Mark that working thread really started
     self->doWorkInBackground = true;
     do {
-        if (self->queue.peekIsEmpty()) {
+        if (self->queue.peekIsEmpty() && self->pendingQueue.peekIsEmpty()) {
             // Wait for signal that some items are ready to be deleted
             self->condition.wait(lock);
         }
@@ -97,6 +111,10 @@ void *DeferredDeleter::run(void *arg) {
         // Delete items placed into deferred delete queue
         self->clearQueue();
         lock.lock();
+        if (self->queue.peekIsEmpty() && !self->pendingQueue.peekIsEmpty() && self->doWorkInBackground) {
+            // Remaining items wait for GPU, retry them later unless new items are signaled earlier
+            self->condition.wait_for(lock, pendingDeletionsRetryPeriod);
+        }
         // Check whether working thread should be stopped
     } while (!self->shouldStop());
     lock.unlock();
@@ -106,19 +124,40 @@ void *DeferredDeleter::run(void *arg) {
 void DeferredDeleter::drain(bool blocking) {
     clearQueue();
     if (blocking) {
-        while (!areElementsReleased())
-            ;
+        while (!areElementsReleased()) {
+            if (!queue.peekIsEmpty()) {
+                clearQueue();
+            }
+        }
     }
 }
 
 void DeferredDeleter::clearQueue() {
-    std::unique_ptr<DeferrableDeletion> deletion(nullptr);
-    do {
-        deletion.reset(queue.removeFrontOne().release());
-        if (deletion) {
-            deletion->apply();
+    std::lock_guard<std::mutex> lock(deletionsMutex);
+    applyDeletions(queue, false);
+    applyDeletions(pendingQueue, true);
+}
+
+void DeferredDeleter::applyDeletions(IDList<DeferrableDeletion, true> &deletions, bool pending) {
+    IDList<DeferrableDeletion, false> pendingDeletions;
+    auto deletion = deletions.removeFrontOne();
+    while (deletion) {
+        if (deletion->apply()) {
+            // counter of waiting deletions is decremented first, so blocking drain never sees new deletions as waiting
+            if (pending) {
+                elementsWaitingForGpu--;
+            }
             elementsToRelease--;
+        } else {
+            if (!pending) {
+                elementsWaitingForGpu++;
+            }
+            pendingDeletions.pushTailOne(*deletion.release());
         }
-    } while (deletion);
+        deletion = deletions.removeFrontOne();
+    }
+    if (!pendingDeletions.peekIsEmpty()) {
+        pendingQueue.splice(*pendingDeletions.detachNodes());
+    }
 }
 } // namespace OCLRT
@@ -36,6 +36,7 @@ class DeferredDeleter {
     void safeStop();
     void ensureThread();
     MOCKABLE_VIRTUAL void clearQueue();
+    void applyDeletions(IDList<DeferrableDeletion, true> &deletions, bool pending);
     MOCKABLE_VIRTUAL bool areElementsReleased();
     MOCKABLE_VIRTUAL bool shouldStop();
 
@@ -43,10 +44,15 @@ class DeferredDeleter {
 
     std::atomic<bool> doWorkInBackground;
     std::atomic<int> elementsToRelease;
+    std::atomic<int> elementsWaitingForGpu;
     std::unique_ptr<Thread> worker;
     int32_t numClients = 0;
     IDList<DeferrableDeletion, true> queue;
+    // deletions that could not be applied because GPU still uses their resources, blocking drain does not wait for them
+    IDList<DeferrableDeletion, true> pendingQueue;
     std::mutex queueMutex;
+    // serializes processing of deletions, so all deletions applicable at drain(false) call are applied when it returns
+    std::mutex deletionsMutex;
     std::mutex threadMutex;
     std::condition_variable condition;
 };
@@ -19,40 +19,66 @@ bool GraphicsAllocation::isL3Capable() {
 GraphicsAllocation::GraphicsAllocation(void *cpuPtrIn, uint64_t gpuAddress, uint64_t baseAddress, size_t sizeIn) : gpuBaseAddress(baseAddress),
                                                                                                                    size(sizeIn),
                                                                                                                    cpuPtr(cpuPtrIn),
-                                                                                                                   gpuAddress(gpuAddress),
-                                                                                                                   taskCounts(maxOsContextCount) {
-    initTaskCounts();
+                                                                                                                   gpuAddress(gpuAddress) {
 }
 
 GraphicsAllocation::GraphicsAllocation(void *cpuPtrIn, size_t sizeIn, osHandle sharedHandleIn) : size(sizeIn),
                                                                                                  cpuPtr(cpuPtrIn),
                                                                                                  gpuAddress(castToUint64(cpuPtrIn)),
-                                                                                                 sharedHandle(sharedHandleIn),
-                                                                                                 taskCounts(maxOsContextCount) {
-    initTaskCounts();
+                                                                                                 sharedHandle(sharedHandleIn) {
 }
 GraphicsAllocation::~GraphicsAllocation() = default;
 
 bool GraphicsAllocation::peekWasUsed() const { return registeredContextsNum > 0; }
 
 void GraphicsAllocation::updateTaskCount(uint32_t newTaskCount, uint32_t contextId) {
-    UNRECOVERABLE_IF(contextId >= taskCounts.size());
-    if (taskCounts[contextId] == ObjectNotUsed) {
+    auto &usageInfo = getUsageInfo(contextId);
+    if (usageInfo.taskCount == ObjectNotUsed) {
         registeredContextsNum++;
     }
     if (newTaskCount == ObjectNotUsed) {
         registeredContextsNum--;
     }
-    taskCounts[contextId] = newTaskCount;
+    usageInfo.taskCount = newTaskCount;
 }
 
 uint32_t GraphicsAllocation::getTaskCount(uint32_t contextId) const {
-    UNRECOVERABLE_IF(contextId >= taskCounts.size());
-    return taskCounts[contextId];
+    auto usageInfo = findUsageInfo(contextId);
+    return usageInfo ? usageInfo->taskCount.load() : ObjectNotUsed;
 }
-void GraphicsAllocation::initTaskCounts() {
-    for (auto i = 0u; i < taskCounts.size(); i++) {
-        taskCounts[i] = ObjectNotUsed;
+
+void GraphicsAllocation::updateResidencyTaskCount(int newResidencyTaskCount, uint32_t contextId) {
+    getUsageInfo(contextId).residencyTaskCount = newResidencyTaskCount;
+}
+
+int GraphicsAllocation::getResidencyTaskCount(uint32_t contextId) const {
+    auto usageInfo = findUsageInfo(contextId);
+    return usageInfo ? usageInfo->residencyTaskCount.load() : ObjectNotResident;
+}
+
+GraphicsAllocation::UsageInfo &GraphicsAllocation::getUsageInfo(uint32_t contextId) {
+    auto chunk = &usageInfos;
+    for (auto chunkIndex = contextId / usageInfosPerChunk; chunkIndex > 0; chunkIndex--) {
+        auto next = chunk->next.load();
+        if (next == nullptr) {
+            // chunk may be added by other context at the same time, only one of them is linked
+            auto newChunk = new UsageInfoChunk;
+            if (chunk->next.compare_exchange_strong(next, newChunk)) {
+                next = newChunk;
+            } else {
+                delete newChunk;
+            }
+        }
+        chunk = next;
+    }
+    return chunk->usageInfos[contextId % usageInfosPerChunk];
+}
+
+const GraphicsAllocation::UsageInfo *GraphicsAllocation::findUsageInfo(uint32_t contextId) const {
+    auto chunk = &usageInfos;
+    for (auto chunkIndex = contextId / usageInfosPerChunk; chunkIndex > 0 && chunk; chunkIndex--) {
+        chunk = chunk->next.load();
     }
+    return chunk ? &chunk->usageInfos[contextId % usageInfosPerChunk] : nullptr;
 }
 } // namespace OCLRT
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -28,7 +29,6 @@ namespace Sharing {
 constexpr auto nonSharedResource = 0u;
 }
 
-constexpr uint32_t maxOsContextCount = 4u;
 const int ObjectNotResident = -1;
 const uint32_t ObjectNotUsed = (uint32_t)-1;
 
@@ -41,7 +41,6 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     uint64_t gpuBaseAddress = 0;
     Gmm *gmm = nullptr;
     uint64_t allocationOffset = 0u;
-    int residencyTaskCount[maxOsContextCount] = {ObjectNotResident, ObjectNotResident, ObjectNotResident, ObjectNotResident};
     void *driverAllocatedCpuPointer = nullptr;
     DevicesBitfield devicesBitfield = 0;
     bool flushL3Required = false;
@@ -113,7 +112,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void setEvictable(bool evictable) { this->evictable = evictable; }
     bool peekEvictable() const { return evictable; }
 
-    bool isResident(uint32_t contextId) const { return residencyTaskCount[contextId] != ObjectNotResident; }
+    bool isResident(uint32_t contextId) const { return getResidencyTaskCount(contextId) != ObjectNotResident; }
     void setLocked(bool locked) { this->locked = locked; }
     bool isLocked() const { return locked; }
 
@@ -126,9 +125,25 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool peekWasUsed() const;
     void updateTaskCount(uint32_t newTaskCount, uint32_t contextId);
     uint32_t getTaskCount(uint32_t contextId) const;
+    void updateResidencyTaskCount(int newResidencyTaskCount, uint32_t contextId);
+    int getResidencyTaskCount(uint32_t contextId) const;
 
   protected:
-    void initTaskCounts();
+    struct UsageInfo {
+        std::atomic<uint32_t> taskCount{ObjectNotUsed};
+        std::atomic<int> residencyTaskCount{ObjectNotResident};
+    };
+    static const uint32_t usageInfosPerChunk = 4;
+    // chunks are linked without locking and never move, so CSRs of other contexts may update or read their
+    // usage infos while a new chunk is added
+    struct UsageInfoChunk {
+        ~UsageInfoChunk() { delete next.load(); }
+        UsageInfo usageInfos[usageInfosPerChunk];
+        std::atomic<UsageInfoChunk *> next{nullptr};
+    };
+
+    UsageInfo &getUsageInfo(uint32_t contextId);
+    const UsageInfo *findUsageInfo(uint32_t contextId) const;
 
     //this variable can only be modified from SubmissionAggregator
     friend class SubmissionAggregator;
@@ -146,7 +161,9 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool aubWritable = true;
     bool allocDumpable = false;
     bool memObjectsAllocationWithWritableFlags = false;
-    StackVec<uint32_t, maxOsContextCount> taskCounts;
+    // first chunk is kept inside allocation, next ones are added on first update from a context,
+    // contexts that never used the allocation read default values
+    UsageInfoChunk usageInfos;
     std::atomic<uint32_t> registeredContextsNum{0};
 };
 } // namespace OCLRT
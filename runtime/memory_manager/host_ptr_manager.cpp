@@ -6,6 +6,7 @@
  */
 
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/memory_manager/deferred_deleter.h"
 #include "runtime/memory_manager/host_ptr_manager.h"
 #include "runtime/memory_manager/internal_allocation_storage.h"
 #include "runtime/memory_manager/memory_manager.h"
@@ -249,11 +250,21 @@ FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(const void *inPt
 }
 
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    std::unique_lock<decltype(allocationsMutex)> lock(allocationsMutex);
     auto requirements = HostPtrManager::getAllocationRequirements(ptr, size);
 
     CheckedFragments checkedFragments;
-    UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements, &checkedFragments) == RequirementsStatus::FATAL);
+    auto status = checkAllocationsForOverlapping(memoryManager, &requirements, &checkedFragments);
+    auto deferredDeleter = memoryManager.getDeferredDeleter();
+    if (status == RequirementsStatus::FATAL && deferredDeleter) {
+        // GPU has completed, so overlapping allocation released while in use can be freed from deleter pending queue,
+        // lock is released as deleter frees allocations under its own lock
+        lock.unlock();
+        deferredDeleter->drain(false);
+        lock.lock();
+        status = checkAllocationsForOverlapping(memoryManager, &requirements, &checkedFragments);
+    }
+    UNRECOVERABLE_IF(status == RequirementsStatus::FATAL);
 
     auto osStorage = populateAlreadyAllocatedFragments(requirements, &checkedFragments);
     if (osStorage.fragmentCount > 0) {
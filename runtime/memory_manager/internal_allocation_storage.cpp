@@ -10,9 +10,9 @@
 #include "runtime/memory_manager/memory_manager.h"
 
 namespace OCLRT {
-InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver), contextId(commandStreamReceiver.getDeviceIndex()){};
+InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver){};
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
-    uint32_t taskCount = gfxAllocation->getTaskCount(contextId);
+    uint32_t taskCount = gfxAllocation->getTaskCount(getContextId());
 
     if (allocationUsage == REUSABLE_ALLOCATION) {
         taskCount = commandStreamReceiver.peekTaskCount();
@@ -28,7 +28,7 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
         }
     }
     auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
-    gfxAllocation->updateTaskCount(taskCount, contextId);
+    gfxAllocation->updateTaskCount(taskCount, getContextId());
     allocationsList.pushTailOne(*gfxAllocation.release());
 }
 
@@ -38,6 +38,7 @@ void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint
 
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
     auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto contextId = getContextId();
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
     IDList<GraphicsAllocation, false, true> allocationsLeft;
@@ -56,6 +57,11 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
     }
 }
 
+uint32_t InternalAllocationStorage::getContextId() const {
+    // device index of command stream receiver is assigned after it is created
+    return commandStreamReceiver.getDeviceIndex();
+}
+
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, bool internalAllocation) {
     auto allocation = allocationsForReuse.detachAllocation(requiredSize, commandStreamReceiver, internalAllocation);
     return allocation;
@@ -26,8 +26,8 @@ class InternalAllocationStorage {
 
   protected:
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    uint32_t getContextId() const;
     CommandStreamReceiver &commandStreamReceiver;
-    const uint32_t contextId;
 
     AllocationsList temporaryAllocations;
     AllocationsList allocationsForReuse;
@@ -23,6 +23,7 @@ static const size_t minBufferAlignment = 4;
 static const size_t cacheLineSize = 64;
 static const size_t pageSize = 4 * kiloByte;
 static const size_t pageSize64k = 64 * kiloByte;
+static const size_t pageSize2Mb = 2 * megaByte;
 static const size_t preferredAlignment = pageSize;  // alignment preferred for performance reasons, i.e. internal allocations
 static const size_t allocationAlignment = pageSize; // alignment required to gratify incoming pointer, i.e. passed host_ptr
 static const size_t slmWindowAlignment = 128 * kiloByte;
@@ -15,6 +15,7 @@
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/options.h"
 #include "runtime/helpers/timestamp_packet.h"
+#include "runtime/memory_manager/deferrable_allocation_deletion.h"
 #include "runtime/memory_manager/deferred_deleter.h"
 #include "runtime/memory_manager/host_ptr_manager.h"
 #include "runtime/memory_manager/internal_allocation_storage.h"
@@ -165,15 +166,38 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
     freeGraphicsMemoryImpl(gfxAllocation);
 }
 //if not in use destroy in place
-//if in use pass to temporary allocation list that is cleaned on blocking calls
+//if in use pass to deferred deleter that frees it once GPU completes
+//without deleter pass to temporary allocation list that is cleaned on blocking calls
 void MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation) {
-    if (!gfxAllocation->peekWasUsed() || gfxAllocation->getTaskCount(0u) <= *getCommandStreamReceiver(0)->getTagAddress()) {
+    uint32_t contextIdInUse = 0;
+    if (!isAllocationInUse(*gfxAllocation, contextIdInUse)) {
         freeGraphicsMemory(gfxAllocation);
+    } else if (deferredDeleter) {
+        deferredDeleter->deferDeletion(new DeferrableAllocationDeletion(*this, *gfxAllocation));
     } else {
-        getCommandStreamReceiver(0)->getInternalAllocationStorage()->storeAllocation(std::unique_ptr<GraphicsAllocation>(gfxAllocation), TEMPORARY_ALLOCATION);
+        storeAllocationInUse(gfxAllocation, contextIdInUse);
     }
 }
 
+bool MemoryManager::isAllocationInUse(GraphicsAllocation &gfxAllocation, uint32_t &contextIdInUse) {
+    if (!gfxAllocation.peekWasUsed()) {
+        return false;
+    }
+    auto &commandStreamReceivers = executionEnvironment.commandStreamReceivers;
+    for (uint32_t contextId = 0; contextId < commandStreamReceivers.size(); contextId++) {
+        auto taskCount = gfxAllocation.getTaskCount(contextId);
+        if (commandStreamReceivers[contextId] && taskCount != ObjectNotUsed && taskCount > *commandStreamReceivers[contextId]->getTagAddress()) {
+            contextIdInUse = contextId;
+            return true;
+        }
+    }
+    return false;
+}
+
+void MemoryManager::storeAllocationInUse(GraphicsAllocation *gfxAllocation, uint32_t contextIdInUse) {
+    getCommandStreamReceiver(contextIdInUse)->getInternalAllocationStorage()->storeAllocation(std::unique_ptr<GraphicsAllocation>(gfxAllocation), TEMPORARY_ALLOCATION);
+}
+
 void MemoryManager::waitForDeletions() {
     if (deferredDeleter) {
         deferredDeleter->drain(false);
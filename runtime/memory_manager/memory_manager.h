@@ -198,6 +198,10 @@ class MemoryManager {
 
     void checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation);
 
+    // checks task counts of allocation against tags of all command stream receivers
+    bool isAllocationInUse(GraphicsAllocation &gfxAllocation, uint32_t &contextIdInUse);
+    void storeAllocationInUse(GraphicsAllocation *gfxAllocation, uint32_t contextIdInUse);
+
     virtual uint64_t getSystemSharedMemory() = 0;
 
     virtual uint64_t getMaxApplicationAddress() = 0;
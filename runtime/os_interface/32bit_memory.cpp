@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/32bit_memory.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+namespace OCLRT {
+
+void Allocator32bit::createHeapAllocator(uint64_t heapBase, uint64_t heapSize) {
+    if (DebugManager.flags.UseSegregatedHeapAllocator.get()) {
+        segregatedHeapAllocator = std::unique_ptr<SegregatedHeapAllocator>(new SegregatedHeapAllocator(heapBase, heapSize));
+    } else {
+        heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(heapBase, heapSize));
+    }
+}
+
+uint64_t Allocator32bit::allocateFromHeap(size_t &size) {
+    if (segregatedHeapAllocator) {
+        return segregatedHeapAllocator->allocate(size);
+    }
+    return heapAllocator->allocate(size);
+}
+
+void Allocator32bit::freeToHeap(uint64_t ptr, size_t size) {
+    if (segregatedHeapAllocator) {
+        segregatedHeapAllocator->free(ptr, size);
+    } else {
+        heapAllocator->free(ptr, size);
+    }
+}
+} // namespace OCLRT
@@ -22,6 +22,7 @@
 
 #pragma once
 #include "runtime/utilities/heap_allocator.h"
+#include "runtime/utilities/segregated_heap_allocator.h"
 #include <stdint.h>
 #include <memory>
 
@@ -43,8 +44,13 @@ class Allocator32bit {
     int free(uint64_t ptr, size_t size);
 
   protected:
+    void createHeapAllocator(uint64_t heapBase, uint64_t heapSize);
+    uint64_t allocateFromHeap(size_t &size);
+    void freeToHeap(uint64_t ptr, size_t size);
+
     std::unique_ptr<OsInternals> osInternals;
     std::unique_ptr<HeapAllocator> heapAllocator;
+    std::unique_ptr<SegregatedHeapAllocator> segregatedHeapAllocator;
     uint64_t base = 0;
     uint64_t size = 0;
 };
@@ -23,9 +23,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio o
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAddMmioRegister, 0, "Program mmio offset that is not on default mmio list wtih value AubDumpAddMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAddMmioRegisterValue, 0, "Value to add new mmio offset from AubDumpAddMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAsyncWriteBufferSize, 0, "Size in bytes of staging buffers used by background AUB file writer, 0 - write synchronously")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpCompressionBlockSize, 0, "Size in bytes of blocks compressed in background when writing AUB file, 0 - write uncompressed AUB file")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpCompressionCodec, 1, "Codec used for compressed AUB file: 1 - LZ4 block format")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, 0, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxBatchBufferSize, 0, "Size in bytes of buffer batching TBX requests until a response is awaited or submission ends, 0 - send every request immediately")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedPages, false, "Skip dumping pages whose contents did not change since they were last written to AUB file")
 DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump comments containing allocations and patching information")
 DECLARE_DEBUG_VARIABLE(bool, UseMallocToObtainHeap32Base, false, "Instead of using dedicated ranges, use pointer from malloc as heap base.")
 DECLARE_DEBUG_VARIABLE(bool, UseAubStream, false, "Use aub_stream for aub dumping")
@@ -43,6 +48,11 @@ DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "when set to true
 DECLARE_DEBUG_VARIABLE(bool, ForceDispatchScheduler, false, "dispatches scheduler kernel instead of kernel enqueued")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "events track their parents")
 DECLARE_DEBUG_VARIABLE(bool, RebuildPrecompiledKernels, false, "forces driver to recompile precompiled kernels from sources")
+DECLARE_DEBUG_VARIABLE(bool, EnableKernelIsaPool, true, "ISA of kernels from programs with more than one kernel is packed into shared allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, LazyKernelMaterializationThreshold, 64, "programs with at least this many kernels parse patch tokens and upload ISA on first use of a kernel, -1: always at build time")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelKernelParsingThreshold, 16, "programs with at least this many kernels parse patch tokens on program build worker threads, -1: never")
+DECLARE_DEBUG_VARIABLE(int32_t, ProgramBuildWorkersCount, -1, "number of program build worker threads, -1: number of hardware threads")
+DECLARE_DEBUG_VARIABLE(bool, EnableAsyncProgramBuild, true, "clBuildProgram with pfn_notify returns before build completes and calls pfn_notify from a build worker thread")
 DECLARE_DEBUG_VARIABLE(bool, LoopAtPlatformInitialize, false, "Adds endless loop in platform initalize, useful for debugging.")
 DECLARE_DEBUG_VARIABLE(bool, DoNotRegisterTrimCallback, false, "When set to true driver is not registering trim callback.")
 /*LOGGING FLAGS*/
@@ -57,10 +67,14 @@ DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, s
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, 0, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, 0, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
+DECLARE_DEBUG_VARIABLE(bool, EnableTimelineTrace, false, "Streams api calls, csr flushes and gpu execution of profiled events to a Chrome trace JSON file")
+DECLARE_DEBUG_VARIABLE(std::string, TimelineTraceFileName, std::string("timeline_trace.json"), "Name of file to save timeline trace into")
 DECLARE_DEBUG_VARIABLE(bool, PrintEMDebugInformation, false, "prints execution model related debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver choosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch paramters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
+DECLARE_DEBUG_VARIABLE(bool, PrintScratchSpaceStats, false, "prints scratch space size, reallocations and MEDIA_VFE_STATE reprograms per second of each command stream receiver at its destruction")
+DECLARE_DEBUG_VARIABLE(bool, PrintFlushTaskStats, false, "prints state commands, dependency pipe controls and command stream bytes programmed by each flushTask")
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "works on Windows only, sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing")
 DECLARE_DEBUG_VARIABLE(bool, ForceLinearImages, false, "Force linear images. Default is Y-tiled.")
@@ -68,12 +82,16 @@ DECLARE_DEBUG_VARIABLE(bool, ForceSLML3Config, false, "Forces L3Config with SLM
 DECLARE_DEBUG_VARIABLE(bool, Force32bitAddressing, false, "Forces 32 bit addresses to be used in 64 bit dll")
 DECLARE_DEBUG_VARIABLE(bool, ForceCsrFlushing, false, "Forces flushing of command stream receiver")
 DECLARE_DEBUG_VARIABLE(bool, ForceCsrReprogramming, false, "Forces reprogramming of command stream receiver")
+DECLARE_DEBUG_VARIABLE(bool, DisableBatchedDependencyAnalysis, false, "Keeps dependency pipe controls between batched command buffers that do not access memory used by preceding ones")
 DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Disables stateless to stateful optimization for buffers")
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, 0, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNewHeapAllocator, true, "Custom 4GB heap allocator is used")
+DECLARE_DEBUG_VARIABLE(bool, UseSegregatedHeapAllocator, true, "4GB heap is managed by segregated fit allocator instead of free chunk lists")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrCacheSize, 64, "Linux only, number of userptr buffer objects of released host pointers kept for reuse, 0 disables the cache")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostHugePages, 1, "Linux only, 0: disabled, 1: allocations of at least 2MB are backed by transparent huge pages, 2: explicit huge pages are used when reserved, transparent ones otherwise")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -101,6 +119,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideQuickKmdSleepDelayMicroseconds, -1, "-1:
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1, "-1: dont override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
+DECLARE_DEBUG_VARIABLE(bool, AggregateUnblockedCommandsSubmission, false, "Kernels unblocked by one event status change are batched and submitted in one aggregated exec per Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDefaultFP64Settings, -1, "-1: dont override, 0: disable, 1: enable.")
 
 /*DRIVER TOGGLES*/
@@ -110,5 +129,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, NodeOrdinal, -1, "-1: default do not override, 0
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideThreadArbitrationPolicy, -1, "-1 (dont override) or any valid config (0: Age Based, 1: Round Robin)")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideAubDeviceId, -1, "-1 dont override, any other: use this value for AUB generation device id")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacket, -1, "-1: default, 0: disable, 1:enable. Write Timestamp Packet for each set of gpu walkers")
+DECLARE_DEBUG_VARIABLE(bool, EnableTimestampPacketProfiling, false, "Write start and end timestamps of each gpu walker to its Timestamp Packet and use them for event profiling instead of separate HwTimeStamps tags")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
+DECLARE_DEBUG_VARIABLE(int32_t, GpuClockCalibrationIntervalMs, 0, "Interval in milliseconds of background CPU/GPU timestamp anchor sampling on Linux, 0 - read GPU timestamp register for every sample")
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/clock_calibration.h"
+
+#include <cmath>
+#include <limits>
+
+namespace OCLRT {
+const size_t ClockCalibration::defaultMaxAnchors;
+const size_t ClockCalibration::minAnchorsToFit;
+const uint64_t ClockCalibration::defaultMaxErrorTicks;
+
+ClockCalibration::ClockCalibration(uint32_t timestampSizeInBits, uint64_t maxAnchorAgeNs)
+    : ClockCalibration(timestampSizeInBits, maxAnchorAgeNs, defaultMaxAnchors, defaultMaxErrorTicks) {
+}
+
+ClockCalibration::ClockCalibration(uint32_t timestampSizeInBits, uint64_t maxAnchorAgeNs, size_t maxAnchors, uint64_t maxErrorTicks)
+    : maxAnchorAgeNs(maxAnchorAgeNs), maxAnchors(maxAnchors < minAnchorsToFit ? minAnchorsToFit : maxAnchors), maxErrorTicks(maxErrorTicks) {
+    reset(timestampSizeInBits);
+}
+
+void ClockCalibration::reset(uint32_t timestampSizeInBits) {
+    std::lock_guard<std::mutex> lock(mtx);
+    timestampMask = timestampSizeInBits >= 64 ? std::numeric_limits<uint64_t>::max() : (1ull << timestampSizeInBits) - 1;
+    anchors.clear();
+    model = LinearFit();
+    wrapOffset = 0;
+    lastRawGpuTicks = 0;
+}
+
+void ClockCalibration::addAnchor(uint64_t cpuTimeNs, uint64_t gpuTicks) {
+    std::lock_guard<std::mutex> lock(mtx);
+    gpuTicks &= timestampMask;
+
+    if (!anchors.empty()) {
+        if (cpuTimeNs <= anchors.back().cpuTimeNs) {
+            return;
+        }
+        if (gpuTicks < lastRawGpuTicks && timestampMask != std::numeric_limits<uint64_t>::max()) {
+            wrapOffset += timestampMask + 1;
+        }
+    }
+    lastRawGpuTicks = gpuTicks;
+    uint64_t unwrappedGpuTicks = gpuTicks + wrapOffset;
+
+    bool restart = !anchors.empty() && cpuTimeNs - anchors.back().cpuTimeNs > maxAnchorAgeNs;
+    double predictedOffset = 0.0;
+    double errorBound = 0.0;
+    if (!restart && predict(cpuTimeNs, predictedOffset, errorBound)) {
+        double observedOffset = static_cast<double>(unwrappedGpuTicks - model.baseGpuTicks);
+        // GPU counter was reset or jumped, anchors taken so far no longer describe it
+        restart = std::fabs(observedOffset - predictedOffset) > errorBound + maxErrorTicks;
+    }
+    if (restart) {
+        anchors.clear();
+        model = LinearFit();
+        wrapOffset = 0;
+        unwrappedGpuTicks = gpuTicks;
+    }
+
+    anchors.push_back({cpuTimeNs, unwrappedGpuTicks});
+    while (anchors.size() > maxAnchors) {
+        anchors.pop_front();
+    }
+    fit();
+}
+
+void ClockCalibration::fit() {
+    model.valid = false;
+    if (anchors.size() < minAnchorsToFit) {
+        return;
+    }
+
+    const auto &base = anchors.front();
+    double n = static_cast<double>(anchors.size());
+    double meanX = 0.0;
+    double meanY = 0.0;
+    for (auto &anchor : anchors) {
+        meanX += static_cast<double>(anchor.cpuTimeNs - base.cpuTimeNs);
+        meanY += static_cast<double>(anchor.gpuTicks - base.gpuTicks);
+    }
+    meanX /= n;
+    meanY /= n;
+
+    double sxx = 0.0;
+    double sxy = 0.0;
+    for (auto &anchor : anchors) {
+        double dx = static_cast<double>(anchor.cpuTimeNs - base.cpuTimeNs) - meanX;
+        double dy = static_cast<double>(anchor.gpuTicks - base.gpuTicks) - meanY;
+        sxx += dx * dx;
+        sxy += dx * dy;
+    }
+    if (sxx <= 0.0) {
+        return;
+    }
+
+    double slope = sxy / sxx;
+    double intercept = meanY - slope * meanX;
+
+    double sumSquaredResiduals = 0.0;
+    double maxResidual = 0.0;
+    for (auto &anchor : anchors) {
+        double x = static_cast<double>(anchor.cpuTimeNs - base.cpuTimeNs);
+        double y = static_cast<double>(anchor.gpuTicks - base.gpuTicks);
+        double residual = std::fabs(y - (intercept + slope * x));
+        sumSquaredResiduals += residual * residual;
+        if (residual > maxResidual) {
+            maxResidual = residual;
+        }
+    }
+
+    model.baseCpuTimeNs = base.cpuTimeNs;
+    model.baseGpuTicks = base.gpuTicks;
+    model.lastCpuTimeNs = anchors.back().cpuTimeNs;
+    model.ticksPerNs = slope;
+    model.interceptTicks = intercept;
+    model.meanCpuOffsetNs = meanX;
+    model.maxResidualTicks = maxResidual;
+    model.slopeStdError = std::sqrt(sumSquaredResiduals / (n - 2) / sxx);
+    model.valid = true;
+}
+
+bool ClockCalibration::predict(uint64_t cpuTimeNs, double &gpuTicksOffset, double &errorBoundTicks) const {
+    if (!model.valid || cpuTimeNs < model.baseCpuTimeNs || cpuTimeNs > model.lastCpuTimeNs + maxAnchorAgeNs) {
+        return false;
+    }
+    double x = static_cast<double>(cpuTimeNs - model.baseCpuTimeNs);
+    gpuTicksOffset = model.interceptTicks + model.ticksPerNs * x;
+    // worst anchor residual, widened by three standard errors of slope over the extrapolated distance, plus rounding
+    errorBoundTicks = model.maxResidualTicks + 3.0 * model.slopeStdError * std::fabs(x - model.meanCpuOffsetNs) + 1.0;
+    return gpuTicksOffset >= 0.0;
+}
+
+bool ClockCalibration::convert(uint64_t cpuTimeNs, uint64_t &gpuTicks, uint64_t *errorBoundTicks) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    double gpuTicksOffset = 0.0;
+    double errorBound = 0.0;
+    if (!predict(cpuTimeNs, gpuTicksOffset, errorBound) || errorBound > static_cast<double>(maxErrorTicks)) {
+        return false;
+    }
+    gpuTicks = (model.baseGpuTicks + static_cast<uint64_t>(std::llround(gpuTicksOffset))) & timestampMask;
+    if (errorBoundTicks) {
+        *errorBoundTicks = static_cast<uint64_t>(std::ceil(errorBound));
+    }
+    return true;
+}
+
+size_t ClockCalibration::getAnchorsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return anchors.size();
+}
+
+bool ClockCalibration::isCalibrated() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return model.valid;
+}
+} // namespace OCLRT
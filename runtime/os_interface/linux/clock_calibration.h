@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace OCLRT {
+
+// Linear model of GPU timestamp ticks as a function of CPU CLOCK_MONOTONIC_RAW time.
+// Fitted with least squares over a window of anchor samples (CPU time, GPU ticks),
+// which lets CPU/GPU time queries be answered without reading the timestamp register.
+class ClockCalibration {
+  public:
+    static const size_t defaultMaxAnchors = 8;
+    static const size_t minAnchorsToFit = 3;
+    static const uint64_t defaultMaxErrorTicks = 100;
+
+    ClockCalibration(uint32_t timestampSizeInBits, uint64_t maxAnchorAgeNs);
+    ClockCalibration(uint32_t timestampSizeInBits, uint64_t maxAnchorAgeNs, size_t maxAnchors, uint64_t maxErrorTicks);
+
+    void reset(uint32_t timestampSizeInBits);
+    void addAnchor(uint64_t cpuTimeNs, uint64_t gpuTicks);
+    bool convert(uint64_t cpuTimeNs, uint64_t &gpuTicks, uint64_t *errorBoundTicks = nullptr) const;
+
+    size_t getAnchorsCount() const;
+    bool isCalibrated() const;
+
+  protected:
+    struct Anchor {
+        uint64_t cpuTimeNs;
+        uint64_t gpuTicks;
+    };
+
+    struct LinearFit {
+        bool valid = false;
+        uint64_t baseCpuTimeNs = 0;
+        uint64_t baseGpuTicks = 0;
+        uint64_t lastCpuTimeNs = 0;
+        double ticksPerNs = 0.0;
+        double interceptTicks = 0.0;
+        double meanCpuOffsetNs = 0.0;
+        double maxResidualTicks = 0.0;
+        double slopeStdError = 0.0;
+    };
+
+    void fit();
+    bool predict(uint64_t cpuTimeNs, double &gpuTicksOffset, double &errorBoundTicks) const;
+
+    const uint64_t maxAnchorAgeNs;
+    const size_t maxAnchors;
+    const uint64_t maxErrorTicks;
+
+    mutable std::mutex mtx;
+    std::deque<Anchor> anchors;
+    LinearFit model;
+    uint64_t timestampMask = 0;
+    uint64_t wrapOffset = 0;
+    uint64_t lastRawGpuTicks = 0;
+};
+} // namespace OCLRT
@@ -7,7 +7,6 @@
 
 #include <atomic>
 #include <iostream>
-#include <queue>
 #include <stdio.h>
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/os_interface/linux/drm_buffer_object.h"
@@ -34,20 +33,28 @@ void DrmGemCloseWorker::closeThread() {
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
-    active = false;
-    closeThread();
+    close(true);
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    if (!active) {
+        // worker may have already drained its queue and exited, object is closed in place
+        lock.unlock();
+        close(bo);
+        return;
+    }
+    queue.pushRefFrontOne(*bo);
+    if (workerWaiting) {
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     active = false;
+    lock.unlock();
     condition.notify_all();
     if (blocking) {
         closeThread();
@@ -64,41 +71,55 @@ inline void DrmGemCloseWorker::close(BufferObject *bo) {
     workCount--;
 }
 
-void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+bool DrmGemCloseWorker::processQueue() {
+    auto nodes = queue.detachNodes();
+    if (nodes == nullptr) {
+        return false;
+    }
 
-    while (self->active) {
-        lock.lock();
-        workItem = nullptr;
+    // queue is filled from the front, restore order in which objects were pushed
+    IFNodeRef<BufferObject> *orderedNodes = nullptr;
+    while (nodes != nullptr) {
+        auto next = nodes->next;
+        nodes->next = orderedNodes;
+        orderedNodes = nodes;
+        nodes = next;
+    }
 
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+    // objects holding ranges of address space go first, allocations may be waiting for these ranges
+    for (auto node = orderedNodes; node != nullptr; node = node->next) {
+        if (node->ref->peekUnmapSize() > 0) {
+            close(node->ref);
+            node->ref = nullptr;
         }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+    }
+    for (auto node = orderedNodes; node != nullptr; node = node->next) {
+        if (node->ref != nullptr) {
+            close(node->ref);
         }
+    }
+    orderedNodes->deleteThisAndAllNext();
+    return true;
+}
 
-        lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
+void *DrmGemCloseWorker::worker(void *arg) {
+    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+
+    while (self->active) {
+        if (self->processQueue()) {
+            continue;
         }
+        std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+        self->workerWaiting = true;
+        while (self->queue.peekIsEmpty() && self->active) {
+            self->condition.wait(lock);
+        }
+        self->workerWaiting = false;
     }
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+    while (self->processQueue()) {
     }
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
@@ -6,12 +6,14 @@
  */
 
 #pragma once
+#include "runtime/utilities/iflist.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <map>
+#include <memory>
 #include <set>
-#include <queue>
 #include <cstdint>
 
 namespace OCLRT {
@@ -36,22 +38,28 @@ class DrmGemCloseWorker {
     void close(bool blocking);
 
     bool isEmpty();
+    bool isActive() const { return active; }
 
   protected:
     void close(BufferObject *workItem);
+    // closes everything pushed so far in one batch, returns false when queue was empty
+    bool processQueue();
     void closeThread();
     static void *worker(void *arg);
-    bool active = true;
+    std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    // producers push under closeWorkerMutex, worker detaches all pushed items at once without it
+    IFRefList<BufferObject, true, true> queue;
     std::atomic<uint32_t> workCount{0};
 
     DrmMemoryManager &memoryManager;
 
+    // orders pushes with worker sleeping and with worker being closed
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
+    std::atomic<bool> workerWaiting{false};
     std::atomic<bool> workerDone{false};
 };
 } // namespace OCLRT
@@ -8,6 +8,7 @@
 #include "runtime/device/device.h"
 #include "runtime/helpers/ptr_math.h"
 #include "runtime/helpers/options.h"
+#include "runtime/memory_manager/deferred_deleter.h"
 #include "runtime/memory_manager/host_ptr_manager.h"
 #include "runtime/os_interface/32bit_memory.h"
 #include "runtime/os_interface/linux/drm_allocation.h"
@@ -51,12 +52,29 @@ DrmMemoryManager::DrmMemoryManager(Drm *drm, gemCloseWorkerMode mode, bool force
         pinBB->isAllocated = true;
     }
     internal32bitAllocator.reset(new Allocator32bit);
+    hostHugePagesMode = DebugManager.flags.EnableHostHugePages.get();
+    // objects taken from cache are validated by pinning, the same way as newly created ones
+    if (pinBB && validateHostPtrMemory && DebugManager.flags.UserptrCacheSize.get() > 0) {
+        userptrCache.reset(new DrmUserptrCache(static_cast<size_t>(DebugManager.flags.UserptrCacheSize.get())));
+    }
+    // deleter frees allocations released while still in use by GPU
+    asyncDeleterEnabled = DebugManager.flags.EnableDeferredDeleter.get();
+    if (asyncDeleterEnabled) {
+        deferredDeleter = createDeferredDeleter();
+    }
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    waitForDeletions();
     applyCommonCleanup();
+    if (userptrCache) {
+        std::vector<BufferObject *> cachedObjects;
+        userptrCache->evictAll(cachedObjects);
+        releaseBufferObjects(cachedObjects);
+    }
     if (gemCloseWorker) {
-        gemCloseWorker->close(false);
+        // objects pushed by worker clients are released while allocators still exist
+        gemCloseWorker->close(true);
     }
     if (pinBB) {
         unreference(pinBB);
@@ -165,7 +183,22 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, size_t alig
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(size, minAlignment), minAlignment);
 
-    auto res = alignedMallocWrapper(cSize, cAlignment);
+    void *res = nullptr;
+    size_t hugePagesSize = 0;
+    // huge pages are used only when padding to huge page boundary wastes at most 1/8 of the size
+    if (hostHugePagesMode != 0 && cSize >= MemoryConstants::pageSize2Mb &&
+        alignUp(cSize, MemoryConstants::pageSize2Mb) - cSize <= cSize / 8) {
+        hugePagesSize = alignUp(cSize, MemoryConstants::pageSize2Mb);
+        res = allocateHostHugePages(hugePagesSize);
+        if (res) {
+            cSize = hugePagesSize;
+        } else {
+            hugePagesSize = 0;
+        }
+    }
+    if (!res) {
+        res = alignedMallocWrapper(cSize, cAlignment);
+    }
 
     if (!res)
         return nullptr;
@@ -173,17 +206,54 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, size_t alig
     BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, true);
 
     if (!bo) {
-        alignedFreeWrapper(res);
+        if (hugePagesSize) {
+            munmapFunction(res, hugePagesSize);
+        } else {
+            alignedFreeWrapper(res);
+        }
         return nullptr;
     }
 
     bo->isAllocated = true;
+    if (hugePagesSize) {
+        bo->setUnmapSize(hugePagesSize);
+        bo->setAllocationType(MMAP_ALLOCATOR);
+    }
     if (forcePinEnabled && pinBB != nullptr && forcePin && size >= this->pinThreshold) {
         pinBB->pin(&bo, 1);
     }
     return new DrmAllocation(bo, res, cSize, MemoryPool::System4KBPages);
 }
 
+void *DrmMemoryManager::allocateHostHugePages(size_t size) {
+    if (hostHugePagesMode == 2) {
+        auto ptr = mmapFunction(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+        // no explicit huge pages are reserved, transparent ones are used instead
+    }
+
+    // range is mapped with one spare huge page and trimmed to huge page boundaries
+    auto mappedSize = size + MemoryConstants::pageSize2Mb;
+    auto ptr = mmapFunction(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    auto alignedPtr = alignUp(ptr, MemoryConstants::pageSize2Mb);
+    auto leadingSize = ptrDiff(alignedPtr, ptr);
+    if (leadingSize) {
+        munmapFunction(ptr, leadingSize);
+    }
+    auto trailingSize = mappedSize - leadingSize - size;
+    if (trailingSize) {
+        munmapFunction(ptrOffset(alignedPtr, size), trailingSize);
+    }
+    // failed advice only leaves the range backed by 4KB pages
+    madviseFunction(alignedPtr, size, MADV_HUGEPAGE);
+    return alignedPtr;
+}
+
 DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, const void *ptr, bool forcePin) {
     auto res = static_cast<DrmAllocation *>(MemoryManager::allocateGraphicsMemory(size, const_cast<void *>(ptr), forcePin));
 
@@ -432,7 +502,8 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
         delete input->gmm;
 
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
-        cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
+        hostPtrManager->releaseHandleStorage(gfxAllocation->fragmentsStorage);
+        releaseOsHandles(gfxAllocation->fragmentsStorage, userptrCache != nullptr);
         delete gfxAllocation;
         return;
     }
@@ -445,6 +516,12 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
 
     delete gfxAllocation;
 
+    if (gemCloseWorker && search->peekIsAllocated() && !search->peekIsReusableAllocation()) {
+        // memory backing the object is owned by driver, worker releases it once GPU completes
+        gemCloseWorker->push(search);
+        return;
+    }
+
     search->wait(-1);
     unreference(search);
 }
@@ -481,10 +558,17 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
             handleStorage.fragmentStorageData[i].osHandleStorage = new OsHandle();
             handleStorage.fragmentStorageData[i].residency = new ResidencyData();
 
-            handleStorage.fragmentStorageData[i].osHandleStorage->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
-                                                                                    handleStorage.fragmentStorageData[i].fragmentSize,
-                                                                                    0,
-                                                                                    true);
+            BufferObject *bo = nullptr;
+            if (userptrCache) {
+                bo = userptrCache->take(reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr), handleStorage.fragmentStorageData[i].fragmentSize);
+            }
+            if (bo == nullptr) {
+                bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
+                                  handleStorage.fragmentStorageData[i].fragmentSize,
+                                  0,
+                                  true);
+            }
+            handleStorage.fragmentStorageData[i].osHandleStorage->bo = bo;
             if (!handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
                 handleStorage.fragmentStorageData[i].freeTheFragment = true;
                 return AllocationStatus::Error;
@@ -500,9 +584,16 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
         int result = pinBB->pin(allocatedBos, numberOfBosAllocated);
 
         if (result == EFAULT) {
+            std::vector<BufferObject *> invalidCachedObjects;
             for (uint32_t i = 0; i < numberOfBosAllocated; i++) {
-                handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]].freeTheFragment = true;
+                auto &fragment = handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]];
+                fragment.freeTheFragment = true;
+                if (userptrCache) {
+                    // host memory was unmapped, cached objects of its pages are not valid either
+                    userptrCache->evict(reinterpret_cast<uintptr_t>(fragment.cpuPtr), fragment.fragmentSize, invalidCachedObjects);
+                }
             }
+            releaseBufferObjects(invalidCachedObjects);
             return AllocationStatus::InvalidHostPointer;
         } else if (result != 0) {
             return AllocationStatus::Error;
@@ -516,14 +607,25 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
 }
 
 void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage) {
+    releaseOsHandles(handleStorage, false);
+}
+
+void DrmMemoryManager::releaseOsHandles(OsHandleStorage &handleStorage, bool cacheUserptrObjects) {
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
             if (handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
                 BufferObject *search = handleStorage.fragmentStorageData[i].osHandleStorage->bo;
-                search->wait(-1);
-                auto refCount = unreference(search, true);
-                DEBUG_BREAK_IF(refCount != 1u);
-                ((void)(refCount));
+                if (cacheUserptrObjects) {
+                    // fragment was released by host ptr manager, its object is kept until cache evicts it
+                    search = userptrCache->store(reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr),
+                                                 handleStorage.fragmentStorageData[i].fragmentSize, search);
+                }
+                if (search) {
+                    search->wait(-1);
+                    auto refCount = unreference(search, true);
+                    DEBUG_BREAK_IF(refCount != 1u);
+                    ((void)(refCount));
+                }
             }
             delete handleStorage.fragmentStorageData[i].osHandleStorage;
             handleStorage.fragmentStorageData[i].osHandleStorage = nullptr;
@@ -533,6 +635,14 @@ void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage) {
     }
 }
 
+void DrmMemoryManager::releaseBufferObjects(std::vector<BufferObject *> &bufferObjects) {
+    for (auto bo : bufferObjects) {
+        bo->wait(-1);
+        unreference(bo, true);
+    }
+    bufferObjects.clear();
+}
+
 BufferObject *DrmMemoryManager::getPinBB() const {
     return pinBB;
 }
@@ -10,6 +10,7 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/linux/drm_allocation.h"
 #include "runtime/os_interface/linux/drm_neo.h"
+#include "runtime/os_interface/linux/drm_userptr_cache.h"
 #include <map>
 #include <sys/mman.h>
 
@@ -68,19 +69,27 @@ class DrmMemoryManager : public MemoryManager {
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, bool softpin);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
+    void releaseOsHandles(OsHandleStorage &handleStorage, bool cacheUserptrObjects);
+    void releaseBufferObjects(std::vector<BufferObject *> &bufferObjects);
+    // returns huge page aligned memory or nullptr, size has to be multiple of huge page size
+    void *allocateHostHugePages(size_t size);
 
     Drm *drm;
     BufferObject *pinBB;
     size_t pinThreshold = 8 * 1024 * 1024;
     bool forcePinEnabled = false;
+    int32_t hostHugePagesMode = 0;
     const bool validateHostPtrMemory;
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
     std::unique_ptr<Allocator32bit> internal32bitAllocator;
+    // objects of released host pointers, reused when the same pages are wrapped again
+    std::unique_ptr<DrmUserptrCache> userptrCache;
 };
 } // namespace OCLRT
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/drm_userptr_cache.h"
+
+namespace OCLRT {
+
+BufferObject *DrmUserptrCache::take(uintptr_t address, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto object = objects.find(RangeKey(address, size));
+    if (object == objects.end()) {
+        return nullptr;
+    }
+    auto bo = object->second->bo;
+    lruList.erase(object->second);
+    objects.erase(object);
+    return bo;
+}
+
+BufferObject *DrmUserptrCache::store(uintptr_t address, size_t size, BufferObject *bo) {
+    if (capacity == 0) {
+        return bo;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    BufferObject *evicted = nullptr;
+    RangeKey range(address, size);
+    auto object = objects.find(range);
+    if (object != objects.end()) {
+        // range was wrapped again while previous object was cached, older one is released
+        evicted = object->second->bo;
+        lruList.erase(object->second);
+        objects.erase(object);
+    } else if (objects.size() == capacity) {
+        evicted = lruList.back().bo;
+        objects.erase(lruList.back().range);
+        lruList.pop_back();
+    }
+    lruList.push_front(CachedObject{range, bo});
+    objects[range] = lruList.begin();
+    return evicted;
+}
+
+void DrmUserptrCache::evict(uintptr_t address, size_t size, std::vector<BufferObject *> &evicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    // ranges are ordered by address, only ranges starting below end of given range may overlap it
+    auto object = objects.begin();
+    while (object != objects.end() && object->first.first < address + size) {
+        if (object->first.first + object->first.second > address) {
+            evicted.push_back(object->second->bo);
+            lruList.erase(object->second);
+            object = objects.erase(object);
+        } else {
+            ++object;
+        }
+    }
+}
+
+void DrmUserptrCache::evictAll(std::vector<BufferObject *> &evicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &object : lruList) {
+        evicted.push_back(object.bo);
+    }
+    lruList.clear();
+    objects.clear();
+}
+
+size_t DrmUserptrCache::size() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return objects.size();
+}
+} // namespace OCLRT
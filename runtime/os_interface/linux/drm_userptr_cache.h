@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace OCLRT {
+class BufferObject;
+
+// Least recently used userptr buffer objects of host pointers released by HostPtrManager.
+// Objects are keyed by page aligned address and size of host memory they wrap. Host memory may be
+// unmapped after it was released, so object taken from cache has to be validated before it is used.
+class DrmUserptrCache {
+  public:
+    DrmUserptrCache(size_t capacity) : capacity(capacity) {}
+
+    DrmUserptrCache(const DrmUserptrCache &) = delete;
+    DrmUserptrCache &operator=(const DrmUserptrCache &) = delete;
+
+    // returns object wrapping exactly given range and removes it from cache, nullptr when there is none
+    BufferObject *take(uintptr_t address, size_t size);
+    // returns least recently stored object when cache was full, caller releases it
+    BufferObject *store(uintptr_t address, size_t size, BufferObject *bo);
+    // removes objects wrapping any page of given range
+    void evict(uintptr_t address, size_t size, std::vector<BufferObject *> &evicted);
+    void evictAll(std::vector<BufferObject *> &evicted);
+
+    size_t getCapacity() const { return capacity; }
+    size_t size();
+
+  protected:
+    using RangeKey = std::pair<uintptr_t, size_t>;
+    struct CachedObject {
+        RangeKey range;
+        BufferObject *bo;
+    };
+    using LruList = std::list<CachedObject>;
+
+    const size_t capacity;
+    // most recently stored objects are at the front
+    LruList lruList;
+    std::map<RangeKey, LruList::iterator> objects;
+    std::mutex mtx;
+};
+} // namespace OCLRT
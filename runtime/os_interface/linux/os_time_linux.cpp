@@ -6,10 +6,14 @@
  */
 
 #include <time.h>
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/linux/drm_neo.h"
 #include "drm/i915_drm.h"
 #include "runtime/os_interface/linux/os_interface.h"
 #include "runtime/os_interface/linux/os_time_linux.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <chrono>
 
 namespace OCLRT {
 
@@ -23,9 +27,14 @@ OSTimeLinux::OSTimeLinux(OSInterface *osInterface) {
         pDrm = Drm::get(0);
     }
     timestampTypeDetect();
+    if (DebugManager.flags.GpuClockCalibrationIntervalMs.get() > 0) {
+        startClockCalibration(static_cast<uint32_t>(DebugManager.flags.GpuClockCalibrationIntervalMs.get()));
+    }
 }
 
-OSTimeLinux::~OSTimeLinux(){};
+OSTimeLinux::~OSTimeLinux() {
+    stopClockCalibration();
+}
 
 void OSTimeLinux::timestampTypeDetect() {
     struct drm_i915_reg_read reg;
@@ -50,6 +59,9 @@ void OSTimeLinux::timestampTypeDetect() {
         getGpuTime = &OSTimeLinux::getGpuTime36;
         timestampSizeInBits = OCLRT_NUM_TIMESTAMP_BITS;
     }
+    if (clockCalibration) {
+        clockCalibration->reset(timestampSizeInBits);
+    }
 }
 
 bool OSTimeLinux::getCpuTime(uint64_t *timestamp) {
@@ -113,6 +125,14 @@ bool OSTimeLinux::getCpuGpuTime(TimeStampData *pGpuCpuTime) {
     if (nullptr == this->getGpuTime) {
         return false;
     }
+    if (clockCalibration) {
+        if (!getCpuTime(&pGpuCpuTime->CPUTimeinNS)) {
+            return false;
+        }
+        if (clockCalibration->convert(pGpuCpuTime->CPUTimeinNS, pGpuCpuTime->GPUTimeStamp)) {
+            return true;
+        }
+    }
     if (!(this->*getGpuTime)(&pGpuCpuTime->GPUTimeStamp)) {
         return false;
     }
@@ -123,6 +143,59 @@ bool OSTimeLinux::getCpuGpuTime(TimeStampData *pGpuCpuTime) {
     return true;
 }
 
+bool OSTimeLinux::sampleClockAnchor() {
+    uint64_t cpuTimeBefore = 0;
+    uint64_t cpuTimeAfter = 0;
+    uint64_t gpuTicks = 0;
+
+    if (nullptr == this->getGpuTime || !clockCalibration) {
+        return false;
+    }
+    if (!getCpuTime(&cpuTimeBefore) || !(this->*getGpuTime)(&gpuTicks) || !getCpuTime(&cpuTimeAfter)) {
+        return false;
+    }
+    // register read latency is split evenly around the sampled GPU tick
+    clockCalibration->addAnchor(cpuTimeBefore + (cpuTimeAfter - cpuTimeBefore) / 2, gpuTicks);
+    return true;
+}
+
+void OSTimeLinux::startClockCalibration(uint32_t intervalMs) {
+    if (nullptr == this->getGpuTime || clockCalibrationThread) {
+        return;
+    }
+    // anchors older than a few sampling intervals mean the worker stalled, conversions fall back to register reads
+    clockCalibration.reset(new ClockCalibration(timestampSizeInBits, 4ull * intervalMs * 1000000ull));
+    clockCalibrationIntervalMs = intervalMs;
+    clockCalibrationActive = true;
+    clockCalibrationThread = Thread::create(clockCalibrationWorker, reinterpret_cast<void *>(this));
+}
+
+void OSTimeLinux::stopClockCalibration() {
+    if (!clockCalibrationThread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(clockCalibrationMutex);
+        clockCalibrationActive = false;
+    }
+    clockCalibrationCondition.notify_all();
+    clockCalibrationThread->join();
+    clockCalibrationThread.reset();
+}
+
+void *OSTimeLinux::clockCalibrationWorker(void *arg) {
+    OSTimeLinux *self = reinterpret_cast<OSTimeLinux *>(arg);
+    std::unique_lock<std::mutex> lock(self->clockCalibrationMutex);
+    while (self->clockCalibrationActive) {
+        lock.unlock();
+        self->sampleClockAnchor();
+        lock.lock();
+        self->clockCalibrationCondition.wait_for(lock, std::chrono::milliseconds(self->clockCalibrationIntervalMs),
+                                                 [self] { return !self->clockCalibrationActive; });
+    }
+    return nullptr;
+}
+
 std::unique_ptr<OSTime> OSTime::create(OSInterface *osInterface) {
     return std::unique_ptr<OSTime>(new OSTimeLinux(osInterface));
 }
@@ -6,14 +6,19 @@
  */
 
 #pragma once
+#include "runtime/os_interface/linux/clock_calibration.h"
 #include "runtime/os_interface/os_time.h"
 
+#include <condition_variable>
+#include <mutex>
+
 #define OCLRT_NUM_TIMESTAMP_BITS (36)
 #define OCLRT_NUM_TIMESTAMP_BITS_FALLBACK (32)
 #define TIMESTAMP_HIGH_REG 0x0235C
 #define TIMESTAMP_LOW_REG 0x02358
 
 namespace OCLRT {
+class Thread;
 
 class OSTimeLinux : public OSTime {
   public:
@@ -31,13 +36,26 @@ class OSTimeLinux : public OSTime {
     double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const override;
     uint64_t getCpuRawTimestamp() override;
 
+    void startClockCalibration(uint32_t intervalMs);
+    void stopClockCalibration();
+    bool sampleClockAnchor();
+
   protected:
+    static void *clockCalibrationWorker(void *arg);
+
     typedef int (*resolutionFunc_t)(clockid_t, struct timespec *);
     typedef int (*getTimeFunc_t)(clockid_t, struct timespec *);
     Drm *pDrm;
     unsigned timestampSizeInBits;
     resolutionFunc_t resolutionFunc;
     getTimeFunc_t getTimeFunc;
+
+    std::unique_ptr<ClockCalibration> clockCalibration;
+    std::unique_ptr<Thread> clockCalibrationThread;
+    std::mutex clockCalibrationMutex;
+    std::condition_variable clockCalibrationCondition;
+    bool clockCalibrationActive = false;
+    uint32_t clockCalibrationIntervalMs = 0;
 };
 
 } // namespace OCLRT
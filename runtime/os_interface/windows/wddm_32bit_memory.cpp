@@ -34,7 +34,7 @@ class Allocator32bit::OsInternals {
 Allocator32bit::Allocator32bit(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
-    heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, size));
+    createHeapAllocator(base, size);
 }
 
 OCLRT::Allocator32bit::Allocator32bit() {
@@ -43,7 +43,7 @@ OCLRT::Allocator32bit::Allocator32bit() {
     osInternals = std::unique_ptr<OsInternals>(new OsInternals);
     osInternals.get()->allocatedRange = (void *)((uintptr_t)this->base);
 
-    heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(this->base, sizeToMap));
+    createHeapAllocator(this->base, sizeToMap);
 }
 
 OCLRT::Allocator32bit::~Allocator32bit() {
@@ -55,11 +55,11 @@ OCLRT::Allocator32bit::~Allocator32bit() {
 uint64_t Allocator32bit::allocate(size_t &size) {
     if (size >= 0xfffff000)
         return 0llu;
-    return this->heapAllocator->allocate(size);
+    return allocateFromHeap(size);
 }
 
 int Allocator32bit::free(uint64_t ptr, size_t size) {
-    this->heapAllocator->free(ptr, size);
+    freeToHeap(ptr, size);
     return 0;
 }
 
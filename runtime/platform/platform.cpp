@@ -22,6 +22,7 @@
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/event/async_events_handler.h"
 #include "runtime/sharings/sharing_factory.h"
+#include "runtime/utilities/worker_pool.h"
 #include "runtime/platform/extensions.h"
 #include "CL/cl_ext.h"
 
@@ -51,6 +52,8 @@ Platform::Platform() {
 
 Platform::~Platform() {
     asyncEventsHandler->closeThread();
+    // pending builds still reference devices of this platform
+    buildWorkerPool.reset();
     for (auto dev : this->devices) {
         if (dev) {
             dev->decRefInternal();
@@ -229,6 +232,15 @@ AsyncEventsHandler *Platform::getAsyncEventsHandler() {
     return asyncEventsHandler.get();
 }
 
+WorkerPool *Platform::getBuildWorkerPool() {
+    std::lock_guard<std::mutex> lock(buildWorkerPoolMutex);
+    if (!buildWorkerPool) {
+        auto workersCount = DebugManager.flags.ProgramBuildWorkersCount.get();
+        buildWorkerPool.reset(new WorkerPool(workersCount > 0 ? static_cast<uint32_t>(workersCount) : WorkerPool::getDefaultWorkersCount()));
+    }
+    return buildWorkerPool.get();
+}
+
 std::unique_ptr<AsyncEventsHandler> Platform::setAsyncEventsHandler(std::unique_ptr<AsyncEventsHandler> handler) {
     asyncEventsHandler.swap(handler);
     return handler;
@@ -11,6 +11,7 @@
 #include "runtime/device/device_vector.h"
 #include "runtime/helpers/base_object.h"
 #include <condition_variable>
+#include <mutex>
 #include <vector>
 
 namespace OCLRT {
@@ -19,6 +20,7 @@ class CompilerInterface;
 class Device;
 class AsyncEventsHandler;
 class ExecutionEnvironment;
+class WorkerPool;
 struct HardwareInfo;
 
 template <>
@@ -53,6 +55,8 @@ class Platform : public BaseObject<_cl_platform_id> {
     const PlatformInfo &getPlatformInfo() const;
     AsyncEventsHandler *getAsyncEventsHandler();
     std::unique_ptr<AsyncEventsHandler> setAsyncEventsHandler(std::unique_ptr<AsyncEventsHandler> handler);
+    // workers running asynchronous program builds and patch token parsing, created on first use
+    WorkerPool *getBuildWorkerPool();
     ExecutionEnvironment *peekExecutionEnvironment() { return executionEnvironment; }
 
   protected:
@@ -68,6 +72,8 @@ class Platform : public BaseObject<_cl_platform_id> {
     DeviceVector devices;
     std::string compilerExtensions;
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
+    std::unique_ptr<WorkerPool> buildWorkerPool;
+    std::mutex buildWorkerPoolMutex;
     ExecutionEnvironment *executionEnvironment = nullptr;
 };
 
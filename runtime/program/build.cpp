@@ -46,15 +46,41 @@ cl_int Program::build(
             break;
         }
 
-        // check to see if a previous build request is in progress
-        if (buildStatus == CL_BUILD_IN_PROGRESS) {
-            retVal = CL_INVALID_OPERATION;
-            break;
+        // check to see if a previous build request is in progress, the check and the claim of the build are
+        // a single atomic step, so concurrent build requests cannot both start a build
+        cl_build_status currentBuildStatus = buildStatus;
+        do {
+            if (currentBuildStatus == CL_BUILD_IN_PROGRESS) {
+                return CL_INVALID_OPERATION;
+            }
+        } while (!buildStatus.compare_exchange_weak(currentBuildStatus, CL_BUILD_IN_PROGRESS));
+
+        if (funcNotify != nullptr && DebugManager.flags.EnableAsyncProgramBuild.get() && platform()) {
+            // pfn_notify is called from a build worker, program is kept alive until it returns
+            std::string asyncBuildOptions = (buildOptions) ? buildOptions : "";
+            this->incRefInternal();
+            platform()->getBuildWorkerPool()->enqueue([this, asyncBuildOptions, funcNotify, userData, enableCaching]() {
+                auto asyncRetVal = buildBinary(asyncBuildOptions.c_str(), enableCaching);
+                completeBuild(asyncRetVal, funcNotify, userData);
+                this->decRefInternal();
+            });
+            return CL_SUCCESS;
         }
 
-        if (isCreatedFromBinary == false) {
-            buildStatus = CL_BUILD_IN_PROGRESS;
+        retVal = buildBinary(buildOptions, enableCaching);
+    } while (false);
+
+    completeBuild(retVal, funcNotify, userData);
 
+    return retVal;
+}
+
+cl_int Program::buildBinary(const char *buildOptions, bool enableCaching) {
+    cl_int retVal = CL_SUCCESS;
+    std::lock_guard<std::mutex> lock(buildMutex);
+
+    do {
+        if (isCreatedFromBinary == false) {
             options = (buildOptions) ? buildOptions : "";
             extractInternalOptions(options);
 
@@ -128,19 +154,22 @@ cl_int Program::build(
         separateBlockKernels();
     } while (false);
 
+    return retVal;
+}
+
+void Program::completeBuild(cl_int retVal, void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    // binary type is published before build status, which is polled by other threads during asynchronous builds
     if (retVal != CL_SUCCESS) {
-        buildStatus = CL_BUILD_ERROR;
         programBinaryType = CL_PROGRAM_BINARY_TYPE_NONE;
+        buildStatus = CL_BUILD_ERROR;
     } else {
-        buildStatus = CL_BUILD_SUCCESS;
         programBinaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
+        buildStatus = CL_BUILD_SUCCESS;
     }
 
     if (funcNotify != nullptr) {
         (*funcNotify)(this, userData);
     }
-
-    return retVal;
 }
 
 cl_int Program::build(const cl_device_id device, const char *buildOptions, bool enableCaching,
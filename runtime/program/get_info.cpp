@@ -24,6 +24,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
     cl_uint refCount = 0;
     size_t numKernels;
     cl_context clContext = context;
+    std::unique_lock<std::mutex> lock(buildMutex, std::defer_lock);
 
     switch (paramName) {
     case CL_PROGRAM_CONTEXT:
@@ -32,6 +33,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         break;
 
     case CL_PROGRAM_BINARIES:
+        lock.lock();
         resolveProgramBinary();
         pSrc = elfBinary.data();
         retSize = sizeof(void **);
@@ -47,12 +49,14 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         break;
 
     case CL_PROGRAM_BINARY_SIZES:
+        lock.lock();
         resolveProgramBinary();
         pSrc = &elfBinarySize;
         retSize = srcSize = sizeof(size_t *);
         break;
 
     case CL_PROGRAM_KERNEL_NAMES:
+        lock.lock();
         kernelNamesString = getKernelNamesString();
         pSrc = kernelNamesString.c_str();
         retSize = srcSize = kernelNamesString.length() + 1;
@@ -63,6 +67,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         break;
 
     case CL_PROGRAM_NUM_KERNELS:
+        lock.lock();
         numKernels = kernelInfoArray.size();
         pSrc = &numKernels;
         retSize = srcSize = sizeof(numKernels);
@@ -105,12 +110,14 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         break;
 
     case CL_PROGRAM_DEBUG_INFO_SIZES_INTEL:
+        lock.lock();
         resolveProgramBinary();
         retSize = srcSize = sizeof(debugDataSize);
         pSrc = &debugDataSize;
         break;
 
     case CL_PROGRAM_DEBUG_INFO_INTEL:
+        lock.lock();
         resolveProgramBinary();
         pSrc = debugData;
         retSize = numDevices * sizeof(void **);
@@ -146,6 +153,8 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
     size_t srcSize = 0;
     size_t retSize = 0;
     cl_device_id device_id = pDevice;
+    cl_build_status currentBuildStatus = buildStatus;
+    std::unique_lock<std::mutex> lock(buildMutex, std::defer_lock);
 
     if (device != device_id) {
         return CL_INVALID_DEVICE;
@@ -161,15 +170,17 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
     switch (paramName) {
     case CL_PROGRAM_BUILD_STATUS:
         srcSize = retSize = sizeof(cl_build_status);
-        pSrc = &buildStatus;
+        pSrc = &currentBuildStatus;
         break;
 
     case CL_PROGRAM_BUILD_OPTIONS:
+        lock.lock();
         srcSize = retSize = strlen(options.c_str()) + 1;
         pSrc = options.c_str();
         break;
 
     case CL_PROGRAM_BUILD_LOG: {
+        lock.lock();
         const char *pBuildLog = getBuildLog(pDev);
 
         if (pBuildLog != nullptr) {
@@ -13,6 +13,7 @@
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/image.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/program/kernel_isa_pool.h"
 #include "runtime/kernel/kernel.h"
 #include "runtime/sampler/sampler.h"
 #include "runtime/helpers/string.h"
@@ -204,6 +205,33 @@ KernelInfo::~KernelInfo() {
     delete[] crossThreadData;
 }
 
+// drops state parsed from patch list, so failed parsing can be retried from scratch
+void KernelInfo::resetPatchListState() {
+    for (auto &stringData : patchInfo.stringDataMap) {
+        delete[] stringData.second.pStringData;
+    }
+    patchInfo = {};
+    workloadInfo = {};
+    kernelArgInfo.clear();
+    kernelNonArgInfo.clear();
+    childrenKernelsIdOffset.clear();
+    attributes.clear();
+    delete[] crossThreadData;
+    crossThreadData = nullptr;
+    reqdWorkGroupSize[0] = WorkloadInfo::undefinedOffset;
+    reqdWorkGroupSize[1] = WorkloadInfo::undefinedOffset;
+    reqdWorkGroupSize[2] = WorkloadInfo::undefinedOffset;
+    requiredSubGroupSize = 0;
+    workgroupWalkOrder = {{0, 1, 2}};
+    workgroupDimensionsOrder = {{0, 1, 2}};
+    usesSsh = false;
+    requiresSshForBuffers = false;
+    isValid = false;
+    isVmeWorkload = false;
+    argumentsToPatchNum = 0;
+    systemKernelOffset = 0;
+}
+
 cl_int KernelInfo::storeArgInfo(const SPatchKernelArgumentInfo *pkernelArgInfo) {
     cl_int retVal = CL_SUCCESS;
 
@@ -494,4 +522,11 @@ bool KernelInfo::createKernelAllocation(MemoryManager *memoryManager) {
     return true;
 }
 
+bool KernelInfo::createKernelAllocation(KernelIsaPool &isaPool) {
+    UNRECOVERABLE_IF(kernelAllocation);
+    kernelAllocation = isaPool.allocate(heapInfo.pKernelHeap, heapInfo.pKernelHeader->KernelHeapSize, kernelAllocationOffset);
+    isKernelAllocationShared = kernelAllocation != nullptr;
+    return isKernelAllocationShared;
+}
+
 } // namespace OCLRT
@@ -30,6 +30,7 @@ class DispatchInfo;
 struct KernelArgumentType;
 class GraphicsAllocation;
 class MemoryManager;
+class KernelIsaPool;
 
 extern std::unordered_map<std::string, uint32_t> accessQualifierMap;
 extern std::unordered_map<std::string, uint32_t> addressQualifierMap;
@@ -149,6 +150,7 @@ struct KernelInfo {
     void storePatchToken(const SPatchAllocateSystemThreadSurface *pSystemThreadSurface);
     GraphicsAllocation *getGraphicsAllocation() const { return this->kernelAllocation; }
     cl_int resolveKernelInfo();
+    void resetPatchListState();
     void resizeKernelArgInfoAndRegisterParameter(uint32_t argCount) {
         if (kernelArgInfo.size() <= argCount) {
             kernelArgInfo.resize(argCount + 1);
@@ -213,6 +215,7 @@ struct KernelInfo {
     }
 
     bool createKernelAllocation(MemoryManager *memoryManager);
+    bool createKernelAllocation(KernelIsaPool &isaPool);
 
     std::string name;
     std::string attributes;
@@ -225,6 +228,7 @@ struct KernelInfo {
     bool usesSsh = false;
     bool requiresSshForBuffers = false;
     bool isValid = false;
+    bool isMaterialized = true;
     bool isVmeWorkload = false;
     char *crossThreadData = nullptr;
     size_t reqdWorkGroupSize[3];
@@ -238,6 +242,9 @@ struct KernelInfo {
     uint64_t kernelId = 0;
     bool isKernelHeapSubstituted = false;
     GraphicsAllocation *kernelAllocation = nullptr;
+    // offset of ISA within kernelAllocation, non-zero only when the allocation is shared with other kernels
+    uint32_t kernelAllocationOffset = 0;
+    bool isKernelAllocationShared = false;
     DebugData debugData;
     bool computeMode = false;
 };
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/program/kernel_isa_pool.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/helpers/string.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/memory_manager/memory_manager.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCLRT {
+const size_t KernelIsaPool::isaAlignment;
+const size_t KernelIsaPool::isaPrefetchPadding;
+const size_t KernelIsaPool::minChunkSize;
+
+KernelIsaPool::KernelIsaPool(MemoryManager &memoryManager) : memoryManager(memoryManager) {
+}
+
+KernelIsaPool::~KernelIsaPool() {
+    for (auto chunk : chunks) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(chunk);
+    }
+}
+
+size_t KernelIsaPool::getSlotSize(size_t isaSize) {
+    return alignUp(isaSize + isaPrefetchPadding, isaAlignment);
+}
+
+void KernelIsaPool::reserve(size_t size) {
+    reservedSize = size;
+}
+
+GraphicsAllocation *KernelIsaPool::allocate(const void *isa, size_t isaSize, uint32_t &offset) {
+    auto slotSize = getSlotSize(isaSize);
+
+    if (chunks.empty() || usedInLastChunk + slotSize > chunks.back()->getUnderlyingBufferSize()) {
+        auto chunkSize = std::max(slotSize, reservedSize ? reservedSize : minChunkSize);
+        auto chunk = memoryManager.allocate32BitGraphicsMemory(chunkSize, nullptr, AllocationOrigin::INTERNAL_ALLOCATION);
+        if (!chunk) {
+            return nullptr;
+        }
+        chunks.push_back(chunk);
+        usedInLastChunk = 0;
+        reservedSize = 0;
+    }
+
+    auto chunk = chunks.back();
+    auto slot = ptrOffset(chunk->getUnderlyingBuffer(), usedInLastChunk);
+    memcpy_s(slot, slotSize, isa, isaSize);
+    memset(ptrOffset(slot, isaSize), 0, slotSize - isaSize);
+
+    offset = static_cast<uint32_t>(usedInLastChunk);
+    usedInLastChunk += slotSize;
+    return chunk;
+}
+} // namespace OCLRT
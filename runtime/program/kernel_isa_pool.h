@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/basic_math.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OCLRT {
+class GraphicsAllocation;
+class MemoryManager;
+
+// Packs ISA of many kernels into few 32-bit instruction heap allocations, each kernel gets an aligned slot
+// followed by padding, so instruction prefetch past the last instruction stays inside the allocation.
+class KernelIsaPool {
+  public:
+    static const size_t isaAlignment = 64;
+    static const size_t isaPrefetchPadding = 512;
+    static const size_t minChunkSize = 64 * KB;
+
+    KernelIsaPool(MemoryManager &memoryManager);
+    ~KernelIsaPool();
+
+    KernelIsaPool(const KernelIsaPool &) = delete;
+    KernelIsaPool &operator=(const KernelIsaPool &) = delete;
+
+    static size_t getSlotSize(size_t isaSize);
+
+    // next chunk is created big enough for the given number of bytes, so a whole program fits in one allocation
+    void reserve(size_t size);
+    GraphicsAllocation *allocate(const void *isa, size_t isaSize, uint32_t &offset);
+
+    size_t getChunksCount() const { return chunks.size(); }
+
+  protected:
+    MemoryManager &memoryManager;
+    std::vector<GraphicsAllocation *> chunks;
+    size_t usedInLastChunk = 0;
+    size_t reservedSize = 0;
+};
+} // namespace OCLRT
@@ -9,6 +9,7 @@
 #include "elf/reader.h"
 #include "elf/writer.h"
 #include "program.h"
+#include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/string.h"
 
 namespace OCLRT {
@@ -21,11 +22,9 @@ cl_int Program::processElfBinary(
 
     binaryVersion = iOpenCL::CURRENT_ICBE_VERSION;
 
-    elfBinarySize = binarySize;
-    elfBinary = CLElfLib::ElfBinaryStorage(reinterpret_cast<const char *>(pBinary), reinterpret_cast<const char *>(reinterpret_cast<const char *>(pBinary) + binarySize));
-
     try {
-        CLElfLib::CElfReader elfReader(elfBinary);
+        // binary is validated in place, it is copied only once it is known to be used
+        CLElfLib::CElfReaderView elfReader(reinterpret_cast<const char *>(pBinary), binarySize);
 
         pElfHeader = elfReader.getElfHeader();
 
@@ -45,32 +44,45 @@ cl_int Program::processElfBinary(
         default:
             return CL_INVALID_BINARY;
         }
+        // multi-target ELF holds one device binary section per target, the best match for pDevice is used
+        CLElfLib::SSectionView devBinarySection;
+        CLElfLib::SSectionView irBinarySection;
+        DevBinarySectionMatch devBinarySectionMatch = DevBinarySectionMatch::AnyEnabledFamily;
+        size_t devBinarySectionsCount = 0;
+        uint32_t devBinaryVersion = binaryVersion;
+        bool isIrSpirV = false;
+
         // section 0 is always null
-        for (size_t i = 1u; i < elfReader.getSectionHeaders().size(); ++i) {
-            const auto &sectionHeader = elfReader.getSectionHeaders()[i];
-            switch (sectionHeader.Type) {
+        for (size_t i = 1u; i < elfReader.getNumSections(); ++i) {
+            const auto section = elfReader.getSection(i);
+            switch (section.type) {
             case CLElfLib::E_SH_TYPE::SH_TYPE_SPIRV:
-                isSpirV = true;
+                isIrSpirV = true;
                 CPP_ATTRIBUTE_FALLTHROUGH;
             case CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_LLVM_BINARY:
-                if (sectionHeader.DataSize > 0) {
-                    storeIrBinary(elfReader.getSectionData(sectionHeader.DataOffset), static_cast<size_t>(sectionHeader.DataSize), isSpirV);
+                if (section.dataSize > 0) {
+                    irBinarySection = section;
                 }
                 break;
 
-            case CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY:
-                if (sectionHeader.DataSize > 0 && validateGenBinaryHeader(reinterpret_cast<SProgramBinaryHeader *>(elfReader.getSectionData(sectionHeader.DataOffset)))) {
-                    storeGenBinary(elfReader.getSectionData(sectionHeader.DataOffset), static_cast<size_t>(sectionHeader.DataSize));
-                    isCreatedFromBinary = true;
-                } else {
-                    getProgramCompilerVersion(reinterpret_cast<SProgramBinaryHeader *>(elfReader.getSectionData(sectionHeader.DataOffset)), binaryVersion);
-                    return CL_INVALID_BINARY;
+            case CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY: {
+                devBinarySectionsCount++;
+                auto pGenBinaryHeader = reinterpret_cast<SProgramBinaryHeader *>(const_cast<char *>(section.data));
+                if (section.dataSize > 0 && validateGenBinaryHeader(pGenBinaryHeader)) {
+                    auto match = getDevBinarySectionMatch(pGenBinaryHeader, section.name);
+                    if (devBinarySection.data == nullptr || match > devBinarySectionMatch) {
+                        devBinarySection = section;
+                        devBinarySectionMatch = match;
+                    }
+                } else if (devBinarySectionsCount == 1) {
+                    getProgramCompilerVersion(pGenBinaryHeader, devBinaryVersion);
                 }
                 break;
+            }
 
             case CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_OPTIONS:
-                if (sectionHeader.DataSize > 0) {
-                    options = std::string(elfReader.getSectionData(sectionHeader.DataOffset), static_cast<size_t>(sectionHeader.DataSize));
+                if (section.dataSize > 0) {
+                    options = std::string(section.data, section.dataSize);
                 }
                 break;
 
@@ -83,7 +95,43 @@ cl_int Program::processElfBinary(
             }
         }
 
-        isProgramBinaryResolved = true;
+        if (devBinarySectionsCount > 0 && devBinarySection.data == nullptr) {
+            binaryVersion = devBinaryVersion;
+            return CL_INVALID_BINARY;
+        }
+
+        if (isIrSpirV) {
+            isSpirV = true;
+        }
+
+        // sections of previous binary may still point into elfBinary
+        releaseElfBinaryViews();
+
+        if (devBinarySectionsCount <= 1) {
+            // single copy of the binary is kept for clGetProgramInfo, gen and IR binaries point into it
+            elfBinarySize = binarySize;
+            elfBinary = CLElfLib::ElfBinaryStorage(elfReader.getBinary(), elfReader.getBinary() + binarySize);
+            if (irBinarySection.data != nullptr) {
+                setIrBinaryView(elfBinary.data() + (irBinarySection.data - elfReader.getBinary()), irBinarySection.dataSize, isSpirV);
+            }
+            if (devBinarySection.data != nullptr) {
+                setGenBinaryView(elfBinary.data() + (devBinarySection.data - elfReader.getBinary()), devBinarySection.dataSize);
+            }
+            isProgramBinaryResolved = true;
+        } else {
+            // only the selected target is copied from multi-target binary, binary queried from program is resolved from it
+            elfBinary.clear();
+            elfBinarySize = 0;
+            if (irBinarySection.data != nullptr) {
+                storeIrBinary(irBinarySection.data, irBinarySection.dataSize, isSpirV);
+            }
+            storeGenBinary(devBinarySection.data, devBinarySection.dataSize);
+            isProgramBinaryResolved = false;
+        }
+
+        if (devBinarySection.data != nullptr) {
+            isCreatedFromBinary = true;
+        }
 
         // Create an empty build log since program is effectively built
         updateBuildLog(pDevice, "", 1);
@@ -94,10 +142,41 @@ cl_int Program::processElfBinary(
     return CL_SUCCESS;
 }
 
+void Program::releaseElfBinaryViews() {
+    if (genBinaryIsElfView) {
+        auto pView = genBinary;
+        genBinary = nullptr;
+        genBinaryIsElfView = false;
+        storeBinary(genBinary, genBinarySize, pView, genBinarySize);
+    }
+    if (irBinaryIsElfView) {
+        auto pView = irBinary;
+        irBinary = nullptr;
+        irBinaryIsElfView = false;
+        storeBinary(irBinary, irBinarySize, pView, irBinarySize);
+    }
+}
+
+Program::DevBinarySectionMatch Program::getDevBinarySectionMatch(const SProgramBinaryHeader *pGenBinaryHeader, const char *sectionName) const {
+    if (pDevice == nullptr) {
+        return DevBinarySectionMatch::AnyEnabledFamily;
+    }
+    const auto &hwInfo = pDevice->getHardwareInfo();
+    if (pGenBinaryHeader->Device != static_cast<uint32_t>(hwInfo.pPlatform->eRenderCoreFamily)) {
+        return DevBinarySectionMatch::AnyEnabledFamily;
+    }
+    auto productName = hardwarePrefix[hwInfo.pPlatform->eProductFamily];
+    if (productName != nullptr && std::string(CLElfLib::devBinarySectionNamePrefix) + productName == sectionName) {
+        return DevBinarySectionMatch::Product;
+    }
+    return DevBinarySectionMatch::CoreFamily;
+}
+
 cl_int Program::resolveProgramBinary() {
     CLElfLib::E_EH_TYPE headerType;
 
     if (isProgramBinaryResolved == false) {
+        releaseElfBinaryViews();
         elfBinary.clear();
         elfBinarySize = 0;
 
@@ -16,6 +16,8 @@
 #include "runtime/helpers/string.h"
 #include "runtime/kernel/kernel.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/platform/platform.h"
+#include "runtime/utilities/worker_pool.h"
 #include "runtime/gtpin/gtpin_notify.h"
 
 #include <algorithm>
@@ -26,24 +28,49 @@ namespace OCLRT {
 extern bool familyEnabled[];
 
 const KernelInfo *Program::getKernelInfo(
-    const char *kernelName) const {
-    if (kernelName == nullptr) {
-        return nullptr;
+    const char *kernelName, cl_int *errcodeRet) const {
+    auto it = kernelInfoArray.end();
+    if (kernelName != nullptr) {
+        it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
+                          [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->name.c_str(), kernelName)); });
     }
 
-    auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
-                           [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->name.c_str(), kernelName)); });
-
-    return (it != kernelInfoArray.end()) ? *it : nullptr;
+    if (it == kernelInfoArray.end()) {
+        if (errcodeRet) {
+            *errcodeRet = CL_INVALID_KERNEL_NAME;
+        }
+        return nullptr;
+    }
+    return getMaterializedKernelInfo(*it, errcodeRet);
 }
 
 size_t Program::getNumKernels() const {
     return kernelInfoArray.size();
 }
 
-const KernelInfo *Program::getKernelInfo(size_t ordinal) const {
+const KernelInfo *Program::getKernelInfo(size_t ordinal, cl_int *errcodeRet) const {
     DEBUG_BREAK_IF(ordinal >= kernelInfoArray.size());
-    return kernelInfoArray[ordinal];
+    return getMaterializedKernelInfo(kernelInfoArray[ordinal], errcodeRet);
+}
+
+// with lazy materialization patch tokens are parsed here instead of at build,
+// invalid ones are reported as CL_INVALID_PROGRAM_EXECUTABLE and failed ISA upload as CL_OUT_OF_HOST_MEMORY
+const KernelInfo *Program::getMaterializedKernelInfo(const KernelInfo *kernelInfo, cl_int *errcodeRet) const {
+    cl_int retVal = CL_SUCCESS;
+    if (lazyKernelMaterialization) {
+        std::lock_guard<std::mutex> lock(kernelMaterializationMutex);
+        if (!kernelInfo->isMaterialized) {
+            retVal = const_cast<Program *>(this)->materializeKernel(*const_cast<KernelInfo *>(kernelInfo));
+        }
+    }
+
+    if (retVal != CL_SUCCESS && retVal != CL_OUT_OF_HOST_MEMORY) {
+        retVal = CL_INVALID_PROGRAM_EXECUTABLE;
+    }
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return (retVal == CL_SUCCESS) ? kernelInfo : nullptr;
 }
 
 std::string Program::getKernelNamesString() const {
@@ -71,72 +98,231 @@ size_t Program::processKernel(
             break;
         }
 
-        auto pCurKernelPtr = pKernelBlob;
-        pKernelInfo->heapInfo.pBlob = pKernelBlob;
+        sizeProcessed = readKernelHeaps(*pKernelInfo, pKernelBlob);
 
-        pKernelInfo->heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
+        if (isMaterializationDeferred(*pKernelInfo)) {
+            // patch tokens, checksum and ISA allocation are handled on first getKernelInfo() for this kernel
+            pKernelInfo->isMaterialized = false;
+        } else {
+            retVal = materializeKernel(*pKernelInfo);
+            if (retVal != CL_SUCCESS) {
+                delete pKernelInfo;
+                break;
+            }
+        }
 
-        std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), pKernelInfo->heapInfo.pKernelHeader->KernelNameSize};
-        pKernelInfo->name = readName.c_str();
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelNameSize);
+        retVal = CL_SUCCESS;
+        addKernelInfo(pKernelInfo);
+    } while (false);
 
-        pKernelInfo->heapInfo.pKernelHeap = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize);
+    return sizeProcessed;
+}
 
-        pKernelInfo->heapInfo.pGsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->GeneralStateHeapSize);
+size_t Program::readKernelHeaps(KernelInfo &kernelInfo, const void *pKernelBlob) const {
+    auto pCurKernelPtr = pKernelBlob;
+    kernelInfo.heapInfo.pBlob = pKernelBlob;
 
-        pKernelInfo->heapInfo.pDsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->DynamicStateHeapSize);
+    kernelInfo.heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
 
-        pKernelInfo->heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->SurfaceStateHeapSize);
+    std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), kernelInfo.heapInfo.pKernelHeader->KernelNameSize};
+    kernelInfo.name = readName.c_str();
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->KernelNameSize);
 
-        pKernelInfo->heapInfo.pPatchList = pCurKernelPtr;
+    kernelInfo.heapInfo.pKernelHeap = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->KernelHeapSize);
 
-        retVal = parsePatchList(*pKernelInfo);
-        if (retVal != CL_SUCCESS) {
-            delete pKernelInfo;
-            sizeProcessed = ptrDiff(pCurKernelPtr, pKernelBlob);
-            break;
-        }
+    kernelInfo.heapInfo.pGsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->GeneralStateHeapSize);
 
-        auto pKernelHeader = pKernelInfo->heapInfo.pKernelHeader;
-        auto pKernel = ptrOffset(pKernelBlob, sizeof(SKernelBinaryHeaderCommon));
+    kernelInfo.heapInfo.pDsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->DynamicStateHeapSize);
 
-        if (genBinary)
-            pKernelInfo->gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
+    kernelInfo.heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->SurfaceStateHeapSize);
 
-        uint32_t kernelSize =
-            pKernelHeader->DynamicStateHeapSize +
-            pKernelHeader->GeneralStateHeapSize +
-            pKernelHeader->KernelHeapSize +
-            pKernelHeader->KernelNameSize +
-            pKernelHeader->PatchListSize +
-            pKernelHeader->SurfaceStateHeapSize;
+    kernelInfo.heapInfo.pPatchList = pCurKernelPtr;
 
-        pKernelInfo->heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
+    auto pKernelHeader = kernelInfo.heapInfo.pKernelHeader;
 
-        uint32_t kernelCheckSum = pKernelInfo->heapInfo.pKernelHeader->CheckSum;
+    if (genBinary)
+        kernelInfo.gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
 
-        uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelSize);
+    uint32_t kernelSize =
+        pKernelHeader->DynamicStateHeapSize +
+        pKernelHeader->GeneralStateHeapSize +
+        pKernelHeader->KernelHeapSize +
+        pKernelHeader->KernelNameSize +
+        pKernelHeader->PatchListSize +
+        pKernelHeader->SurfaceStateHeapSize;
 
-        uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
-        pKernelInfo->isValid = (calcCheckSum == kernelCheckSum);
+    kernelInfo.heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
 
-        retVal = CL_SUCCESS;
-        sizeProcessed = sizeof(SKernelBinaryHeaderCommon) + kernelSize;
-        kernelInfoArray.push_back(pKernelInfo);
-        if (pKernelInfo->hasDeviceEnqueue()) {
-            parentKernelInfoArray.push_back(pKernelInfo);
+    return kernelInfo.heapInfo.blobSize;
+}
+
+void Program::addKernelInfo(KernelInfo *pKernelInfo) {
+    kernelInfoArray.push_back(pKernelInfo);
+    if (pKernelInfo->hasDeviceEnqueue()) {
+        parentKernelInfoArray.push_back(pKernelInfo);
+    }
+    if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
+        subgroupKernelInfoArray.push_back(pKernelInfo);
+    }
+}
+
+cl_int Program::processKernelsInParallel(const std::vector<const void *> &kernelBlobs, WorkerPool &workerPool) {
+    struct ParsedKernel {
+        KernelInfo *kernelInfo = nullptr;
+        cl_int retVal = CL_SUCCESS;
+        bool deferred = false;
+    };
+    std::vector<ParsedKernel> parsedKernels(kernelBlobs.size());
+
+    if (pDevice) {
+        // device creates SLM window on first request, do it here instead of racing for it from workers
+        pDevice->prepareSLMWindow();
+    }
+
+    workerPool.parallelFor(kernelBlobs.size(), [&](size_t index) {
+        auto &parsedKernel = parsedKernels[index];
+        parsedKernel.kernelInfo = new KernelInfo();
+        readKernelHeaps(*parsedKernel.kernelInfo, kernelBlobs[index]);
+        parsedKernel.deferred = isMaterializationDeferred(*parsedKernel.kernelInfo);
+        if (!parsedKernel.deferred) {
+            parsedKernel.retVal = parseKernel(*parsedKernel.kernelInfo);
         }
-        if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
-            subgroupKernelInfoArray.push_back(pKernelInfo);
+    });
+
+    // ISA is uploaded in kernel order, so kernel ISA pool layout does not depend on worker scheduling
+    cl_int retVal = CL_SUCCESS;
+    for (auto &parsedKernel : parsedKernels) {
+        auto pKernelInfo = parsedKernel.kernelInfo;
+        if (retVal == CL_SUCCESS) {
+            retVal = parsedKernel.retVal;
         }
-    } while (false);
+        if (retVal == CL_SUCCESS) {
+            if (parsedKernel.deferred) {
+                pKernelInfo->isMaterialized = false;
+            } else {
+                retVal = createKernelIsaAllocation(*pKernelInfo);
+                pKernelInfo->isMaterialized = true;
+            }
+        }
+        if (retVal == CL_SUCCESS) {
+            addKernelInfo(pKernelInfo);
+        } else {
+            delete pKernelInfo;
+        }
+    }
 
-    return sizeProcessed;
+    return retVal;
+}
+
+bool Program::getKernelBlobs(const void *pKernelBlob, uint32_t numKernels, std::vector<const void *> &kernelBlobs) const {
+    size_t remainingSize = genBinarySize - ptrDiff(pKernelBlob, genBinary);
+    kernelBlobs.reserve(std::min(static_cast<size_t>(numKernels), remainingSize / sizeof(SKernelBinaryHeaderCommon)));
+    for (uint32_t i = 0; i < numKernels; i++) {
+        if (remainingSize < sizeof(SKernelBinaryHeaderCommon)) {
+            return false;
+        }
+        auto pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pKernelBlob);
+        size_t blobSize = sizeof(SKernelBinaryHeaderCommon) +
+                          pKernelHeader->KernelNameSize +
+                          pKernelHeader->KernelHeapSize +
+                          pKernelHeader->GeneralStateHeapSize +
+                          pKernelHeader->DynamicStateHeapSize +
+                          pKernelHeader->SurfaceStateHeapSize +
+                          pKernelHeader->PatchListSize;
+        if (blobSize > remainingSize) {
+            return false;
+        }
+        kernelBlobs.push_back(pKernelBlob);
+        pKernelBlob = ptrOffset(pKernelBlob, blobSize);
+        remainingSize -= blobSize;
+    }
+    return true;
+}
+
+size_t Program::getKernelIsaPoolSize(const std::vector<const void *> &kernelBlobs) const {
+    size_t poolSize = 0;
+    for (auto pKernelBlob : kernelBlobs) {
+        auto kernelHeapSize = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pKernelBlob)->KernelHeapSize;
+        if (kernelHeapSize) {
+            poolSize += KernelIsaPool::getSlotSize(kernelHeapSize);
+        }
+    }
+    return poolSize;
+}
+
+bool Program::isMaterializationDeferred(const KernelInfo &kernelInfo) const {
+    return lazyKernelMaterialization && !isMaterializationRequiredAtLoad(kernelInfo);
+}
+
+bool Program::isMaterializationRequiredAtLoad(const KernelInfo &kernelInfo) const {
+    // block kernels and their parents are paired by separateBlockKernels() right after load
+    if (kernelInfo.name.find("_dispatch_") != std::string::npos) {
+        return true;
+    }
+
+    auto pCurPatchListPtr = kernelInfo.heapInfo.pPatchList;
+    auto pPatchListEnd = ptrOffset(pCurPatchListPtr, kernelInfo.heapInfo.pKernelHeader->PatchListSize);
+    while (ptrDiff(pPatchListEnd, pCurPatchListPtr) >= sizeof(SPatchItemHeader)) {
+        auto pPatch = reinterpret_cast<const SPatchItemHeader *>(pCurPatchListPtr);
+        if (pPatch->Size < sizeof(SPatchItemHeader)) {
+            // malformed patch list, let parsePatchList() report it at load
+            return true;
+        }
+        if (pPatch->Token == PATCH_TOKEN_EXECUTION_ENVIRONMENT) {
+            auto pExecutionEnvironment = reinterpret_cast<const SPatchExecutionEnvironment *>(pPatch);
+            return pExecutionEnvironment->HasDeviceEnqueue || pExecutionEnvironment->SubgroupIndependentForwardProgressRequired;
+        }
+        pCurPatchListPtr = ptrOffset(pCurPatchListPtr, pPatch->Size);
+    }
+    return false;
+}
+
+cl_int Program::materializeKernel(KernelInfo &kernelInfo) {
+    auto retVal = parseKernel(kernelInfo);
+    if (retVal == CL_SUCCESS) {
+        retVal = createKernelIsaAllocation(kernelInfo);
+    }
+    if (retVal != CL_SUCCESS) {
+        // next query parses patch list again, it must not see arguments stored by this attempt
+        kernelInfo.resetPatchListState();
+        return retVal;
+    }
+    kernelInfo.isMaterialized = true;
+
+    return CL_SUCCESS;
+}
+
+cl_int Program::parseKernel(KernelInfo &kernelInfo) {
+    auto retVal = parsePatchList(kernelInfo);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    auto pKernel = ptrOffset(kernelInfo.heapInfo.pBlob, sizeof(SKernelBinaryHeaderCommon));
+    uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelInfo.heapInfo.blobSize - sizeof(SKernelBinaryHeaderCommon));
+
+    uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
+    kernelInfo.isValid = (calcCheckSum == kernelInfo.heapInfo.pKernelHeader->CheckSum);
+
+    return CL_SUCCESS;
+}
+
+cl_int Program::createKernelIsaAllocation(KernelInfo &kernelInfo) {
+    cl_int retVal = CL_SUCCESS;
+    if (kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
+        auto allocationCreated = kernelIsaPool ? kernelInfo.createKernelAllocation(*kernelIsaPool)
+                                               : kernelInfo.createKernelAllocation(this->pDevice->getMemoryManager());
+        retVal = allocationCreated ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+    }
+
+    DEBUG_BREAK_IF(kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
+
+    return retVal;
 }
 
 cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
@@ -825,12 +1011,6 @@ cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
         }
     }
 
-    if (kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
-        retVal = kernelInfo.createKernelAllocation(this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
-    }
-
-    DEBUG_BREAK_IF(kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
-
     return retVal;
 }
 
@@ -985,6 +1165,26 @@ cl_int Program::processGenBinary() {
         pCurBinaryPtr = ptrOffset(pCurBinaryPtr, pGenBinaryHeader->PatchListSize);
 
         auto numKernels = pGenBinaryHeader->NumberOfKernels;
+        auto lazyThreshold = DebugManager.flags.LazyKernelMaterializationThreshold.get();
+        lazyKernelMaterialization = lazyThreshold >= 0 && numKernels >= static_cast<uint32_t>(lazyThreshold) && !isKernelDebugEnabled();
+
+        std::vector<const void *> kernelBlobs;
+        auto allKernelBlobsFound = getKernelBlobs(pCurBinaryPtr, numKernels, kernelBlobs);
+
+        if (numKernels > 1 && pDevice && DebugManager.flags.EnableKernelIsaPool.get()) {
+            if (!kernelIsaPool) {
+                kernelIsaPool.reset(new KernelIsaPool(*pDevice->getMemoryManager()));
+            }
+            kernelIsaPool->reserve(getKernelIsaPoolSize(kernelBlobs));
+        }
+
+        auto parallelThreshold = DebugManager.flags.ParallelKernelParsingThreshold.get();
+        if (retVal == CL_SUCCESS && allKernelBlobsFound && numKernels > 1 && parallelThreshold >= 0 &&
+            numKernels >= static_cast<uint32_t>(parallelThreshold) && platform()) {
+            retVal = processKernelsInParallel(kernelBlobs, *platform()->getBuildWorkerPool());
+            break;
+        }
+
         for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
 
             size_t bytesProcessed = processKernel(pCurBinaryPtr, retVal);
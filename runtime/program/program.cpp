@@ -89,9 +89,15 @@ Program::Program(ExecutionEnvironment &executionEnvironment, Context *context, b
 }
 
 Program::~Program() {
+    if (genBinaryMapping || genBinaryIsElfView) {
+        genBinary = nullptr;
+    }
     delete[] genBinary;
     genBinary = nullptr;
 
+    if (irBinaryIsElfView) {
+        irBinary = nullptr;
+    }
     delete[] irBinary;
     irBinary = nullptr;
 
@@ -103,6 +109,7 @@ Program::~Program() {
     cleanCurrentKernelInfo();
 
     freeBlockResources();
+    kernelIsaPool.reset();
 
     delete blockKernelManager;
 
@@ -257,17 +264,61 @@ cl_int Program::getSource(std::string &binary) const {
 void Program::storeGenBinary(
     const void *pSrc,
     const size_t srcSize) {
+    if (genBinaryMapping || genBinaryIsElfView) {
+        genBinary = nullptr;
+        genBinaryMapping.reset();
+        genBinaryIsElfView = false;
+    }
     storeBinary(genBinary, genBinarySize, pSrc, srcSize);
 }
 
+void Program::storeGenBinary(std::unique_ptr<MappedFile> mappedBinary) {
+    DEBUG_BREAK_IF(!mappedBinary);
+
+    if (!genBinaryMapping && !genBinaryIsElfView) {
+        delete[] genBinary;
+    }
+    genBinary = mappedBinary->data();
+    genBinarySize = mappedBinary->size();
+    genBinaryMapping = std::move(mappedBinary);
+    genBinaryIsElfView = false;
+}
+
+void Program::setGenBinaryView(char *pView, size_t viewSize) {
+    DEBUG_BREAK_IF(genBinaryIsElfView);
+
+    if (genBinaryMapping) {
+        genBinary = nullptr;
+        genBinaryMapping.reset();
+    }
+    delete[] genBinary;
+    genBinary = pView;
+    genBinarySize = viewSize;
+    genBinaryIsElfView = true;
+}
+
 void Program::storeIrBinary(
     const void *pSrc,
     const size_t srcSize,
     bool isSpirV) {
+    if (irBinaryIsElfView) {
+        irBinary = nullptr;
+        irBinaryIsElfView = false;
+    }
     storeBinary(irBinary, irBinarySize, pSrc, srcSize);
     this->isSpirV = isSpirV;
 }
 
+void Program::setIrBinaryView(char *pView, size_t viewSize, bool isSpirV) {
+    DEBUG_BREAK_IF(irBinaryIsElfView);
+
+    delete[] irBinary;
+    irBinary = pView;
+    irBinarySize = viewSize;
+    irBinaryIsElfView = true;
+    this->isSpirV = isSpirV;
+}
+
 void Program::storeDebugData(
     const void *pSrc,
     const size_t srcSize) {
@@ -394,7 +445,7 @@ void Program::freeBlockResources() {
         }
         auto kernelInfo = blockKernelManager->getBlockKernelInfo(i);
         DEBUG_BREAK_IF(!kernelInfo->kernelAllocation);
-        if (kernelInfo->kernelAllocation) {
+        if (kernelInfo->kernelAllocation && !kernelInfo->isKernelAllocationShared) {
             this->executionEnvironment.memoryManager->freeGraphicsMemory(kernelInfo->kernelAllocation);
         }
     }
@@ -402,12 +453,17 @@ void Program::freeBlockResources() {
 
 void Program::cleanCurrentKernelInfo() {
     for (auto &kernelInfo : kernelInfoArray) {
-        if (kernelInfo->kernelAllocation) {
+        if (kernelInfo->kernelAllocation && !kernelInfo->isKernelAllocationShared) {
             this->executionEnvironment.memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(kernelInfo->kernelAllocation);
         }
         delete kernelInfo;
     }
     kernelInfoArray.clear();
+
+    // block kernels keep using their slots until the program is destroyed
+    if (blockKernelManager->getCount() == 0) {
+        kernelIsaPool.reset();
+    }
 }
 
 void Program::updateNonUniformFlag() {
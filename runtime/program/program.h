@@ -9,17 +9,22 @@
 #include "block_kernel_manager.h"
 #include "elf/reader.h"
 #include "kernel_info.h"
+#include "kernel_isa_pool.h"
 #include "runtime/api/cl_types.h"
 #include "runtime/device/device.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/stdio.h"
 #include "runtime/helpers/string_helpers.h"
+#include "runtime/utilities/mapped_file.h"
 #include "elf/writer.h"
 #include "igfxfmid.h"
 #include "patch_list.h"
+#include <atomic>
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #define OCLRT_ALIGN(a, b) ((((a) % (b)) != 0) ? ((a) - ((a) % (b)) + (b)) : (a))
 
@@ -27,6 +32,7 @@ namespace OCLRT {
 class Context;
 class CompilerInterface;
 class ExecutionEnvironment;
+class WorkerPool;
 template <>
 struct OpenCLObjectMapper<_cl_program> {
     typedef class Program DerivedType;
@@ -109,8 +115,9 @@ class Program : public BaseObject<_cl_program> {
                 void *userData);
 
     size_t getNumKernels() const;
-    const KernelInfo *getKernelInfo(const char *kernelName) const;
-    const KernelInfo *getKernelInfo(size_t ordinal) const;
+    // errcodeRet reports why nullptr is returned: unknown name or kernel that failed to materialize
+    const KernelInfo *getKernelInfo(const char *kernelName, cl_int *errcodeRet = nullptr) const;
+    const KernelInfo *getKernelInfo(size_t ordinal, cl_int *errcodeRet = nullptr) const;
 
     cl_int getInfo(cl_program_info paramName, size_t paramValueSize,
                    void *paramValue, size_t *paramValueSizeRet);
@@ -154,6 +161,7 @@ class Program : public BaseObject<_cl_program> {
     cl_int getSource(std::string &binary) const;
 
     void storeGenBinary(const void *pSrc, const size_t srcSize);
+    void storeGenBinary(std::unique_ptr<MappedFile> mappedBinary);
 
     char *getGenBinary(size_t &genBinarySize) const {
         genBinarySize = this->genBinarySize;
@@ -236,6 +244,9 @@ class Program : public BaseObject<_cl_program> {
 
     MOCKABLE_VIRTUAL cl_int createProgramFromBinary(const void *pBinary, size_t binarySize);
 
+    cl_int buildBinary(const char *buildOptions, bool enableCaching);
+    void completeBuild(cl_int retVal, void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+
     bool optionsAreNew(const char *options) const;
 
     cl_int processElfHeader(const CLElfLib::SElf64Header *pElfHeader,
@@ -245,6 +256,11 @@ class Program : public BaseObject<_cl_program> {
 
     cl_int resolveProgramBinary();
 
+    // gen and IR binaries of program loaded from ELF point into elfBinary instead of holding own copy
+    void setGenBinaryView(char *pView, size_t viewSize);
+    void setIrBinaryView(char *pView, size_t viewSize, bool isSpirV);
+    void releaseElfBinaryViews();
+
     cl_int parseProgramScopePatchList();
 
     MOCKABLE_VIRTUAL cl_int rebuildProgramFromIr();
@@ -252,12 +268,31 @@ class Program : public BaseObject<_cl_program> {
     cl_int parsePatchList(KernelInfo &pKernelInfo);
 
     size_t processKernel(const void *pKernelBlob, cl_int &retVal);
+    size_t readKernelHeaps(KernelInfo &kernelInfo, const void *pKernelBlob) const;
+    void addKernelInfo(KernelInfo *pKernelInfo);
+    cl_int processKernelsInParallel(const std::vector<const void *> &kernelBlobs, WorkerPool &workerPool);
+
+    bool isMaterializationRequiredAtLoad(const KernelInfo &kernelInfo) const;
+    bool isMaterializationDeferred(const KernelInfo &kernelInfo) const;
+    cl_int materializeKernel(KernelInfo &kernelInfo);
+    cl_int parseKernel(KernelInfo &kernelInfo);
+    cl_int createKernelIsaAllocation(KernelInfo &kernelInfo);
+    const KernelInfo *getMaterializedKernelInfo(const KernelInfo *kernelInfo, cl_int *errcodeRet) const;
+    bool getKernelBlobs(const void *pKernelBlob, uint32_t numKernels, std::vector<const void *> &kernelBlobs) const;
+    size_t getKernelIsaPoolSize(const std::vector<const void *> &kernelBlobs) const;
 
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
 
     bool validateGenBinaryDevice(GFXCORE_FAMILY device) const;
     bool validateGenBinaryHeader(const iOpenCL::SProgramBinaryHeader *pGenBinaryHeader) const;
 
+    enum class DevBinarySectionMatch {
+        AnyEnabledFamily,
+        CoreFamily,
+        Product
+    };
+    DevBinarySectionMatch getDevBinarySectionMatch(const iOpenCL::SProgramBinaryHeader *pGenBinaryHeader, const char *sectionName) const;
+
     std::string getKernelNamesString() const;
 
     void separateBlockKernels();
@@ -277,9 +312,12 @@ class Program : public BaseObject<_cl_program> {
 
     char*                     genBinary;
     size_t                    genBinarySize;
+    std::unique_ptr<MappedFile> genBinaryMapping;
+    bool                      genBinaryIsElfView = false;
 
     char*                     irBinary;
     size_t                    irBinarySize;
+    bool                      irBinaryIsElfView = false;
 
     char*                     debugData;
     size_t                    debugDataSize;
@@ -289,6 +327,10 @@ class Program : public BaseObject<_cl_program> {
     std::vector<KernelInfo*>  subgroupKernelInfoArray;
     BlockKernelManager *      blockKernelManager;
 
+    std::unique_ptr<KernelIsaPool> kernelIsaPool;
+    bool                      lazyKernelMaterialization = false;
+    mutable std::mutex        kernelMaterializationMutex;
+
     const void*               programScopePatchList;
     size_t                    programScopePatchListSize;
 
@@ -297,7 +339,9 @@ class Program : public BaseObject<_cl_program> {
 
     size_t                    globalVarTotalSize;
 
-    cl_build_status           buildStatus;
+    std::atomic<cl_build_status> buildStatus;
+    // held while build updates options, build log, binaries and kernels, queries of them wait for asynchronous build
+    mutable std::mutex        buildMutex;
     bool                      isCreatedFromBinary;
     bool                      isProgramBinaryResolved;
 
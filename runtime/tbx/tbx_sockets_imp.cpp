@@ -8,6 +8,7 @@
 #include "runtime/tbx/tbx_sockets_imp.h"
 #include "runtime/helpers/debug_helpers.h"
 #include "runtime/helpers/string.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 
 #ifdef WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -36,6 +37,7 @@ TbxSocketsImp::TbxSocketsImp(std::ostream &err)
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flush();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -69,6 +71,11 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         }
 #endif
 
+        if (DebugManager.flags.TbxBatchBufferSize.get() > 0) {
+            batchBufferSize = static_cast<size_t>(DebugManager.flags.TbxBatchBufferSize.get());
+            sendBuffer.reserve(batchBufferSize);
+        }
+
         m_socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
         if (m_socket == INVALID_SOCKET) {
             logErrorInfo("Error at socket(): ");
@@ -83,7 +90,7 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msg_type = HAS_CONTROL_REQ_TYPE;
         cmd.hdr.size = sizeof(HAS_CONTROL_REQ);
-        cmd.hdr.trans_id = transID++;
+        cmd.hdr.trans_id = getNextTransID();
 
         cmd.u.control_req.time_adv_mask = 1;
         cmd.u.control_req.time_adv = 0;
@@ -136,7 +143,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msg_type = HAS_MMIO_REQ_TYPE;
         cmd.hdr.size = sizeof(HAS_MMIO_REQ);
-        cmd.hdr.trans_id = transID++;
+        cmd.hdr.trans_id = getNextTransID();
         cmd.u.mmio_req.offset = offset;
         cmd.u.mmio_req.data = 0;
         cmd.u.mmio_req.write = 0;
@@ -174,7 +181,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_MMIO_REQ_TYPE;
     cmd.hdr.size = sizeof(HAS_MMIO_REQ);
-    cmd.hdr.trans_id = transID++;
+    cmd.hdr.trans_id = getNextTransID();
     cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
     cmd.u.mmio_req.offset = offset;
     cmd.u.mmio_req.data = value;
@@ -188,7 +195,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_READ_DATA_REQ_TYPE;
-    cmd.hdr.trans_id = transID++;
+    cmd.hdr.trans_id = getNextTransID();
     cmd.hdr.size = sizeof(HAS_READ_DATA_REQ);
     cmd.u.read_req.address = static_cast<uint32_t>(addrOffset);
     cmd.u.read_req.address_h = static_cast<uint32_t>(addrOffset >> 32);
@@ -228,7 +235,7 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_WRITE_DATA_REQ_TYPE;
-    cmd.hdr.trans_id = transID++;
+    cmd.hdr.trans_id = getNextTransID();
     cmd.hdr.size = sizeof(HAS_WRITE_DATA_REQ);
 
     cmd.u.write_req.address = static_cast<uint32_t>(physAddr);
@@ -263,7 +270,7 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_GTT_REQ_TYPE;
     cmd.hdr.size = sizeof(HAS_GTT64_REQ);
-    cmd.hdr.trans_id = transID++;
+    cmd.hdr.trans_id = getNextTransID();
     cmd.u.gtt64_req.write = 1;
     cmd.u.gtt64_req.offset = offset / sizeof(uint64_t); // the TBX server expects GTT index here, not offset
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
@@ -272,7 +279,36 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
 }
 
+bool TbxSocketsImp::flush() {
+    if (sendBuffer.empty()) {
+        return true;
+    }
+    auto success = sendToSocket(sendBuffer.data(), sendBuffer.size());
+    sendBuffer.clear();
+    return success;
+}
+
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
+    if (batchBufferSize == 0) {
+        return sendToSocket(buffer, sizeInBytes);
+    }
+
+    // requests not expecting a response are only queued, the server sees them
+    // when the batch buffer fills up or before waiting for any response
+    if (sendBuffer.size() + sizeInBytes > batchBufferSize) {
+        if (!flush()) {
+            return false;
+        }
+        if (sizeInBytes >= batchBufferSize) {
+            return sendToSocket(buffer, sizeInBytes);
+        }
+    }
+    auto data = reinterpret_cast<const char *>(buffer);
+    sendBuffer.insert(sendBuffer.end(), data, data + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::sendToSocket(const void *buffer, size_t sizeInBytes) {
     size_t totalSent = 0;
     auto dataBuffer = reinterpret_cast<const char *>(buffer);
 
@@ -288,12 +324,17 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
             return false;
         }
         totalSent += bytesSent;
+        socketSendCalls++;
     } while (totalSent < sizeInBytes);
 
     return true;
 }
 
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
+    if (!flush()) {
+        return false;
+    }
+
     size_t totalRecv = 0;
     auto dataBuffer = reinterpret_cast<char *>(buffer);
 
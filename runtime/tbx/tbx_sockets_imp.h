@@ -9,6 +9,7 @@
 #include "runtime/tbx/tbx_sockets.h"
 #include "os_socket.h"
 #include <iostream>
+#include <vector>
 
 namespace OCLRT {
 
@@ -28,12 +29,17 @@ class TbxSocketsImp : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    bool flush() override;
+
+    uint64_t peekSocketSendCalls() const { return socketSendCalls; }
+
   protected:
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool sendToSocket(const void *buffer, size_t sizeInBytes);
     bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
@@ -41,5 +47,8 @@ class TbxSocketsImp : public TbxSockets {
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+    size_t batchBufferSize = 0;
+    std::vector<char> sendBuffer;
+    uint64_t socketSendCalls = 0;
 };
 } // namespace OCLRT
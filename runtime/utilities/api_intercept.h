@@ -22,10 +22,12 @@
 
 #pragma once
 #include "runtime/utilities/perf_profiler.h"
+#include "runtime/utilities/timeline_tracer.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 
-#define API_ENTER(retValPointer) \
-    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                           \
+    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    TimelineTraceApiWrapper TimelineTraceWrapperForSingleCall(__FUNCTION__)
 #define SYSTEM_ENTER()
 #define SYSTEM_LEAVE(id)
 #define WAIT_ENTER()
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/async_file_writer.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+AsyncFileWriter::AsyncFileWriter(std::ostream &output, size_t bufferSize) : output(output), bufferSize(bufferSize) {
+    DEBUG_BREAK_IF(bufferSize == 0);
+    for (auto &buffer : buffers) {
+        buffer.reserve(bufferSize);
+    }
+    worker = Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    stopWorker();
+}
+
+void AsyncFileWriter::stopWorker() {
+    if (!worker) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!activeBuffer->empty()) {
+        submitActiveBuffer(lock);
+    }
+    waitForPendingBuffer(lock);
+    stopRequested = true;
+    lock.unlock();
+    condition.notify_all();
+
+    worker->join();
+    worker.reset();
+}
+
+void AsyncFileWriter::write(const char *data, size_t size) {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (size > 0) {
+        auto spaceLeft = bufferSize - activeBuffer->size();
+        if (spaceLeft == 0) {
+            submitActiveBuffer(lock);
+            continue;
+        }
+        auto sizeThisIteration = std::min(spaceLeft, size);
+        activeBuffer->insert(activeBuffer->end(), data, data + sizeThisIteration);
+        data += sizeThisIteration;
+        size -= sizeThisIteration;
+    }
+}
+
+void AsyncFileWriter::flush() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!activeBuffer->empty()) {
+        submitActiveBuffer(lock);
+    }
+    waitForPendingBuffer(lock);
+    // worker is idle, so output can be safely touched from this thread
+    output.flush();
+}
+
+void AsyncFileWriter::waitForPendingBuffer(std::unique_lock<std::mutex> &lock) {
+    condition.wait(lock, [this] { return pendingBuffer == nullptr; });
+}
+
+void AsyncFileWriter::submitActiveBuffer(std::unique_lock<std::mutex> &lock) {
+    waitForPendingBuffer(lock);
+    pendingBuffer = activeBuffer;
+    activeBuffer = (activeBuffer == &buffers[0]) ? &buffers[1] : &buffers[0];
+    buffersSubmitted++;
+    condition.notify_all();
+}
+
+void AsyncFileWriter::writeToOutput(const std::vector<char> &buffer) {
+    output.write(buffer.data(), buffer.size());
+}
+
+void *AsyncFileWriter::run(void *arg) {
+    auto self = reinterpret_cast<AsyncFileWriter *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (true) {
+        self->condition.wait(lock, [self] { return self->pendingBuffer != nullptr || self->stopRequested; });
+        if (self->pendingBuffer == nullptr) {
+            break;
+        }
+        auto buffer = self->pendingBuffer;
+        lock.unlock();
+        self->writeToOutput(*buffer);
+        lock.lock();
+        self->bytesWritten += buffer->size();
+        buffer->clear();
+        self->pendingBuffer = nullptr;
+        self->condition.notify_all();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
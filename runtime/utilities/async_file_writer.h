@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace OCLRT {
+class Thread;
+
+// Double-buffered writer - callers fill one staging buffer while a background thread
+// drains the other one to the output stream
+class AsyncFileWriter {
+  public:
+    AsyncFileWriter(std::ostream &output, size_t bufferSize);
+    virtual ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter &) = delete;
+    AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+
+    void write(const char *data, size_t size);
+    void flush();
+
+    size_t getBufferSize() const { return bufferSize; }
+    uint64_t peekBytesWritten() const { return bytesWritten; }
+    uint32_t peekBuffersSubmitted() const { return buffersSubmitted; }
+
+  protected:
+    static void *run(void *arg);
+    void submitActiveBuffer(std::unique_lock<std::mutex> &lock);
+    void waitForPendingBuffer(std::unique_lock<std::mutex> &lock);
+    // drains remaining data and joins the worker, derived writers call it from their destructors
+    void stopWorker();
+    virtual void writeToOutput(const std::vector<char> &buffer);
+
+    std::ostream &output;
+    const size_t bufferSize;
+    std::vector<char> buffers[2];
+    std::vector<char> *activeBuffer = &buffers[0];
+    std::vector<char> *pendingBuffer = nullptr;
+
+    std::mutex mtx;
+    std::condition_variable condition;
+    std::unique_ptr<Thread> worker;
+    bool stopRequested = false;
+
+    std::atomic<uint64_t> bytesWritten{0};
+    std::atomic<uint32_t> buffersSubmitted{0};
+};
+} // namespace OCLRT
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/block_codec.h"
+#include "runtime/utilities/lz4_block_codec.h"
+
+namespace OCLRT {
+
+static BlockCodec *createLz4BlockCodec() {
+    return new Lz4BlockCodec();
+}
+
+BlockCodecCreateFunc blockCodecFactory[static_cast<uint32_t>(BlockCodecType::MaxCodecType)] = {
+    nullptr,
+    createLz4BlockCodec};
+
+std::unique_ptr<BlockCodec> createBlockCodec(uint32_t codecType) {
+    if (codecType >= static_cast<uint32_t>(BlockCodecType::MaxCodecType) || blockCodecFactory[codecType] == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<BlockCodec>(blockCodecFactory[codecType]());
+}
+} // namespace OCLRT
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OCLRT {
+
+enum class BlockCodecType : uint32_t {
+    Lz4 = 1,
+    MaxCodecType
+};
+
+// Compresses independent blocks of data, every block can be decompressed on its own
+class BlockCodec {
+  public:
+    virtual ~BlockCodec() = default;
+
+    virtual BlockCodecType getType() const = 0;
+    // Returns compressed size or 0 when output does not fit into dstCapacity
+    virtual size_t compress(const char *src, size_t srcSize, char *dst, size_t dstCapacity) = 0;
+    // Returns false when src is not a valid block decompressing to exactly dstSize bytes
+    virtual bool decompress(const char *src, size_t srcSize, char *dst, size_t dstSize) = 0;
+};
+
+typedef BlockCodec *(*BlockCodecCreateFunc)();
+extern BlockCodecCreateFunc blockCodecFactory[static_cast<uint32_t>(BlockCodecType::MaxCodecType)];
+
+std::unique_ptr<BlockCodec> createBlockCodec(uint32_t codecType);
+} // namespace OCLRT
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstdint>
+
+namespace OCLRT {
+
+// Container layout: CompressedFileHeader followed by any number of blocks,
+// each one being CompressedBlockHeader and storedSize bytes of payload.
+// Payload is kept uncompressed when storedSize equals uncompressedSize.
+namespace CompressedFileFormat {
+const char magic[8] = {'N', 'E', 'O', 'C', 'M', 'P', 'R', 'S'};
+const uint32_t version = 1;
+} // namespace CompressedFileFormat
+
+#pragma pack(4)
+struct CompressedFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t codecType;
+    uint32_t blockSize;
+    uint32_t reserved;
+};
+
+struct CompressedBlockHeader {
+    uint32_t uncompressedSize;
+    uint32_t storedSize;
+};
+#pragma pack()
+static_assert(sizeof(CompressedFileHeader) == 24, "");
+static_assert(sizeof(CompressedBlockHeader) == 8, "");
+} // namespace OCLRT
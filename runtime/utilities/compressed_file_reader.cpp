@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/compressed_file_reader.h"
+
+#include <cstring>
+
+namespace OCLRT {
+
+CompressedFileReader::CompressedFileReader(std::istream &input) : input(input) {
+    input.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (input.gcount() != sizeof(header) ||
+        memcmp(header.magic, CompressedFileFormat::magic, sizeof(header.magic)) != 0 ||
+        header.version != CompressedFileFormat::version) {
+        corrupted = true;
+        return;
+    }
+    codec = createBlockCodec(header.codecType);
+}
+
+bool CompressedFileReader::readBlock(std::vector<char> &block) {
+    if (!isValid() || corrupted) {
+        return false;
+    }
+
+    CompressedBlockHeader blockHeader = {};
+    input.read(reinterpret_cast<char *>(&blockHeader), sizeof(blockHeader));
+    if (input.gcount() == 0) {
+        return false;
+    }
+    if (input.gcount() != sizeof(blockHeader) ||
+        blockHeader.uncompressedSize > header.blockSize ||
+        blockHeader.storedSize > blockHeader.uncompressedSize) {
+        corrupted = true;
+        return false;
+    }
+
+    block.resize(blockHeader.uncompressedSize);
+    if (blockHeader.storedSize == blockHeader.uncompressedSize) {
+        input.read(block.data(), blockHeader.storedSize);
+        corrupted = static_cast<size_t>(input.gcount()) != blockHeader.storedSize;
+        return !corrupted;
+    }
+
+    storedBlock.resize(blockHeader.storedSize);
+    input.read(storedBlock.data(), blockHeader.storedSize);
+    corrupted = static_cast<size_t>(input.gcount()) != blockHeader.storedSize ||
+                !codec->decompress(storedBlock.data(), storedBlock.size(), block.data(), block.size());
+    return !corrupted;
+}
+
+bool CompressedFileReader::decompress(std::ostream &output) {
+    std::vector<char> block;
+    while (readBlock(block)) {
+        output.write(block.data(), block.size());
+    }
+    return isValid() && !corrupted;
+}
+} // namespace OCLRT
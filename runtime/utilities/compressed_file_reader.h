@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/block_codec.h"
+#include "runtime/utilities/compressed_file_format.h"
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace OCLRT {
+
+// Streaming reader of compressed container, decompresses one block at a time
+class CompressedFileReader {
+  public:
+    explicit CompressedFileReader(std::istream &input);
+
+    bool isValid() const { return codec != nullptr; }
+    bool isCorrupted() const { return corrupted; }
+    const CompressedFileHeader &getHeader() const { return header; }
+
+    // Returns false at the end of stream or when block cannot be decoded
+    bool readBlock(std::vector<char> &block);
+    // Decompresses all remaining blocks, returns false when input is not a valid container
+    bool decompress(std::ostream &output);
+
+  protected:
+    std::istream &input;
+    CompressedFileHeader header = {};
+    std::unique_ptr<BlockCodec> codec;
+    std::vector<char> storedBlock;
+    bool corrupted = false;
+};
+} // namespace OCLRT
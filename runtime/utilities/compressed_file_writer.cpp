@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/compressed_file_writer.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/utilities/compressed_file_format.h"
+
+#include <cstring>
+
+namespace OCLRT {
+
+CompressedFileWriter::CompressedFileWriter(std::ostream &output, size_t blockSize, std::unique_ptr<BlockCodec> codec)
+    : AsyncFileWriter(output, blockSize), codec(std::move(codec)) {
+    DEBUG_BREAK_IF(this->codec == nullptr);
+    DEBUG_BREAK_IF(blockSize > UINT32_MAX);
+    compressedBlock.resize(blockSize);
+
+    // worker is idle until first buffer gets submitted
+    CompressedFileHeader header = {};
+    memcpy(header.magic, CompressedFileFormat::magic, sizeof(header.magic));
+    header.version = CompressedFileFormat::version;
+    header.codecType = static_cast<uint32_t>(this->codec->getType());
+    header.blockSize = static_cast<uint32_t>(blockSize);
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    compressedBytesWritten += sizeof(header);
+}
+
+CompressedFileWriter::~CompressedFileWriter() {
+    stopWorker();
+}
+
+void CompressedFileWriter::writeToOutput(const std::vector<char> &buffer) {
+    CompressedBlockHeader blockHeader = {};
+    blockHeader.uncompressedSize = static_cast<uint32_t>(buffer.size());
+
+    // compressed payload is used only when it is smaller than raw data
+    auto compressedSize = codec->compress(buffer.data(), buffer.size(), compressedBlock.data(), buffer.size() - 1);
+    const char *payload = compressedBlock.data();
+    if (compressedSize == 0) {
+        compressedSize = buffer.size();
+        payload = buffer.data();
+    }
+    blockHeader.storedSize = static_cast<uint32_t>(compressedSize);
+
+    output.write(reinterpret_cast<const char *>(&blockHeader), sizeof(blockHeader));
+    output.write(payload, compressedSize);
+    compressedBytesWritten += sizeof(blockHeader) + compressedSize;
+}
+} // namespace OCLRT
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/async_file_writer.h"
+#include "runtime/utilities/block_codec.h"
+
+namespace OCLRT {
+
+// Background writer storing data in compressed container format,
+// every staging buffer is compressed by the worker thread as one block
+class CompressedFileWriter : public AsyncFileWriter {
+  public:
+    CompressedFileWriter(std::ostream &output, size_t blockSize, std::unique_ptr<BlockCodec> codec);
+    ~CompressedFileWriter() override;
+
+    uint64_t peekCompressedBytesWritten() const { return compressedBytesWritten; }
+
+  protected:
+    void writeToOutput(const std::vector<char> &buffer) override;
+
+    std::unique_ptr<BlockCodec> codec;
+    std::vector<char> compressedBlock;
+    std::atomic<uint64_t> compressedBytesWritten{0};
+};
+} // namespace OCLRT
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace OCLRT {
+
+std::unique_ptr<MappedFile> MappedFile::open(const char *fileName) {
+    int fd = ::open(fileName, O_RDONLY);
+    if (fd == -1) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        auto size = static_cast<size_t>(fileStat.st_size);
+        auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            mappedFile.reset(new MappedFile(data, size));
+        }
+    }
+
+    // mapping stays valid after the descriptor is closed
+    close(fd);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    munmap(mappedData, mappedSize);
+}
+} // namespace OCLRT
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/lz4_block_codec.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace OCLRT {
+
+namespace {
+const uint32_t invalidPosition = UINT32_MAX;
+const uint8_t maxNibble = 15;
+
+uint32_t read32(const uint8_t *ptr) {
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - Lz4BlockCodec::hashLog);
+}
+
+size_t lengthFieldSize(size_t length) {
+    return length < maxNibble ? 0 : (length - maxNibble) / 255 + 1;
+}
+
+uint8_t *writeLength(uint8_t *op, size_t length) {
+    if (length < maxNibble) {
+        return op;
+    }
+    length -= maxNibble;
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+bool readLength(const uint8_t *&ip, const uint8_t *ipEnd, size_t &length) {
+    if (length != maxNibble) {
+        return true;
+    }
+    uint8_t value;
+    do {
+        if (ip >= ipEnd) {
+            return false;
+        }
+        value = *ip++;
+        length += value;
+    } while (value == 255);
+    return true;
+}
+} // namespace
+
+size_t Lz4BlockCodec::compress(const char *src, size_t srcSize, char *dst, size_t dstCapacity) {
+    auto srcBytes = reinterpret_cast<const uint8_t *>(src);
+    auto op = reinterpret_cast<uint8_t *>(dst);
+    auto opEnd = op + dstCapacity;
+
+    if (srcSize > UINT32_MAX) {
+        return 0;
+    }
+
+    size_t anchor = 0;
+    if (srcSize > matchFindLimit) {
+        hashTable.assign(static_cast<size_t>(1) << hashLog, invalidPosition);
+
+        // last match has to start at least matchFindLimit bytes before the end of block
+        // and leave lastLiterals bytes uncompressed
+        const size_t inputLimit = srcSize - matchFindLimit;
+        const size_t matchLimit = srcSize - lastLiterals;
+        size_t ip = 0;
+
+        while (ip <= inputLimit) {
+            auto sequence = read32(srcBytes + ip);
+            auto &entry = hashTable[hashSequence(sequence)];
+            size_t ref = entry;
+            entry = static_cast<uint32_t>(ip);
+
+            if (ref == invalidPosition || ip - ref > maxOffset || read32(srcBytes + ref) != sequence) {
+                // skip faster over data that does not compress
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            auto matchLength = minMatch;
+            while (ip + matchLength < matchLimit && srcBytes[ref + matchLength] == srcBytes[ip + matchLength]) {
+                matchLength++;
+            }
+
+            auto literalLength = ip - anchor;
+            auto sequenceSize = 1 + lengthFieldSize(literalLength) + literalLength + 2 + lengthFieldSize(matchLength - minMatch);
+            if (sequenceSize > static_cast<size_t>(opEnd - op)) {
+                return 0;
+            }
+
+            auto token = op++;
+            *token = static_cast<uint8_t>(((literalLength < maxNibble ? literalLength : maxNibble) << 4) |
+                                          (matchLength - minMatch < maxNibble ? matchLength - minMatch : maxNibble));
+            op = writeLength(op, literalLength);
+            memcpy(op, srcBytes + anchor, literalLength);
+            op += literalLength;
+
+            auto offset = ip - ref;
+            *op++ = static_cast<uint8_t>(offset & 0xFF);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            op = writeLength(op, matchLength - minMatch);
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    auto literalLength = srcSize - anchor;
+    if (1 + lengthFieldSize(literalLength) + literalLength > static_cast<size_t>(opEnd - op)) {
+        return 0;
+    }
+    *op++ = static_cast<uint8_t>((literalLength < maxNibble ? literalLength : maxNibble) << 4);
+    op = writeLength(op, literalLength);
+    memcpy(op, srcBytes + anchor, literalLength);
+    op += literalLength;
+
+    return static_cast<size_t>(op - reinterpret_cast<uint8_t *>(dst));
+}
+
+bool Lz4BlockCodec::decompress(const char *src, size_t srcSize, char *dst, size_t dstSize) {
+    auto ip = reinterpret_cast<const uint8_t *>(src);
+    auto ipEnd = ip + srcSize;
+    auto op = reinterpret_cast<uint8_t *>(dst);
+    auto opStart = op;
+    auto opEnd = op + dstSize;
+
+    while (ip < ipEnd) {
+        auto token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (!readLength(ip, ipEnd, literalLength) ||
+            literalLength > static_cast<size_t>(ipEnd - ip) ||
+            literalLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == ipEnd) {
+            // last sequence contains literals only
+            break;
+        }
+
+        if (ipEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - opStart)) {
+            return false;
+        }
+
+        size_t matchLength = token & maxNibble;
+        if (!readLength(ip, ipEnd, matchLength)) {
+            return false;
+        }
+        matchLength += minMatch;
+        if (matchLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+
+        // source and destination of match may overlap, so copy byte by byte
+        auto match = op - offset;
+        for (size_t i = 0; i < matchLength; i++) {
+            op[i] = match[i];
+        }
+        op += matchLength;
+    }
+
+    return op == opEnd;
+}
+} // namespace OCLRT
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/block_codec.h"
+
+#include <vector>
+
+namespace OCLRT {
+
+// Greedy single-pass compressor producing data in LZ4 block format,
+// so blocks can also be decoded with any LZ4_decompress_safe implementation
+class Lz4BlockCodec : public BlockCodec {
+  public:
+    static const size_t minMatch = 4;
+    static const size_t lastLiterals = 5;
+    static const size_t matchFindLimit = 12;
+    static const size_t maxOffset = 65535;
+    static const uint32_t hashLog = 12;
+
+    BlockCodecType getType() const override { return BlockCodecType::Lz4; }
+    size_t compress(const char *src, size_t srcSize, char *dst, size_t dstCapacity) override;
+    bool decompress(const char *src, size_t srcSize, char *dst, size_t dstSize) override;
+
+  protected:
+    std::vector<uint32_t> hashTable;
+};
+} // namespace OCLRT
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+
+namespace OCLRT {
+
+// Private (copy-on-write) mapping of a whole file, writes are never propagated back to the file.
+class MappedFile {
+  public:
+    static std::unique_ptr<MappedFile> open(const char *fileName);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    char *data() const { return mappedData; }
+    size_t size() const { return mappedSize; }
+
+  protected:
+    MappedFile(void *mappedData, size_t mappedSize) : mappedData(static_cast<char *>(mappedData)), mappedSize(mappedSize) {}
+
+    char *mappedData;
+    size_t mappedSize;
+};
+} // namespace OCLRT
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/segregated_heap_allocator.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+
+const size_t SegregatedHeapAllocator::defaultSizeThreshold;
+const uint32_t SegregatedHeapAllocator::firstLevelCount;
+const uint32_t SegregatedHeapAllocator::secondLevelCountLog2;
+const uint32_t SegregatedHeapAllocator::secondLevelCount;
+const uint32_t SegregatedHeapAllocator::boundaryTagsPerPageLog2;
+const uint32_t SegregatedHeapAllocator::boundaryTagsPerPage;
+
+namespace {
+uint32_t getLowestSetBit(uint64_t value) {
+    auto lowPart = static_cast<uint32_t>(value);
+    return lowPart ? Math::getMinLsbSet(lowPart) : 32u + Math::getMinLsbSet(static_cast<uint32_t>(value >> 32));
+}
+
+// constant time counterpart of Math::log2, bin index is computed several times per allocation
+uint32_t getHighestSetBit(uint64_t value) {
+    static const uint32_t multiplyDeBruijnBitPosition[64] = {
+        0, 47, 1, 56, 48, 27, 2, 60, 57, 49, 41, 37, 28, 16, 3, 61,
+        54, 58, 35, 52, 50, 42, 21, 44, 38, 32, 29, 23, 17, 11, 4, 62,
+        46, 55, 26, 59, 40, 36, 15, 53, 34, 51, 20, 43, 31, 22, 10, 45,
+        25, 39, 14, 33, 19, 30, 9, 24, 13, 18, 8, 12, 7, 6, 5, 63};
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    value |= value >> 32;
+    return multiplyDeBruijnBitPosition[(value * 0x03f79d71b4cb0a89ull) >> 58];
+}
+} // namespace
+
+SegregatedHeapAllocator::SegregatedHeapAllocator(uint64_t address, uint64_t size, size_t threshold)
+    : address(address), sizeThreshold(threshold) {
+    // only whole allocation units of the range are managed
+    size -= size % allocationAlignment;
+    this->size = size;
+    availableSize = size;
+    auto pagesCount = size / allocationAlignment;
+    boundaryTags.resize(static_cast<size_t>((pagesCount + boundaryTagsPerPage - 1) / boundaryTagsPerPage));
+    if (size > 0) {
+        insertFreeBlock(address, size);
+    }
+}
+
+uint64_t SegregatedHeapAllocator::allocate(size_t &sizeToAllocate) {
+    std::lock_guard<std::mutex> lock(mtx);
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+    if (sizeToAllocate == 0 || availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    auto block = findFreeBlock(sizeToAllocate);
+    if (block == nullptr) {
+        return 0llu;
+    }
+
+    auto blockPtr = block->ptr;
+    auto remainingSize = block->size - sizeToAllocate;
+    uint64_t ptrReturn = blockPtr;
+    if (remainingSize == 0) {
+        removeFreeBlock(block);
+    } else {
+        // remaining part stays in the same block, it only moves to bin of its new size
+        unlinkFreeBlock(block);
+        if (sizeToAllocate > sizeThreshold) {
+            block->ptr += sizeToAllocate;
+        } else {
+            ptrReturn = blockPtr + remainingSize;
+        }
+        block->size = remainingSize;
+        setBoundaryTags(block);
+        linkFreeBlock(block);
+    }
+    availableSize -= sizeToAllocate;
+    return ptrReturn;
+}
+
+void SegregatedHeapAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    size = alignUp(size, allocationAlignment);
+    DEBUG_BREAK_IF(ptr < address || ptr + size > address + this->size);
+    availableSize += size;
+
+    auto blockPtr = ptr;
+    uint64_t blockSize = size;
+
+    auto leftNeighbour = ptr > address ? getBoundaryTag(ptr - allocationAlignment) : nullptr;
+    if (leftNeighbour && leftNeighbour->ptr + leftNeighbour->size == ptr) {
+        blockPtr = leftNeighbour->ptr;
+        blockSize += leftNeighbour->size;
+        removeFreeBlock(leftNeighbour);
+    }
+    auto rightNeighbour = ptr + size < address + this->size ? getBoundaryTag(ptr + size) : nullptr;
+    if (rightNeighbour && rightNeighbour->ptr == ptr + size) {
+        blockSize += rightNeighbour->size;
+        removeFreeBlock(rightNeighbour);
+    }
+    insertFreeBlock(blockPtr, blockSize);
+}
+
+HeapFragmentationStats SegregatedHeapAllocator::getFragmentationStats() {
+    std::lock_guard<std::mutex> lock(mtx);
+    HeapFragmentationStats stats;
+    stats.freeSize = availableSize;
+    stats.freeBlocksCount = freeBlocksCount;
+    if (firstLevelBitmap != 0) {
+        // blocks of the highest non-empty bin are the only candidates for the largest one
+        auto firstLevel = getHighestSetBit(firstLevelBitmap);
+        auto secondLevel = getHighestSetBit(secondLevelBitmaps[firstLevel]);
+        for (auto block = freeLists[firstLevel][secondLevel]; block != nullptr; block = block->next) {
+            stats.largestFreeBlockSize = std::max(stats.largestFreeBlockSize, block->size);
+        }
+    }
+    return stats;
+}
+
+void SegregatedHeapAllocator::getBinIndex(uint64_t units, uint32_t &firstLevel, uint32_t &secondLevel) {
+    if (units < secondLevelCount) {
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(units);
+        return;
+    }
+    auto mostSignificantBit = getHighestSetBit(units);
+    firstLevel = mostSignificantBit - secondLevelCountLog2 + 1;
+    secondLevel = static_cast<uint32_t>(units >> (mostSignificantBit - secondLevelCountLog2)) - secondLevelCount;
+}
+
+SegregatedHeapAllocator::FreeBlock *SegregatedHeapAllocator::findFreeBlock(uint64_t blockSize) {
+    auto units = blockSize / allocationAlignment;
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    getBinIndex(units, firstLevel, secondLevel);
+    auto exactFirstLevel = firstLevel;
+    auto exactSecondLevel = secondLevel;
+
+    // every block in bin of rounded up size and in bins above it is big enough
+    if (units >= secondLevelCount) {
+        auto mostSignificantBit = getHighestSetBit(units);
+        getBinIndex(units + (1ull << (mostSignificantBit - secondLevelCountLog2)) - 1, firstLevel, secondLevel);
+    }
+
+    if (firstLevel < firstLevelCount) {
+        auto secondLevelBitmap = secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+        if (secondLevelBitmap == 0 && firstLevel + 1 < firstLevelCount) {
+            auto firstLevelBitmapAbove = firstLevelBitmap & (~0ull << (firstLevel + 1));
+            if (firstLevelBitmapAbove != 0) {
+                firstLevel = getLowestSetBit(firstLevelBitmapAbove);
+                secondLevelBitmap = secondLevelBitmaps[firstLevel];
+            }
+        }
+        if (secondLevelBitmap != 0) {
+            return freeLists[firstLevel][Math::getMinLsbSet(secondLevelBitmap)];
+        }
+    }
+
+    // bin of requested size holds blocks of various sizes, only some of them may fit
+    for (auto block = freeLists[exactFirstLevel][exactSecondLevel]; block != nullptr; block = block->next) {
+        if (block->size >= blockSize) {
+            return block;
+        }
+    }
+    return nullptr;
+}
+
+void SegregatedHeapAllocator::insertFreeBlock(uint64_t ptr, uint64_t blockSize) {
+    FreeBlock *block = unusedBlocks;
+    if (block) {
+        unusedBlocks = block->next;
+    } else {
+        blocksPool.emplace_back();
+        block = &blocksPool.back();
+    }
+    block->ptr = ptr;
+    block->size = blockSize;
+    block->isFree = true;
+    setBoundaryTags(block);
+    linkFreeBlock(block);
+    freeBlocksCount++;
+}
+
+void SegregatedHeapAllocator::removeFreeBlock(FreeBlock *block) {
+    unlinkFreeBlock(block);
+    block->isFree = false;
+    block->next = unusedBlocks;
+    unusedBlocks = block;
+    freeBlocksCount--;
+}
+
+SegregatedHeapAllocator::FreeBlock *SegregatedHeapAllocator::getBoundaryTag(uint64_t ptr) const {
+    auto page = (ptr - address) / allocationAlignment;
+    auto &tagsPage = boundaryTags[static_cast<size_t>(page >> boundaryTagsPerPageLog2)];
+    if (!tagsPage) {
+        return nullptr;
+    }
+    auto block = tagsPage[page & (boundaryTagsPerPage - 1)];
+    return (block && block->isFree) ? block : nullptr;
+}
+
+void SegregatedHeapAllocator::setBoundaryTags(FreeBlock *block) {
+    uint64_t pages[] = {(block->ptr - address) / allocationAlignment,
+                        (block->ptr + block->size - address) / allocationAlignment - 1};
+    for (auto page : pages) {
+        auto &tagsPage = boundaryTags[static_cast<size_t>(page >> boundaryTagsPerPageLog2)];
+        if (!tagsPage) {
+            tagsPage.reset(new FreeBlock *[boundaryTagsPerPage]());
+        }
+        tagsPage[page & (boundaryTagsPerPage - 1)] = block;
+    }
+}
+
+void SegregatedHeapAllocator::linkFreeBlock(FreeBlock *block) {
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    getBinIndex(block->size / allocationAlignment, firstLevel, secondLevel);
+    block->prev = nullptr;
+    block->next = freeLists[firstLevel][secondLevel];
+    if (block->next) {
+        block->next->prev = block;
+    }
+    freeLists[firstLevel][secondLevel] = block;
+    firstLevelBitmap |= (1ull << firstLevel);
+    secondLevelBitmaps[firstLevel] |= (1u << secondLevel);
+}
+
+void SegregatedHeapAllocator::unlinkFreeBlock(FreeBlock *block) {
+    uint32_t firstLevel = 0;
+    uint32_t secondLevel = 0;
+    getBinIndex(block->size / allocationAlignment, firstLevel, secondLevel);
+    if (block->prev) {
+        block->prev->next = block->next;
+    } else {
+        freeLists[firstLevel][secondLevel] = block->next;
+        if (block->next == nullptr) {
+            secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (secondLevelBitmaps[firstLevel] == 0) {
+                firstLevelBitmap &= ~(1ull << firstLevel);
+            }
+        }
+    }
+    if (block->next) {
+        block->next->prev = block->prev;
+    }
+}
+} // namespace OCLRT
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+
+struct HeapFragmentationStats {
+    uint64_t freeSize = 0;
+    uint64_t largestFreeBlockSize = 0;
+    size_t freeBlocksCount = 0;
+
+    // 0 when all free space is a single block, approaches 1 when it is scattered across many small blocks
+    double getFragmentation() const {
+        return freeSize ? 1.0 - static_cast<double>(largestFreeBlockSize) / static_cast<double>(freeSize) : 0.0;
+    }
+};
+
+// Two-level segregated fit allocator of address range [address, address + size).
+// Free blocks are kept outside of the managed range, in bins indexed by size class. Bitmaps of non-empty bins
+// allow finding a fitting block without scanning. First and last page of each free block are tagged, so freed
+// block is coalesced with its free neighbours immediately. Free takes constant time, so does allocate unless
+// only some blocks of the bin of requested size fit.
+// Allocations bigger than threshold are taken from the beginning of free block and smaller ones from its end,
+// so small and big allocations do not interleave.
+class SegregatedHeapAllocator {
+  public:
+    SegregatedHeapAllocator(uint64_t address, uint64_t size) : SegregatedHeapAllocator(address, size, defaultSizeThreshold) {}
+    SegregatedHeapAllocator(uint64_t address, uint64_t size, size_t threshold);
+
+    SegregatedHeapAllocator(const SegregatedHeapAllocator &) = delete;
+    SegregatedHeapAllocator &operator=(const SegregatedHeapAllocator &) = delete;
+
+    // returns 0 when there is no free block big enough, sizeToAllocate is aligned up to allocation alignment
+    uint64_t allocate(size_t &sizeToAllocate);
+    void free(uint64_t ptr, size_t size);
+
+    uint64_t getLeftSize() const {
+        return availableSize;
+    }
+
+    uint64_t getUsedSize() const {
+        return size - availableSize;
+    }
+
+    double getUsage() const {
+        return 1.0 * (size - availableSize) / (size * 1.0);
+    }
+
+    HeapFragmentationStats getFragmentationStats();
+
+    static const size_t defaultSizeThreshold = static_cast<size_t>(4 * MemoryConstants::megaByte);
+
+  protected:
+    static const uint32_t firstLevelCount = 64;
+    static const uint32_t secondLevelCountLog2 = 4;
+    static const uint32_t secondLevelCount = 1u << secondLevelCountLog2;
+
+    static const uint32_t boundaryTagsPerPageLog2 = 10;
+    static const uint32_t boundaryTagsPerPage = 1u << boundaryTagsPerPageLog2;
+
+    struct FreeBlock {
+        uint64_t ptr = 0;
+        uint64_t size = 0;
+        FreeBlock *prev = nullptr;
+        FreeBlock *next = nullptr;
+        bool isFree = false;
+    };
+
+    // size class of block of given size, in allocation alignment units
+    static void getBinIndex(uint64_t units, uint32_t &firstLevel, uint32_t &secondLevel);
+    FreeBlock *findFreeBlock(uint64_t blockSize);
+    void insertFreeBlock(uint64_t ptr, uint64_t blockSize);
+    void removeFreeBlock(FreeBlock *block);
+    void linkFreeBlock(FreeBlock *block);
+    void unlinkFreeBlock(FreeBlock *block);
+
+    // tags may be stale, block is valid neighbour only if it is free and its boundary matches
+    FreeBlock *getBoundaryTag(uint64_t ptr) const;
+    void setBoundaryTags(FreeBlock *block);
+
+    uint64_t address;
+    uint64_t size;
+    uint64_t availableSize;
+    const size_t sizeThreshold;
+    size_t allocationAlignment = MemoryConstants::pageSize;
+
+    uint64_t firstLevelBitmap = 0;
+    uint32_t secondLevelBitmaps[firstLevelCount] = {};
+    FreeBlock *freeLists[firstLevelCount][secondLevelCount] = {};
+
+    // tags of all pages would not fit in memory for 4GB heap, pages of tags are created on first use
+    std::vector<std::unique_ptr<FreeBlock *[]>> boundaryTags;
+    // blocks are never released, so stale tags always point to valid memory
+    std::deque<FreeBlock> blocksPool;
+    FreeBlock *unusedBlocks = nullptr;
+    size_t freeBlocksCount = 0;
+    std::mutex mtx;
+};
+} // namespace OCLRT
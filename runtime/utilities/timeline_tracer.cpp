@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/timeline_tracer.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/os_interface/os_time.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace OCLRT {
+const uint32_t TimelineTracer::gpuTrackId;
+const size_t TimelineTracer::recordsPerChunk;
+
+std::atomic<uint64_t> TimelineTracer::instancesCreated{0};
+std::atomic<OSTime *> TimelineTracer::timeSource{nullptr};
+
+namespace {
+struct ThreadBufferCache {
+    uint64_t instanceId = 0;
+    void *buffer = nullptr;
+};
+thread_local ThreadBufferCache threadBufferCache;
+
+std::mutex globalTracerMutex;
+std::unique_ptr<std::ofstream> globalTraceFile;
+std::unique_ptr<TimelineTracer> globalTracerOwner;
+std::atomic<TimelineTracer *> globalTracer{nullptr};
+} // namespace
+
+TimelineTracer::TimelineTracer(std::ostream &output) : instanceId(++instancesCreated), output(output) {
+    output << "{\"traceEvents\":[";
+}
+
+TimelineTracer::~TimelineTracer() {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    drainLocked();
+    output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    output.flush();
+
+    auto buffer = threadBuffers.load();
+    while (buffer) {
+        auto chunk = buffer->head;
+        while (chunk) {
+            auto nextChunk = chunk->next.load();
+            delete chunk;
+            chunk = nextChunk;
+        }
+        auto nextBuffer = buffer->next;
+        delete buffer;
+        buffer = nextBuffer;
+    }
+}
+
+TimelineTracer *TimelineTracer::get() {
+    if (!DebugManager.flags.EnableTimelineTrace.get()) {
+        return nullptr;
+    }
+    auto tracer = globalTracer.load(std::memory_order_acquire);
+    if (tracer) {
+        return tracer;
+    }
+    std::lock_guard<std::mutex> lock(globalTracerMutex);
+    if (!globalTracerOwner) {
+        globalTraceFile.reset(new std::ofstream(DebugManager.flags.TimelineTraceFileName.get(), std::ios::trunc));
+        globalTracerOwner.reset(new TimelineTracer(*globalTraceFile));
+        globalTracer.store(globalTracerOwner.get(), std::memory_order_release);
+    }
+    return globalTracerOwner.get();
+}
+
+void TimelineTracer::setTimeSource(OSTime *osTime) {
+    timeSource.store(osTime);
+}
+
+void TimelineTracer::clearTimeSource(OSTime *osTime) {
+    timeSource.compare_exchange_strong(osTime, nullptr);
+}
+
+uint64_t TimelineTracer::getTimestamp() const {
+    uint64_t timestamp = 0;
+    auto osTime = timeSource.load();
+    if (osTime && osTime->getCpuTime(&timestamp)) {
+        return timestamp;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TimelineTracer::recordSpan(const char *category, const char *name, uint64_t startNs, uint64_t endNs, const char *argName, uint64_t argValue) {
+    Record record = {Phase::Complete, 0, startNs, endNs > startNs ? endNs - startNs : 0, category, argName, argValue, {}};
+    strncpy(record.name, name, sizeof(record.name) - 1);
+    append(getThreadBuffer().trackId, record);
+}
+
+void TimelineTracer::recordGpuSpan(const char *name, uint64_t startNs, uint64_t endNs, uint64_t taskCount) {
+    Record record = {Phase::Complete, 0, startNs, endNs > startNs ? endNs - startNs : 0, "gpu", "taskCount", taskCount, {}};
+    strncpy(record.name, name, sizeof(record.name) - 1);
+    append(gpuTrackId, record);
+}
+
+void TimelineTracer::recordCounter(const char *category, const char *name, uint64_t timestampNs, uint64_t value) {
+    Record record = {Phase::Counter, 0, timestampNs, 0, category, "value", value, {}};
+    strncpy(record.name, name, sizeof(record.name) - 1);
+    append(gpuTrackId, record);
+}
+
+void TimelineTracer::flush() {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    drainLocked();
+}
+
+TimelineTracer::ThreadBuffer &TimelineTracer::getThreadBuffer() {
+    if (threadBufferCache.instanceId == instanceId) {
+        return *static_cast<ThreadBuffer *>(threadBufferCache.buffer);
+    }
+
+    auto threadId = std::this_thread::get_id();
+    auto buffer = threadBuffers.load(std::memory_order_acquire);
+    while (buffer && buffer->owner != threadId) {
+        buffer = buffer->next;
+    }
+
+    if (!buffer) {
+        buffer = new ThreadBuffer;
+        buffer->owner = threadId;
+        buffer->trackId = ++threadBuffersCount;
+        buffer->tail = new Chunk;
+        buffer->head = buffer->tail;
+        buffer->next = threadBuffers.load(std::memory_order_relaxed);
+        while (!threadBuffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    threadBufferCache.instanceId = instanceId;
+    threadBufferCache.buffer = buffer;
+    return *buffer;
+}
+
+void TimelineTracer::append(uint32_t trackId, const Record &record) {
+    auto &buffer = getThreadBuffer();
+    auto chunk = buffer.tail;
+    auto index = chunk->used.load(std::memory_order_relaxed);
+
+    bool chunkFilled = false;
+    if (index == recordsPerChunk) {
+        auto newChunk = new Chunk;
+        chunk->next.store(newChunk, std::memory_order_release);
+        buffer.tail = newChunk;
+        chunk = newChunk;
+        index = 0;
+        chunkFilled = true;
+    }
+
+    chunk->records[index] = record;
+    chunk->records[index].trackId = trackId;
+    chunk->used.store(index + 1, std::memory_order_release);
+
+    if (chunkFilled) {
+        // never wait for the output, whoever drains next picks the records up
+        std::unique_lock<std::mutex> lock(outputMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            drainLocked();
+        }
+    }
+}
+
+void TimelineTracer::drainLocked() {
+    for (auto buffer = threadBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next) {
+        if (!buffer->trackNameWritten) {
+            writeTrackName(buffer->trackId, ("Host thread " + std::to_string(buffer->trackId)).c_str());
+            buffer->trackNameWritten = true;
+        }
+
+        while (true) {
+            auto chunk = buffer->head;
+            auto used = chunk->used.load(std::memory_order_acquire);
+            for (; buffer->consumed < used; buffer->consumed++) {
+                writeRecord(chunk->records[buffer->consumed]);
+            }
+
+            // the owning thread moves to the next chunk before writing into it, so a full chunk with a successor is no longer touched
+            auto nextChunk = chunk->next.load(std::memory_order_acquire);
+            if (used < recordsPerChunk || nextChunk == nullptr) {
+                break;
+            }
+            buffer->head = nextChunk;
+            buffer->consumed = 0;
+            delete chunk;
+        }
+    }
+    output.flush();
+}
+
+void TimelineTracer::writeRecord(const Record &record) {
+    if (record.trackId == gpuTrackId && !gpuTrackNameWritten) {
+        writeTrackName(gpuTrackId, "GPU");
+        gpuTrackNameWritten = true;
+    }
+
+    writeSeparator();
+    output << "{\"name\":\"";
+    writeEscaped(output, record.name);
+    output << "\",\"cat\":\"" << record.category << "\",\"ph\":\"" << static_cast<char>(record.phase)
+           << "\",\"pid\":1,\"tid\":" << record.trackId << ",\"ts\":";
+    writeMicroseconds(output, record.timestampNs);
+    if (record.phase == Phase::Complete) {
+        output << ",\"dur\":";
+        writeMicroseconds(output, record.durationNs);
+    }
+    if (record.argName) {
+        output << ",\"args\":{\"" << record.argName << "\":" << record.argValue << "}";
+    }
+    output << "}";
+    recordsWritten++;
+}
+
+void TimelineTracer::writeTrackName(uint32_t trackId, const char *name) {
+    writeSeparator();
+    output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << trackId << ",\"args\":{\"name\":\"";
+    writeEscaped(output, name);
+    output << "\"}}";
+}
+
+void TimelineTracer::writeSeparator() {
+    if (firstEntryWritten) {
+        output << ",";
+    }
+    output << "\n";
+    firstEntryWritten = true;
+}
+
+void TimelineTracer::writeMicroseconds(std::ostream &out, uint64_t timeNs) {
+    auto fraction = timeNs % 1000;
+    out << timeNs / 1000 << "." << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+}
+
+void TimelineTracer::writeEscaped(std::ostream &out, const char *string) {
+    for (auto character = string; *character != '\0'; character++) {
+        if (*character == '"' || *character == '\\') {
+            out << '\\';
+        }
+        if (static_cast<unsigned char>(*character) >= 0x20) {
+            out << *character;
+        }
+    }
+}
+} // namespace OCLRT
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+namespace OCLRT {
+class OSTime;
+
+// Streams host API spans, CSR flushes and GPU execution of profiled events as Chrome trace JSON
+// (chrome://tracing, Perfetto). Each thread appends records to its own chunked buffer without locking,
+// buffers are drained to the output stream on flush or opportunistically when a thread fills a chunk.
+class TimelineTracer {
+  public:
+    enum class Phase : char {
+        Complete = 'X',
+        Counter = 'C'
+    };
+
+    struct Record {
+        Phase phase;
+        uint32_t trackId;
+        uint64_t timestampNs;
+        uint64_t durationNs;
+        const char *category;
+        const char *argName;
+        uint64_t argValue;
+        char name[64];
+    };
+
+    static const uint32_t gpuTrackId = 0;
+    static const size_t recordsPerChunk = 1024;
+
+    TimelineTracer(std::ostream &output);
+    virtual ~TimelineTracer();
+
+    TimelineTracer(const TimelineTracer &) = delete;
+    TimelineTracer &operator=(const TimelineTracer &) = delete;
+
+    // returns nullptr unless EnableTimelineTrace is set, global tracer writes to TimelineTraceFileName
+    static TimelineTracer *get();
+    // host timestamps are taken from device OSTime so they share the clock with event profiling data
+    static void setTimeSource(OSTime *osTime);
+    static void clearTimeSource(OSTime *osTime);
+
+    uint64_t getTimestamp() const;
+
+    void recordSpan(const char *category, const char *name, uint64_t startNs, uint64_t endNs, const char *argName = nullptr, uint64_t argValue = 0);
+    void recordGpuSpan(const char *name, uint64_t startNs, uint64_t endNs, uint64_t taskCount);
+    void recordCounter(const char *category, const char *name, uint64_t timestampNs, uint64_t value);
+
+    void flush();
+
+    uint64_t peekRecordsWritten() const { return recordsWritten; }
+    uint32_t peekThreadBuffersCount() const { return threadBuffersCount; }
+
+  protected:
+    struct Chunk {
+        Record records[recordsPerChunk];
+        std::atomic<size_t> used{0};
+        std::atomic<Chunk *> next{nullptr};
+    };
+
+    struct ThreadBuffer {
+        std::thread::id owner;
+        uint32_t trackId = 0;
+        // producer side, touched only by the owning thread
+        Chunk *tail = nullptr;
+        // consumer side, touched only under outputMutex
+        Chunk *head = nullptr;
+        size_t consumed = 0;
+        bool trackNameWritten = false;
+        ThreadBuffer *next = nullptr;
+    };
+
+    ThreadBuffer &getThreadBuffer();
+    void append(uint32_t trackId, const Record &record);
+    void drainLocked();
+    void writeRecord(const Record &record);
+    void writeTrackName(uint32_t trackId, const char *name);
+    void writeSeparator();
+
+    static void writeMicroseconds(std::ostream &out, uint64_t timeNs);
+    static void writeEscaped(std::ostream &out, const char *string);
+
+    const uint64_t instanceId;
+    std::atomic<ThreadBuffer *> threadBuffers{nullptr};
+    std::atomic<uint32_t> threadBuffersCount{0};
+
+    std::mutex outputMutex;
+    std::ostream &output;
+    bool firstEntryWritten = false;
+    bool gpuTrackNameWritten = false;
+    std::atomic<uint64_t> recordsWritten{0};
+
+    static std::atomic<uint64_t> instancesCreated;
+    static std::atomic<OSTime *> timeSource;
+};
+
+struct TimelineTraceApiWrapper {
+    TimelineTraceApiWrapper(const char *funcName)
+        : funcName(funcName), tracer(TimelineTracer::get()) {
+        if (tracer) {
+            start = tracer->getTimestamp();
+        }
+    }
+
+    ~TimelineTraceApiWrapper() {
+        if (tracer) {
+            tracer->recordSpan("api", funcName, start, tracer->getTimestamp());
+        }
+    }
+
+    const char *funcName;
+    TimelineTracer *tracer;
+    uint64_t start = 0;
+};
+} // namespace OCLRT
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/mapped_file.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+namespace OCLRT {
+
+std::unique_ptr<MappedFile> MappedFile::open(const char *fileName) {
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    LARGE_INTEGER fileSize = {};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            auto data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            if (data != nullptr) {
+                mappedFile.reset(new MappedFile(data, static_cast<size_t>(fileSize.QuadPart)));
+            }
+            // view keeps the mapping object alive
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(mappedData);
+}
+} // namespace OCLRT
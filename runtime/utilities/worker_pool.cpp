@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/worker_pool.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace OCLRT {
+
+namespace {
+struct ParallelForState {
+    std::atomic<size_t> nextIndex{0};
+    size_t count = 0;
+    const std::function<void(size_t)> *body = nullptr;
+    std::mutex mtx;
+    std::condition_variable condition;
+    size_t indicesDone = 0;
+
+    void process() {
+        size_t processed = 0;
+        // body is only dereferenced for a claimed index, caller waits for all of them before it returns
+        for (auto index = nextIndex++; index < count; index = nextIndex++) {
+            (*body)(index);
+            processed++;
+        }
+        if (processed) {
+            std::lock_guard<std::mutex> lock(mtx);
+            indicesDone += processed;
+            if (indicesDone == count) {
+                condition.notify_all();
+            }
+        }
+    }
+};
+} // namespace
+
+WorkerPool::WorkerPool(uint32_t workersCount) {
+    DEBUG_BREAK_IF(workersCount == 0);
+    for (uint32_t i = 0; i < workersCount; i++) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopRequested = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+uint32_t WorkerPool::getDefaultWorkersCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void WorkerPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        tasks.push_back(std::move(task));
+    }
+    condition.notify_one();
+}
+
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t)> &body) {
+    if (count == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->count = count;
+    state->body = &body;
+
+    auto helpersCount = std::min(static_cast<size_t>(getWorkersCount()), count - 1);
+    for (size_t i = 0; i < helpersCount; i++) {
+        enqueue([state]() { state->process(); });
+    }
+    state->process();
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->condition.wait(lock, [&state] { return state->indicesDone == state->count; });
+}
+
+void *WorkerPool::run(void *arg) {
+    auto self = reinterpret_cast<WorkerPool *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (true) {
+        self->condition.wait(lock, [self] { return !self->tasks.empty() || self->stopRequested; });
+        if (self->tasks.empty()) {
+            break;
+        }
+        auto task = std::move(self->tasks.front());
+        self->tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+    return nullptr;
+}
+} // namespace OCLRT
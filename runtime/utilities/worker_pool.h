@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class Thread;
+
+// Fixed set of worker threads executing queued tasks in submission order.
+// Tasks still queued when the pool is destroyed are executed before workers are joined.
+class WorkerPool {
+  public:
+    explicit WorkerPool(uint32_t workersCount);
+    virtual ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // returns number of hardware threads, at least 1
+    static uint32_t getDefaultWorkersCount();
+
+    void enqueue(std::function<void()> task);
+
+    // calls body for each index in [0, count) and returns when all calls are done.
+    // Calling thread takes part in the work, so it is safe to call from a task running on this pool.
+    void parallelFor(size_t count, const std::function<void(size_t)> &body);
+
+    uint32_t getWorkersCount() const { return static_cast<uint32_t>(workers.size()); }
+
+  protected:
+    static void *run(void *arg);
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool stopRequested = false;
+};
+} // namespace OCLRT
@@ -7,8 +7,10 @@
 
 #include "cl_api_tests.h"
 #include "CL/cl_ext.h"
+#include "public/cl_ext_private.h"
 #include "runtime/context/context.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/csr_definitions.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/helpers/base_object.h"
@@ -352,6 +354,51 @@ TEST_F(clCreateCommandQueueWithPropertiesApi, GivenLowPriorityWhenCreatingComman
     EXPECT_EQ(retVal, CL_SUCCESS);
 }
 
+TEST_F(clCreateCommandQueueWithPropertiesApi, givenWarmUpPropertyWhenCreatingCommandQueueWithPropertiesThenSuccessIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL, 2, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_NE(nullptr, cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    retVal = clReleaseCommandQueue(cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, givenWarmUpPropertyAboveLimitWhenCreatingCommandQueueWithPropertiesThenInvalidValueErrorIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL, CSRequirements::maxWarmUpCommandBuffersCount + 1, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    EXPECT_EQ(nullptr, cmdq);
+    EXPECT_EQ(retVal, CL_INVALID_VALUE);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, givenWarmUpPropertyWhenCreatingDeviceQueueWithPropertiesThenInvalidQueuePropertiesErrorIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties ondevice[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_ON_DEVICE | CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL, 2, 0, 0};
+    auto cmdqd = clCreateCommandQueueWithProperties(pContext, devices[0], ondevice, &retVal);
+    EXPECT_EQ(nullptr, cmdqd);
+    EXPECT_EQ(retVal, CL_INVALID_QUEUE_PROPERTIES);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, givenScratchSizeLimitPropertyWhenCreatingCommandQueueWithPropertiesThenLimitIsSet) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties properties[] = {CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL, 4096, 0};
+    auto cmdq = clCreateCommandQueueWithProperties(pContext, devices[0], properties, &retVal);
+    ASSERT_NE(nullptr, cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_EQ(4096u, castToObject<CommandQueue>(cmdq)->getScratchSizeLimit());
+    retVal = clReleaseCommandQueue(cmdq);
+    EXPECT_EQ(retVal, CL_SUCCESS);
+}
+
+TEST_F(clCreateCommandQueueWithPropertiesApi, givenScratchSizeLimitPropertyWhenCreatingDeviceQueueWithPropertiesThenInvalidQueuePropertiesErrorIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    cl_queue_properties ondevice[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_ON_DEVICE | CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL, 4096, 0, 0};
+    auto cmdqd = clCreateCommandQueueWithProperties(pContext, devices[0], ondevice, &retVal);
+    EXPECT_EQ(nullptr, cmdqd);
+    EXPECT_EQ(retVal, CL_INVALID_QUEUE_PROPERTIES);
+}
+
 std::pair<uint32_t, QueuePriority> priorityParams[3]{
     std::make_pair(CL_QUEUE_PRIORITY_LOW_KHR, QueuePriority::LOW),
     std::make_pair(CL_QUEUE_PRIORITY_MED_KHR, QueuePriority::MEDIUM),
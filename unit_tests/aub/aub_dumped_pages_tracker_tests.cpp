@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub/aub_dumped_pages_tracker.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(AubDumpedPagesTracker, givenPageNotDumpedBeforeWhenUpdatePageIsCalledThenTrueIsReturnedAndPageIsTracked) {
+    AubDumpedPagesTracker tracker;
+    std::vector<char> page(MemoryConstants::pageSize, 0);
+
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_EQ(1u, tracker.getTrackedPagesCount());
+    EXPECT_EQ(0u, tracker.peekSkippedPagesCount());
+}
+
+TEST(AubDumpedPagesTracker, givenUnchangedPageWhenUpdatePageIsCalledAgainThenFalseIsReturned) {
+    AubDumpedPagesTracker tracker;
+    std::vector<char> page(MemoryConstants::pageSize, 0);
+
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_FALSE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_EQ(1u, tracker.peekSkippedPagesCount());
+}
+
+TEST(AubDumpedPagesTracker, givenModifiedPageWhenUpdatePageIsCalledThenTrueIsReturnedAndNewContentsAreRecorded) {
+    AubDumpedPagesTracker tracker;
+    std::vector<char> page(MemoryConstants::pageSize, 0);
+
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    page[100] = 1;
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_FALSE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_EQ(1u, tracker.getTrackedPagesCount());
+}
+
+TEST(AubDumpedPagesTracker, givenDifferentEntryBitsOrSizeWhenUpdatePageIsCalledThenTrueIsReturned) {
+    AubDumpedPagesTracker tracker;
+    std::vector<char> page(MemoryConstants::pageSize, 0);
+
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x3));
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size() / 2, 0x3));
+    EXPECT_EQ(0u, tracker.peekSkippedPagesCount());
+}
+
+TEST(AubDumpedPagesTracker, givenTrackedPagesWhenResetIsCalledThenAllPagesAreDumpedAgain) {
+    AubDumpedPagesTracker tracker;
+    std::vector<char> page(MemoryConstants::pageSize, 0);
+
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+    EXPECT_TRUE(tracker.updatePage(0x2000, page.data(), page.size(), 0x7));
+    tracker.reset();
+    EXPECT_EQ(0u, tracker.getTrackedPagesCount());
+    EXPECT_TRUE(tracker.updatePage(0x1000, page.data(), page.size(), 0x7));
+}
@@ -110,7 +110,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, AUBHelloWorld, simple) {
 
     auto pSBA = reinterpret_cast<STATE_BASE_ADDRESS *>(cmdStateBaseAddress);
     ASSERT_NE(nullptr, pSBA);
-    auto pISA = pKernel->getKernelInfo().getGraphicsAllocation()->getUnderlyingBuffer();
+    auto pISA = ptrOffset(pKernel->getKernelInfo().getGraphicsAllocation()->getUnderlyingBuffer(), pKernel->getKernelInfo().kernelAllocationOffset);
     EXPECT_EQ(0, memcmp(pISA, pExpectedISA, expectedSize));
 }
 
@@ -261,7 +261,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, AUBSimpleArg, simple) {
 
     auto pSBA = reinterpret_cast<STATE_BASE_ADDRESS *>(cmdStateBaseAddress);
     ASSERT_NE(nullptr, pSBA);
-    auto pISA = pKernel->getKernelInfo().getGraphicsAllocation()->getUnderlyingBuffer();
+    auto pISA = ptrOffset(pKernel->getKernelInfo().getGraphicsAllocation()->getUnderlyingBuffer(), pKernel->getKernelInfo().kernelAllocationOffset);
     EXPECT_EQ(0, memcmp(pISA, pExpectedISA, expectedSize));
 }
 
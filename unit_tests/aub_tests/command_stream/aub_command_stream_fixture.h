@@ -49,7 +49,7 @@ class AUBCommandStreamFixture : public CommandStreamFixture {
 
         // Write our pseudo-op to the AUB file
         auto aubCsr = reinterpret_cast<AUBCommandStreamReceiverHw<FamilyType> *>(csr);
-        aubCsr->getAubStream()->fileHandle.write(reinterpret_cast<char *>(&header), sizeof(header));
+        aubCsr->getAubStream()->write(reinterpret_cast<char *>(&header), sizeof(header));
     }
 
     template <typename FamilyType>
@@ -13,6 +13,7 @@
 #include "runtime/helpers/basic_math.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/options.h"
+#include "public/cl_ext_private.h"
 
 #include "unit_tests/command_queue/command_queue_fixture.h"
 #include "unit_tests/command_stream/command_stream_fixture.h"
@@ -385,6 +386,50 @@ TEST_F(CommandQueueCommandStreamTest, givenCommandQueueWhenGetCSIsCalledThenComm
     EXPECT_EQ(GraphicsAllocation::AllocationType::LINEAR_STREAM, commandStreamAllocation->getAllocationType());
 }
 
+HWTEST_F(CommandQueueCommandStreamTest, givenWarmUpPropertyWhenCommandQueueIsCreatedThenResourcesOfFirstEnqueueAreAllocated) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    const cl_queue_properties props[3] = {CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL, 3, 0};
+    CommandQueue cmdQ(context.get(), pDevice, props);
+
+    auto &commandStream = cmdQ.getCS(0);
+    ASSERT_NE(nullptr, commandStream.getGraphicsAllocation());
+    EXPECT_EQ(CSRequirements::warmUpCommandBufferSize, commandStream.getGraphicsAllocation()->getUnderlyingBufferSize());
+    EXPECT_EQ(CSRequirements::warmUpCommandBufferSize - CSRequirements::csOverfetchSize - CSRequirements::minCommandQueueCommandStreamSize, commandStream.getMaxAvailableSpace());
+
+    EXPECT_NE(nullptr, commandStreamReceiver.commandStream.getGraphicsAllocation());
+    for (auto heapType : {IndirectHeap::DYNAMIC_STATE, IndirectHeap::INDIRECT_OBJECT, IndirectHeap::SURFACE_STATE}) {
+        ASSERT_NE(nullptr, commandStreamReceiver.indirectHeap[heapType]);
+        EXPECT_NE(nullptr, commandStreamReceiver.indirectHeap[heapType]->getGraphicsAllocation());
+    }
+
+    uint32_t reusableCommandBuffersCount = 0;
+    for (auto allocation = commandStreamReceiver.getAllocationsForReuse().peekHead(); allocation != nullptr; allocation = allocation->next) {
+        EXPECT_EQ(CSRequirements::warmUpCommandBufferSize, allocation->getUnderlyingBufferSize());
+        reusableCommandBuffersCount++;
+    }
+    EXPECT_EQ(2u, reusableCommandBuffersCount);
+}
+
+HWTEST_F(CommandQueueCommandStreamTest, givenWarmUpPropertyAboveLimitWhenCommandQueueIsCreatedThenCommandBuffersCountIsClamped) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    const cl_queue_properties props[3] = {CL_QUEUE_WARM_UP_COMMAND_BUFFERS_INTEL, 1000, 0};
+    CommandQueue cmdQ(context.get(), pDevice, props);
+
+    uint32_t reusableCommandBuffersCount = 0;
+    for (auto allocation = commandStreamReceiver.getAllocationsForReuse().peekHead(); allocation != nullptr; allocation = allocation->next) {
+        reusableCommandBuffersCount++;
+    }
+    EXPECT_EQ(CSRequirements::maxWarmUpCommandBuffersCount - 1, reusableCommandBuffersCount);
+}
+
+HWTEST_F(CommandQueueCommandStreamTest, givenNoWarmUpPropertyWhenCommandQueueIsCreatedThenResourcesAreAllocatedOnFirstUse) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    const cl_queue_properties props[3] = {CL_QUEUE_PROPERTIES, 0, 0};
+    CommandQueue cmdQ(context.get(), pDevice, props);
+
+    EXPECT_TRUE(commandStreamReceiver.getAllocationsForReuse().peekIsEmpty());
+}
+
 struct CommandQueueIndirectHeapTest : public CommandQueueMemoryDevice,
                                       public ::testing::TestWithParam<IndirectHeap::Type> {
     void SetUp() override {
@@ -28,6 +28,7 @@
 #include "unit_tests/mocks/mock_buffer.h"
 #include "unit_tests/mocks/mock_submissions_aggregator.h"
 #include "runtime/helpers/hw_info.h"
+#include "public/cl_ext_private.h"
 
 using namespace OCLRT;
 
@@ -986,6 +987,42 @@ HWTEST_F(EnqueueKernelTest, givenEnqueueWithGlobalWorkSizeWhenZeroValueIsPassedI
     EXPECT_EQ(CL_SUCCESS, ret);
 }
 
+HWTEST_F(EnqueueKernelTest, givenQueueWithScratchSizeLimitWhenKernelExceedingLimitIsEnqueuedThenOutOfResourcesIsReturned) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    cl_queue_properties properties[] = {CL_QUEUE_SCRATCH_SIZE_LIMIT_INTEL, 2048, 0};
+    CommandQueueHw<FamilyType> cmdQ(context, pDevice, properties);
+    EXPECT_EQ(2048u, cmdQ.getScratchSizeLimit());
+
+    SPatchMediaVFEState mediaVFEstate;
+    mediaVFEstate.PerThreadScratchSpace = 2049;
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    mockKernel.kernelInfo.patchInfo.mediavfestate = &mediaVFEstate;
+
+    size_t gws[3] = {1, 0, 0};
+    cl_event event = reinterpret_cast<cl_event>(0x1234);
+    auto ret = cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_OUT_OF_RESOURCES, ret);
+    EXPECT_EQ(nullptr, event);
+    EXPECT_EQ(0u, csr.requiredScratchSize);
+
+    mediaVFEstate.PerThreadScratchSpace = 1500;
+    ret = cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, ret);
+    EXPECT_EQ(2048u, csr.requiredScratchSize);
+}
+
+HWTEST_F(EnqueueKernelTest, givenQueueWithoutScratchSizeLimitWhenKernelWithScratchIsEnqueuedThenItIsAccepted) {
+    SPatchMediaVFEState mediaVFEstate;
+    mediaVFEstate.PerThreadScratchSpace = 16384;
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    mockKernel.kernelInfo.patchInfo.mediavfestate = &mediaVFEstate;
+
+    EXPECT_EQ(0u, pCmdQ->getScratchSizeLimit());
+    size_t gws[3] = {1, 0, 0};
+    auto ret = pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, ret);
+}
+
 HWTEST_F(EnqueueKernelTest, givenCommandStreamReceiverInBatchingModeWhenEnqueueKernelIsCalledThenKernelIsRecorded) {
     auto mockCsr = new MockCsrHw2<FamilyType>(pDevice->getHardwareInfo(), *pDevice->executionEnvironment);
     mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
@@ -217,26 +217,26 @@ HWTEST_F(AubCommandStreamReceiverTests, givenGraphicsAllocationWhenMakeResidentC
 
     // First makeResident marks the allocation resident
     aubCsr->makeResident(*gfxAllocation);
-    EXPECT_NE(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(aubCsr->peekTaskCount() + 1, gfxAllocation->getTaskCount(0));
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(1u, aubCsr->getResidencyAllocations().size());
 
     // Second makeResident should have no impact
     aubCsr->makeResident(*gfxAllocation);
-    EXPECT_NE(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(aubCsr->peekTaskCount() + 1, gfxAllocation->getTaskCount(0));
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(1u, aubCsr->getResidencyAllocations().size());
 
     // First makeNonResident marks the allocation as nonresident
     aubCsr->makeNonResident(*gfxAllocation);
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(1u, aubCsr->getEvictionAllocations().size());
 
     // Second makeNonResident should have no impact
     aubCsr->makeNonResident(*gfxAllocation);
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
     EXPECT_EQ(1u, aubCsr->getEvictionAllocations().size());
 
     memoryManager->freeGraphicsMemoryImpl(gfxAllocation);
@@ -446,17 +446,17 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInStandalon
     BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
     auto engineType = OCLRT::ENGINE_RCS;
 
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
     aubCsr->flush(batchBuffer, engineType, allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_NE(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->makeSurfacePackNonResident(aubCsr->getResidencyAllocations(), *pDevice->getOsContext());
 
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 }
 
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInNonStandaloneModeWhenFlushIsCalledThenItShouldNotCallMakeResidentOnCommandBufferAllocation) {
@@ -468,11 +468,11 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInNonStanda
     BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
     auto engineType = OCLRT::ENGINE_RCS;
 
-    EXPECT_EQ(ObjectNotResident, aubExecutionEnvironment->commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, aubExecutionEnvironment->commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->flush(batchBuffer, engineType, allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_EQ(ObjectNotResident, aubExecutionEnvironment->commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, aubExecutionEnvironment->commandBuffer->getResidencyTaskCount(0u));
 }
 
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInStandaloneModeWhenFlushIsCalledThenItShouldCallMakeResidentOnResidencyAllocations) {
@@ -489,22 +489,22 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInStandalon
     auto engineType = OCLRT::ENGINE_RCS;
     ResidencyContainer allocationsForResidency = {gfxAllocation};
 
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
     aubCsr->flush(batchBuffer, engineType, allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_NE(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->getResidencyTaskCount(0u));
 
-    EXPECT_NE(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->makeSurfacePackNonResident(allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
@@ -522,15 +522,15 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInNonStanda
     auto engineType = OCLRT::ENGINE_RCS;
     ResidencyContainer allocationsForResidency = {gfxAllocation};
 
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->flush(batchBuffer, engineType, allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_NE(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->getResidencyTaskCount(0u));
 
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     memoryManager->freeGraphicsMemoryImpl(gfxAllocation);
 }
@@ -560,22 +560,22 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverInStandalon
     auto engineType = OCLRT::ENGINE_RCS;
     ResidencyContainer allocationsForResidency = {gfxAllocation};
 
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
     aubCsr->flush(batchBuffer, engineType, allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_NE(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, gfxAllocation->getResidencyTaskCount(0u));
 
-    EXPECT_NE(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
-    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_NE(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
+    EXPECT_EQ((int)aubCsr->peekTaskCount() + 1, commandBuffer->getResidencyTaskCount(0u));
 
     aubCsr->makeSurfacePackNonResident(allocationsForResidency, *pDevice->getOsContext());
 
-    EXPECT_EQ(ObjectNotResident, gfxAllocation->residencyTaskCount[0u]);
-    EXPECT_EQ(ObjectNotResident, commandBuffer->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, gfxAllocation->getResidencyTaskCount(0u));
+    EXPECT_EQ(ObjectNotResident, commandBuffer->getResidencyTaskCount(0u));
 
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
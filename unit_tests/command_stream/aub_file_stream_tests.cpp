@@ -7,13 +7,18 @@
 
 #include "runtime/aub_mem_dump/page_table_entry_bits.h"
 #include "runtime/command_stream/aub_command_stream_receiver_hw.h"
+#include "runtime/utilities/compressed_file_reader.h"
 #include "test.h"
 #include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_aub_csr.h"
 #include "unit_tests/mocks/mock_aub_file_stream.h"
 
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 using namespace OCLRT;
 
@@ -196,6 +201,182 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenExpectMMIOIsCalled
     }
 }
 
+HWTEST_F(AubFileStreamTests, givenAllocationBackedByContiguousPagesWhenWriteMemoryIsCalledThenPagesAreWrittenWithSingleMemoryWrite) {
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    std::unique_ptr<MemoryManager> memoryManager(aubCsr->createMemoryManager(false, false));
+
+    std::unique_ptr<AUBCommandStreamReceiver::AubFileStream> mockAubFileStream(std::make_unique<MockAubFileStream>());
+    MockAubFileStream *mockAubFileStreamPtr = static_cast<MockAubFileStream *>(mockAubFileStream.get());
+    aubCsr->stream = mockAubFileStreamPtr;
+
+    auto allocationSize = 4 * MemoryConstants::pageSize;
+    auto gfxAllocation = memoryManager->allocateGraphicsMemory(allocationSize, MemoryConstants::pageSize, false, false);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, mockAubFileStreamPtr->writeMemoryCalledCnt);
+    EXPECT_EQ(allocationSize, mockAubFileStreamPtr->sizeCapturedFromWriteMemory);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesSetWhenAllocationIsWrittenAgainThenOnlyModifiedPagesAreWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    ASSERT_NE(nullptr, aubCsr->dumpedPagesTracker.get());
+    std::unique_ptr<MemoryManager> memoryManager(aubCsr->createMemoryManager(false, false));
+
+    std::unique_ptr<AUBCommandStreamReceiver::AubFileStream> mockAubFileStream(std::make_unique<MockAubFileStream>());
+    MockAubFileStream *mockAubFileStreamPtr = static_cast<MockAubFileStream *>(mockAubFileStream.get());
+    aubCsr->stream = mockAubFileStreamPtr;
+
+    auto allocationSize = 4 * MemoryConstants::pageSize;
+    auto gfxAllocation = memoryManager->allocateGraphicsMemory(allocationSize, MemoryConstants::pageSize, false, false);
+    memset(gfxAllocation->getUnderlyingBuffer(), 0, allocationSize);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, mockAubFileStreamPtr->writeMemoryCalledCnt);
+    EXPECT_EQ(4u, aubCsr->dumpedPagesTracker->getTrackedPagesCount());
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, mockAubFileStreamPtr->writeMemoryCalledCnt);
+    EXPECT_EQ(4u, aubCsr->dumpedPagesTracker->peekSkippedPagesCount());
+
+    auto modifiedPage = ptrOffset(gfxAllocation->getUnderlyingBuffer(), 2 * MemoryConstants::pageSize);
+    memset(modifiedPage, 0xFF, 16);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(2u, mockAubFileStreamPtr->writeMemoryCalledCnt);
+    EXPECT_EQ(MemoryConstants::pageSize, mockAubFileStreamPtr->sizeCapturedFromWriteMemory);
+    EXPECT_EQ(7u, aubCsr->dumpedPagesTracker->peekSkippedPagesCount());
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesNotSetWhenAllocationIsWrittenAgainThenAllPagesAreWritten) {
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    EXPECT_EQ(nullptr, aubCsr->dumpedPagesTracker.get());
+    std::unique_ptr<MemoryManager> memoryManager(aubCsr->createMemoryManager(false, false));
+
+    std::unique_ptr<AUBCommandStreamReceiver::AubFileStream> mockAubFileStream(std::make_unique<MockAubFileStream>());
+    MockAubFileStream *mockAubFileStreamPtr = static_cast<MockAubFileStream *>(mockAubFileStream.get());
+    aubCsr->stream = mockAubFileStreamPtr;
+
+    auto allocationSize = 4 * MemoryConstants::pageSize;
+    auto gfxAllocation = memoryManager->allocateGraphicsMemory(allocationSize, MemoryConstants::pageSize, false, false);
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(2u, mockAubFileStreamPtr->writeMemoryCalledCnt);
+    EXPECT_EQ(allocationSize, mockAubFileStreamPtr->sizeCapturedFromWriteMemory);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesSetWhenNewAubFileIsOpenedThenDumpedPagesAreForgotten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>(**platformDevices, "", true, *pDevice->executionEnvironment);
+    std::unique_ptr<MemoryManager> memoryManager(aubCsr->createMemoryManager(false, false));
+    std::string fileName = "file_name.aub";
+
+    auto gfxAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, MemoryConstants::pageSize, false, false);
+
+    aubCsr->initFile(fileName);
+    ASSERT_TRUE(aubCsr->isFileOpen());
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(1u, aubCsr->dumpedPagesTracker->getTrackedPagesCount());
+
+    aubCsr->closeFile();
+    aubCsr->initFile(fileName);
+    EXPECT_EQ(0u, aubCsr->dumpedPagesTracker->getTrackedPagesCount());
+
+    aubCsr->closeFile();
+    std::remove(fileName.c_str());
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(AubFileStreamTests, givenAsyncWriteBufferSizeSetWhenAubFileIsOpenedThenDataIsWrittenThroughAsyncWriter) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpAsyncWriteBufferSize.set(64);
+
+    std::string fileName = "async_file_name.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    ASSERT_TRUE(aubFileStream.isOpen());
+    ASSERT_NE(nullptr, aubFileStream.asyncWriter.get());
+
+    std::vector<char> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i);
+    }
+    aubFileStream.write(data.data(), data.size());
+    aubFileStream.close();
+    EXPECT_EQ(nullptr, aubFileStream.asyncWriter.get());
+
+    std::ifstream aubFile(fileName, std::ifstream::binary);
+    std::vector<char> dataRead((std::istreambuf_iterator<char>(aubFile)), std::istreambuf_iterator<char>());
+    aubFile.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(data, dataRead);
+}
+
+HWTEST_F(AubFileStreamTests, givenCompressionBlockSizeSetWhenAubFileIsWrittenThenFileContainsCompressedContainerWithWrittenData) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpCompressionBlockSize.set(4096);
+    DebugManager.flags.AubDumpAsyncWriteBufferSize.set(64);
+
+    std::string fileName = "compressed_file_name.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    ASSERT_TRUE(aubFileStream.isOpen());
+    ASSERT_NE(nullptr, aubFileStream.asyncWriter.get());
+    EXPECT_EQ(4096u, aubFileStream.asyncWriter->getBufferSize());
+
+    std::vector<char> data(10000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i % 16);
+    }
+    aubFileStream.write(data.data(), data.size());
+    aubFileStream.close();
+
+    std::ifstream aubFile(fileName, std::ifstream::binary);
+    CompressedFileReader reader(aubFile);
+    ASSERT_TRUE(reader.isValid());
+    std::stringstream dataRead;
+    EXPECT_TRUE(reader.decompress(dataRead));
+    aubFile.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(std::string(data.begin(), data.end()), dataRead.str());
+}
+
+HWTEST_F(AubFileStreamTests, givenUnknownCompressionCodecWhenAubFileIsOpenedThenFileIsNotCompressed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpCompressionBlockSize.set(4096);
+    DebugManager.flags.AubDumpCompressionCodec.set(0);
+
+    std::string fileName = "file_name.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    EXPECT_TRUE(aubFileStream.isOpen());
+    EXPECT_EQ(nullptr, aubFileStream.asyncWriter.get());
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+}
+
+HWTEST_F(AubFileStreamTests, givenAsyncWriteBufferSizeNotSetWhenAubFileIsOpenedThenAsyncWriterIsNotCreated) {
+    std::string fileName = "file_name.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    EXPECT_EQ(nullptr, aubFileStream.asyncWriter.get());
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+}
+
 HWTEST_F(AubFileStreamTests, givenAddPatchInfoCommentsCalledWhenNoPatchInfoDataObjectsThenCommentsAreEmpty) {
     auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(false, true, true);
     auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
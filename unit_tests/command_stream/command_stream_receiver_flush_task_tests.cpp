@@ -15,6 +15,7 @@
 #include "runtime/event/user_event.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/array_count.h"
 #include "runtime/helpers/cache_policy.h"
 #include "runtime/helpers/preamble.h"
 #include "runtime/helpers/ptr_math.h"
@@ -1711,6 +1712,169 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, InForced32BitAllocationsModeStore3
     }
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenScratchSizesWithinOneTierWhenFlushedThenScratchAllocationAndMediaVfeStateAreNotReprogrammed) {
+    auto commandStreamReceiver = new MockCsrHw<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(commandStreamReceiver);
+
+    commandStreamReceiver->setRequiredScratchSize(1500);
+    flushTask(*commandStreamReceiver);
+    auto scratchAllocation = commandStreamReceiver->getScratchAllocation();
+    ASSERT_NE(nullptr, scratchAllocation);
+    EXPECT_EQ(2048u, commandStreamReceiver->requiredScratchSize);
+    EXPECT_EQ(1u, commandStreamReceiver->getScratchSpaceManager().getStats().vfeReprogramsCount);
+
+    commandStreamReceiver->setRequiredScratchSize(2000);
+    flushTask(*commandStreamReceiver);
+    commandStreamReceiver->setRequiredScratchSize(1024);
+    flushTask(*commandStreamReceiver);
+
+    EXPECT_EQ(scratchAllocation, commandStreamReceiver->getScratchAllocation());
+    auto stats = commandStreamReceiver->getScratchSpaceManager().getStats();
+    EXPECT_EQ(0u, stats.reallocationsCount);
+    EXPECT_EQ(1u, stats.vfeReprogramsCount);
+
+    commandStreamReceiver->setRequiredScratchSize(2049);
+    flushTask(*commandStreamReceiver);
+
+    EXPECT_NE(scratchAllocation, commandStreamReceiver->getScratchAllocation());
+    EXPECT_EQ(4096u, commandStreamReceiver->requiredScratchSize);
+    stats = commandStreamReceiver->getScratchSpaceManager().getStats();
+    EXPECT_EQ(1u, stats.reallocationsCount);
+    EXPECT_EQ(2u, stats.vfeReprogramsCount);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenHigherTaskLevelWhenStateBaseAddressIsProgrammedThenDependencyPipeControlIsNotAdded) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    typedef typename FamilyType::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.timestampPacketWriteEnabled = false;
+
+    configureCSRtoNonDirtyState<FamilyType>();
+    commandStreamReceiver.latestSentStatelessMocsConfig = CacheSettings::l3CacheOff;
+    commandStreamReceiver.taskLevel = taskLevel / 2;
+
+    flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(taskLevel, commandStreamReceiver.peekTaskLevel());
+    auto &stats = commandStreamReceiver.getFlushTaskStats();
+    EXPECT_EQ(1u, stats.stateBaseAddressCount);
+    EXPECT_EQ(0u, stats.dependencyPipeControlCount);
+    EXPECT_EQ(1u, stats.elidedDependencyPipeControlCount);
+
+    parseCommands<FamilyType>(commandStreamReceiver.commandStream, 0);
+    auto itorSba = find<STATE_BASE_ADDRESS *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorSba);
+    // stalling pipe control programmed with state base address waits for previous walkers
+    EXPECT_NE(itorSba, find<PIPE_CONTROL *>(cmdList.begin(), itorSba));
+    EXPECT_EQ(cmdList.end(), find<PIPE_CONTROL *>(itorSba, cmdList.end()));
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenHigherTaskLevelAndNonDirtyStateWhenFlushTaskIsCalledThenDependencyPipeControlIsCounted) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.timestampPacketWriteEnabled = false;
+
+    configureCSRtoNonDirtyState<FamilyType>();
+    commandStreamReceiver.taskLevel = taskLevel / 2;
+
+    flushTask(commandStreamReceiver);
+
+    auto &stats = commandStreamReceiver.getFlushTaskStats();
+    EXPECT_EQ(1u, stats.flushesCount);
+    EXPECT_EQ(0u, stats.stateBaseAddressCount);
+    EXPECT_EQ(0u, stats.mediaVfeStateCount);
+    EXPECT_EQ(1u, stats.dependencyPipeControlCount);
+    EXPECT_EQ(0u, stats.elidedDependencyPipeControlCount);
+    EXPECT_EQ(commandStreamReceiver.commandStream.getUsed(), stats.csrStreamBytes);
+    EXPECT_EQ(commandStream.getUsed(), stats.taskStreamBytes);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenHigherTaskLevelWhenPipeControlsWithoutDcFlushAreProgrammedThenDependencyPipeControlIsStillAdded) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.timestampPacketWriteEnabled = false;
+
+    configureCSRtoNonDirtyState<FamilyType>();
+    commandStreamReceiver.taskLevel = taskLevel / 2;
+    commandStreamReceiver.stallingPipeControlOnNextFlushRequired = true;
+    commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+    auto waTable = const_cast<WorkaroundTable *>(pDevice->getWaTable());
+    bool tmp = waTable->waSamplerCacheFlushBetweenRedescribedSurfaceReads;
+    waTable->waSamplerCacheFlushBetweenRedescribedSurfaceReads = true;
+
+    flushTask(commandStreamReceiver);
+
+    auto &stats = commandStreamReceiver.getFlushTaskStats();
+    EXPECT_EQ(0u, stats.stateBaseAddressCount);
+    EXPECT_EQ(1u, stats.dependencyPipeControlCount);
+    EXPECT_EQ(0u, stats.elidedDependencyPipeControlCount);
+    waTable->waSamplerCacheFlushBetweenRedescribedSurfaceReads = tmp;
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenUnchangedGeneralStateBaseAddressWhenScratchIsNotReallocatedThenStateBaseAddressIsNotReprogrammed) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    commandStreamReceiver.setRequiredScratchSize(1024);
+    flushTask(commandStreamReceiver);
+    EXPECT_EQ(1u, commandStreamReceiver.getFlushTaskStats().stateBaseAddressCount);
+
+    uint64_t expectedGSHbase = 0;
+    auto force32BitAllocations = pDevice->getMemoryManager()->peekForce32BitAllocations();
+    if (is64bit && !force32BitAllocations) {
+        expectedGSHbase = (uint64_t)commandStreamReceiver.getScratchAllocation()->getUnderlyingBuffer() - PreambleHelper<FamilyType>::getScratchSpaceOffsetFor64bit();
+    }
+    EXPECT_EQ(expectedGSHbase, commandStreamReceiver.lastSentGeneralStateBaseAddress);
+
+    commandStreamReceiver.setRequiredScratchSize(1000);
+    flushTask(commandStreamReceiver);
+    EXPECT_EQ(1u, commandStreamReceiver.getFlushTaskStats().stateBaseAddressCount);
+
+    commandStreamReceiver.setRequiredScratchSize(4096);
+    flushTask(commandStreamReceiver);
+    uint64_t expectedStateBaseAddressCount = (is64bit && !force32BitAllocations) ? 2u : 1u;
+    EXPECT_EQ(expectedStateBaseAddressCount, commandStreamReceiver.getFlushTaskStats().stateBaseAddressCount);
+    EXPECT_EQ(3u, commandStreamReceiver.getFlushTaskStats().flushesCount);
+    EXPECT_EQ(2u, commandStreamReceiver.getFlushTaskStats().mediaVfeStateCount);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenPrintFlushTaskStatsFlagWhenFlushTaskIsCalledThenStatsOfThisFlushArePrinted) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.PrintFlushTaskStats.set(true);
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    configureCSRtoNonDirtyState<FamilyType>();
+
+    testing::internal::CaptureStdout();
+    flushTask(commandStreamReceiver);
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("flushTask 1: 0 STATE_BASE_ADDRESS, 0 MEDIA_VFE_STATE, 0 dependency PIPE_CONTROL (0 elided)"));
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenKernelsEnqueuedWithStableHeapsWhenFlushedThenStateIsProgrammedOnlyOnce) {
+    MockContext ctx(pDevice);
+    CommandQueueHw<FamilyType> commandQueue(&ctx, pDevice, 0);
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    // scratch sizes of all kernels fit in tier of the first one
+    uint32_t scratchSizes[] = {1024, 700, 0, 1024, 512, 1000};
+    SPatchMediaVFEState mediaVFEstate = {};
+    size_t gws = 1;
+    for (auto scratchSize : scratchSizes) {
+        MockKernelWithInternals kernel(*pDevice);
+        mediaVFEstate.PerThreadScratchSpace = scratchSize;
+        kernel.kernelInfo.patchInfo.mediavfestate = &mediaVFEstate;
+
+        auto retVal = commandQueue.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+    commandQueue.finish();
+
+    auto &stats = commandStreamReceiver.getFlushTaskStats();
+    EXPECT_LE(arrayCount(scratchSizes), stats.flushesCount);
+    EXPECT_EQ(1u, stats.stateBaseAddressCount);
+    EXPECT_EQ(1u, stats.mediaVfeStateCount);
+    EXPECT_EQ(commandStreamReceiver.commandStream.getUsed(), stats.csrStreamBytes);
+}
+
 TEST(CacheSettings, GivenCacheSettingWhenCheckedForValuesThenProperValuesAreSelected) {
     EXPECT_EQ(static_cast<uint32_t>(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED), CacheSettings::l3CacheOff);
     EXPECT_EQ(static_cast<uint32_t>(GMM_RESOURCE_USAGE_OCL_BUFFER), CacheSettings::l3CacheOn);
@@ -2320,7 +2484,7 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenRecorded
 
     for (auto &graphicsAllocation : residentSurfaces) {
         EXPECT_TRUE(graphicsAllocation->isResident(0u));
-        EXPECT_EQ(1, graphicsAllocation->residencyTaskCount[0u]);
+        EXPECT_EQ(1, graphicsAllocation->getResidencyTaskCount(0u));
     }
 
     mockCsr->flushBatchedSubmissions();
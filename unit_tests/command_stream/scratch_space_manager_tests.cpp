@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/scratch_space_manager.h"
+#include "unit_tests/mocks/mock_graphics_allocation.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+namespace {
+class ScratchSpaceManagerUnderTest : public ScratchSpaceManager {
+  public:
+    using ScratchSpaceManager::startTime;
+};
+} // namespace
+
+TEST(ScratchSpaceManagerTest, givenPerThreadScratchSizeWhenTierIsQueriedThenSizeIsRoundedUpToPowerOfTwoOfAtLeastOneKilobyte) {
+    EXPECT_EQ(0u, ScratchSpaceManager::getTierSize(0));
+    EXPECT_EQ(1024u, ScratchSpaceManager::getTierSize(1));
+    EXPECT_EQ(1024u, ScratchSpaceManager::getTierSize(123));
+    EXPECT_EQ(1024u, ScratchSpaceManager::getTierSize(1024));
+    EXPECT_EQ(2048u, ScratchSpaceManager::getTierSize(1025));
+    EXPECT_EQ(4096u, ScratchSpaceManager::getTierSize(3000));
+    EXPECT_EQ(16384u, ScratchSpaceManager::getTierSize(8196));
+}
+
+TEST(ScratchSpaceManagerTest, givenCurrentAllocationWhenRequiredSizeIsCheckedThenAllocationIsRequiredOnlyWhenItDoesNotFit) {
+    ScratchSpaceManager manager;
+    MockGraphicsAllocation allocation(nullptr, 0x2000);
+
+    EXPECT_FALSE(manager.isAllocationRequired(0, nullptr));
+    EXPECT_TRUE(manager.isAllocationRequired(0x1000, nullptr));
+    EXPECT_FALSE(manager.isAllocationRequired(0x1000, &allocation));
+    EXPECT_FALSE(manager.isAllocationRequired(0x2000, &allocation));
+    EXPECT_TRUE(manager.isAllocationRequired(0x2001, &allocation));
+}
+
+TEST(ScratchSpaceManagerTest, givenRecordedEventsWhenStatsAreQueriedThenCountsAndRatesAreReturned) {
+    ScratchSpaceManagerUnderTest manager;
+    manager.startTime -= std::chrono::seconds(2);
+
+    manager.recordReallocation();
+    manager.recordVfeReprogram();
+    manager.recordVfeReprogram();
+    manager.recordVfeReprogram();
+    manager.recordVfeReprogram();
+
+    auto stats = manager.getStats();
+    EXPECT_EQ(1u, stats.reallocationsCount);
+    EXPECT_EQ(4u, stats.vfeReprogramsCount);
+    EXPECT_LE(2.0, stats.elapsedSeconds);
+    EXPECT_GE(0.5, stats.getReallocationsPerSecond());
+    EXPECT_LT(0.0, stats.getReallocationsPerSecond());
+    EXPECT_GE(2.0, stats.getVfeReprogramsPerSecond());
+    EXPECT_LT(0.0, stats.getVfeReprogramsPerSecond());
+}
+
+TEST(ScratchSpaceManagerTest, givenNoElapsedTimeWhenRatesAreQueriedThenZeroIsReturned) {
+    ScratchSpaceStats stats;
+    stats.reallocationsCount = 3;
+    stats.vfeReprogramsCount = 3;
+    EXPECT_EQ(0.0, stats.getReallocationsPerSecond());
+    EXPECT_EQ(0.0, stats.getVfeReprogramsPerSecond());
+}
@@ -15,6 +15,7 @@
 #include "unit_tests/mocks/mock_csr.h"
 #include "unit_tests/mocks/mock_command_queue.h"
 #include "unit_tests/mocks/mock_graphics_allocation.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 
 using namespace OCLRT;
 
@@ -479,6 +480,85 @@ TEST(SubmissionsAggregator, dontAllocateFlushStamp) {
     EXPECT_EQ(nullptr, cmdBuffer.flushStamp->getStampReference());
 }
 
+TEST(BatchedDependencyTracker, givenNoStallWhenDependencyIsCheckedThenCommandBufferIsDependent) {
+    BatchedDependencyTracker dependencyTracker;
+    SurfacesAccess surfacesAccess;
+    EXPECT_TRUE(dependencyTracker.isDependent(&surfacesAccess));
+
+    dependencyTracker.stall();
+    EXPECT_FALSE(dependencyTracker.isDependent(&surfacesAccess));
+    EXPECT_TRUE(dependencyTracker.isDependent(nullptr));
+}
+
+TEST(BatchedDependencyTracker, givenCommandBuffersAccessingDisjointAllocationsWhenDependencyIsCheckedThenCommandBufferIsIndependent) {
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc2(nullptr, 2);
+    MockGraphicsAllocation alloc3(nullptr, 3);
+
+    SurfacesAccess first;
+    first.readAllocations.push_back(&alloc1);
+    first.writtenAllocations.push_back(&alloc2);
+    SurfacesAccess second;
+    second.readAllocations.push_back(&alloc1);
+    second.writtenAllocations.push_back(&alloc3);
+
+    BatchedDependencyTracker dependencyTracker;
+    dependencyTracker.stall();
+    dependencyTracker.addCommandBuffer(&first);
+    EXPECT_FALSE(dependencyTracker.isDependent(&second));
+}
+
+TEST(BatchedDependencyTracker, givenAllocationWrittenSinceLastStallWhenItIsAccessedThenCommandBufferIsDependent) {
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc2(nullptr, 2);
+
+    SurfacesAccess writer;
+    writer.writtenAllocations.push_back(&alloc1);
+    SurfacesAccess independent;
+    independent.writtenAllocations.push_back(&alloc2);
+    SurfacesAccess reader;
+    reader.readAllocations.push_back(&alloc1);
+    SurfacesAccess secondWriter;
+    secondWriter.writtenAllocations.push_back(&alloc1);
+
+    BatchedDependencyTracker dependencyTracker;
+    dependencyTracker.stall();
+    dependencyTracker.addCommandBuffer(&writer);
+    dependencyTracker.addCommandBuffer(&independent);
+    EXPECT_TRUE(dependencyTracker.isDependent(&reader));
+    EXPECT_TRUE(dependencyTracker.isDependent(&secondWriter));
+
+    dependencyTracker.stall();
+    EXPECT_FALSE(dependencyTracker.isDependent(&reader));
+}
+
+TEST(BatchedDependencyTracker, givenAllocationReadSinceLastStallWhenItIsWrittenThenCommandBufferIsDependent) {
+    MockGraphicsAllocation alloc1(nullptr, 1);
+
+    SurfacesAccess reader;
+    reader.readAllocations.push_back(&alloc1);
+    SurfacesAccess writer;
+    writer.writtenAllocations.push_back(&alloc1);
+
+    BatchedDependencyTracker dependencyTracker;
+    dependencyTracker.stall();
+    dependencyTracker.addCommandBuffer(&reader);
+    EXPECT_FALSE(dependencyTracker.isDependent(&reader));
+    EXPECT_TRUE(dependencyTracker.isDependent(&writer));
+}
+
+TEST(BatchedDependencyTracker, givenCommandBufferOfUnknownAccessWhenAddedThenFollowingCommandBuffersAreDependentUntilStall) {
+    SurfacesAccess surfacesAccess;
+
+    BatchedDependencyTracker dependencyTracker;
+    dependencyTracker.stall();
+    dependencyTracker.addCommandBuffer(nullptr);
+    EXPECT_TRUE(dependencyTracker.isDependent(&surfacesAccess));
+
+    dependencyTracker.stall();
+    EXPECT_FALSE(dependencyTracker.isDependent(&surfacesAccess));
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
@@ -609,3 +689,118 @@ HWTEST_F(SubmissionsAggregatorTests, givenMultipleCmdBuffersWhenNotAggregatedDur
     castToObject<Event>(event1)->release();
     castToObject<Event>(event2)->release();
 }
+
+HWTEST_F(SubmissionsAggregatorTests, givenChainOfIndependentKernelsWhenFlushedThenPipeControlsBetweenThemAreNoopedAndLastEpilogueFlushesDc) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *device->executionEnvironment);
+    overrideCsr(mockCsr);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    const uint64_t kernelsCount = 100;
+    size_t GWS = 1;
+    MockKernelWithInternals kernel(*device.get());
+    // returned events keep epilogue pipe control of in-order queue from being nooped unconditionally
+    std::vector<cl_event> events(kernelsCount);
+    for (uint64_t i = 0; i < kernelsCount; i++) {
+        cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, &events[i]);
+    }
+
+    std::vector<void *> epiloguePipeControls;
+    for (auto cmdBuffer = mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekHead(); cmdBuffer; cmdBuffer = cmdBuffer->next) {
+        EXPECT_EQ(nullptr, cmdBuffer->pipeControlThatMayBeErasedLocation);
+        EXPECT_EQ(cmdBuffer->epiloguePipeControlLocation, cmdBuffer->pipeControlThatMayBeErasedIfIndependentLocation);
+        epiloguePipeControls.push_back(cmdBuffer->epiloguePipeControlLocation);
+    }
+    ASSERT_EQ(kernelsCount, epiloguePipeControls.size());
+
+    // first task is covered by pipe control programmed with state base address
+    auto &stats = mockCsr->getFlushTaskStats();
+    EXPECT_EQ(kernelsCount - 1, stats.dependencyPipeControlCount);
+    auto elidedInFlushTask = stats.elidedDependencyPipeControlCount;
+
+    mockCsr->flushBatchedSubmissions();
+
+    EXPECT_EQ(0u, stats.dependencyPipeControlCount);
+    EXPECT_EQ(elidedInFlushTask + kernelsCount - 1, stats.elidedDependencyPipeControlCount);
+
+    PIPE_CONTROL noopedPipeControl;
+    memset(&noopedPipeControl, 0, sizeof(PIPE_CONTROL));
+    for (uint64_t i = 0; i < kernelsCount - 1; i++) {
+        EXPECT_EQ(0, memcmp(&noopedPipeControl, epiloguePipeControls[i], sizeof(PIPE_CONTROL)));
+    }
+    auto lastEpiloguePipeControl = reinterpret_cast<PIPE_CONTROL *>(epiloguePipeControls.back());
+    EXPECT_TRUE(lastEpiloguePipeControl->getCommandStreamerStallEnable());
+    EXPECT_TRUE(lastEpiloguePipeControl->getDcFlushEnable());
+
+    for (auto event : events) {
+        castToObject<Event>(event)->release();
+    }
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenChainOfKernelsWritingSameAllocationWhenFlushedThenStallIsKeptBetweenThem) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *device->executionEnvironment);
+    overrideCsr(mockCsr);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    auto sharedAllocation = device->getMemoryManager()->allocateGraphicsMemory(MemoryConstants::pageSize);
+    const uint64_t kernelsCount = 10;
+    size_t GWS = 1;
+    MockKernelWithInternals kernel(*device.get());
+    kernel.mockKernel->setKernelExecInfo(sharedAllocation);
+    // returned events keep epilogue pipe control of in-order queue from being nooped unconditionally
+    std::vector<cl_event> events(kernelsCount);
+    for (uint64_t i = 0; i < kernelsCount; i++) {
+        cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, &events[i]);
+    }
+
+    std::vector<void *> epiloguePipeControls;
+    for (auto cmdBuffer = mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekHead(); cmdBuffer; cmdBuffer = cmdBuffer->next) {
+        ASSERT_NE(nullptr, cmdBuffer->surfacesAccess.get());
+        epiloguePipeControls.push_back(cmdBuffer->epiloguePipeControlLocation);
+    }
+    ASSERT_EQ(kernelsCount, epiloguePipeControls.size());
+
+    auto &stats = mockCsr->getFlushTaskStats();
+    auto elidedInFlushTask = stats.elidedDependencyPipeControlCount;
+
+    mockCsr->flushBatchedSubmissions();
+
+    // kept epilogue pipe control stalls before walkers of the next kernel, so its dependency pipe control is redundant
+    EXPECT_EQ(0u, stats.dependencyPipeControlCount);
+    EXPECT_EQ(elidedInFlushTask + kernelsCount - 1, stats.elidedDependencyPipeControlCount);
+
+    for (uint64_t i = 0; i < kernelsCount - 1; i++) {
+        auto epiloguePipeControl = reinterpret_cast<PIPE_CONTROL *>(epiloguePipeControls[i]);
+        EXPECT_TRUE(epiloguePipeControl->getCommandStreamerStallEnable());
+    }
+    auto lastEpiloguePipeControl = reinterpret_cast<PIPE_CONTROL *>(epiloguePipeControls.back());
+    EXPECT_TRUE(lastEpiloguePipeControl->getCommandStreamerStallEnable());
+    EXPECT_TRUE(lastEpiloguePipeControl->getDcFlushEnable());
+
+    for (auto event : events) {
+        castToObject<Event>(event)->release();
+    }
+    device->getMemoryManager()->freeGraphicsMemory(sharedAllocation);
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedDependencyAnalysisDisabledWhenChainOfIndependentKernelsIsFlushedThenDependencyPipeControlsAreKept) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DisableBatchedDependencyAnalysis.set(true);
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*platformDevices[0], *device->executionEnvironment);
+    overrideCsr(mockCsr);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    const uint64_t kernelsCount = 100;
+    size_t GWS = 1;
+    MockKernelWithInternals kernel(*device.get());
+    for (uint64_t i = 0; i < kernelsCount; i++) {
+        cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, nullptr);
+    }
+    mockCsr->flushBatchedSubmissions();
+
+    EXPECT_EQ(kernelsCount - 1, mockCsr->getFlushTaskStats().dependencyPipeControlCount);
+}
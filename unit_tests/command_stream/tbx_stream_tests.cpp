@@ -26,3 +26,14 @@ TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenTypeIsZero) {
     mockTbxStream->writePTE(0, 0, 0);
     EXPECT_EQ(0u, mockTbxSocket->typeCapturedFromWriteMemory);
 }
+
+TEST(TbxStreamTests, givenTbxStreamWhenFlushIsCalledThenSocketIsFlushed) {
+    std::unique_ptr<TbxCommandStreamReceiver::TbxStream> mockTbxStream(new MockTbxStream());
+    MockTbxStream *mockTbxStreamPtr = static_cast<MockTbxStream *>(mockTbxStream.get());
+
+    MockTbxSockets *mockTbxSocket = new MockTbxSockets();
+    mockTbxStreamPtr->socket = mockTbxSocket;
+
+    mockTbxStream->flush();
+    EXPECT_EQ(1u, mockTbxSocket->flushCalledCount);
+}
@@ -302,6 +302,48 @@ TEST_F(BinaryCacheTests, cacheThenLoad) {
     EXPECT_TRUE(ret);
 }
 
+TEST_F(BinaryCacheTests, givenCachedBinaryWhenLoadedThenProgramGenBinaryHasCachedContent) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    static const char *hash = "SOME_OTHER_HASH";
+    char data[64];
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = static_cast<char>(i * 3);
+
+    EXPECT_TRUE(cache->cacheBinary(hash, data, sizeof(data)));
+    EXPECT_TRUE(cache->loadCachedBinary(hash, program));
+
+    size_t genBinarySize = 0;
+    auto genBinary = program.getGenBinary(genBinarySize);
+    ASSERT_EQ(sizeof(data), genBinarySize);
+    EXPECT_EQ(0, memcmp(data, genBinary, sizeof(data)));
+
+    program.storeGenBinary(data, 16);
+    genBinary = program.getGenBinary(genBinarySize);
+    EXPECT_EQ(16u, genBinarySize);
+    EXPECT_EQ(0, memcmp(data, genBinary, 16));
+}
+
+TEST_F(BinaryCacheTests, givenLoadedCachedBinaryWhenBinaryIsCachedAgainThenLoadedProgramKeepsPreviousContent) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    static const char *hash = "SOME_RECACHED_HASH";
+    char data[64];
+    char newData[128];
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = static_cast<char>(i * 5);
+    memset(newData, 0xFF, sizeof(newData));
+
+    EXPECT_TRUE(cache->cacheBinary(hash, data, sizeof(data)));
+    EXPECT_TRUE(cache->loadCachedBinary(hash, program));
+    cache->cacheBinary(hash, newData, sizeof(newData));
+
+    size_t genBinarySize = 0;
+    auto genBinary = program.getGenBinary(genBinarySize);
+    ASSERT_EQ(sizeof(data), genBinarySize);
+    EXPECT_EQ(0, memcmp(data, genBinary, sizeof(data)));
+}
+
 TEST_F(CompilerInterfaceCachedTests, canInjectCache) {
     std::unique_ptr<BinaryCache> cache(new BinaryCache());
     auto res1 = pCompilerInterface->replaceBinaryCache(cache.get());
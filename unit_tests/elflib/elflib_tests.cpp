@@ -104,3 +104,79 @@ TEST_F(ElfTests, givenInvalidBinaryStorageThenExceptionIsThrown) {
 
     EXPECT_THROW(CElfReader elfReader(binary), ElfException);
 }
+
+TEST_F(ElfTests, givenNamedSectionsWhenWriteToBinaryThenSectionNamesCanBeRead) {
+    CElfWriter writer(E_EH_TYPE::EH_TYPE_EXECUTABLE, E_EH_MACHINE::EH_MACHINE_NONE, 0);
+
+    std::string data{"data pattern"};
+    writer.addSection(SSectionNode(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, E_SH_FLAG::SH_FLAG_NONE, "first", data, static_cast<uint32_t>(data.size())));
+    writer.addSection(SSectionNode(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, E_SH_FLAG::SH_FLAG_NONE, "second", data, static_cast<uint32_t>(data.size())));
+
+    ElfBinaryStorage binary(writer.getTotalBinarySize());
+    writer.resolveBinary(binary);
+
+    CElfReader elfReader(binary);
+    ASSERT_EQ(4u, elfReader.getSectionHeaders().size());
+    EXPECT_STREQ("", elfReader.getSectionName(elfReader.getSectionHeaders()[0]));
+    EXPECT_STREQ("first", elfReader.getSectionName(elfReader.getSectionHeaders()[1]));
+    EXPECT_STREQ("second", elfReader.getSectionName(elfReader.getSectionHeaders()[2]));
+
+    SElf64SectionHeader outOfRangeName = elfReader.getSectionHeaders()[1];
+    outOfRangeName.Name = static_cast<Elf64_Word>(elfReader.getSectionHeaders()[3].DataSize);
+    EXPECT_STREQ("", elfReader.getSectionName(outOfRangeName));
+}
+
+TEST_F(ElfTests, givenBinaryWhenReadWithViewThenSectionsPointIntoBinaryAndNothingIsAllocated) {
+    CElfWriter writer(E_EH_TYPE::EH_TYPE_EXECUTABLE, E_EH_MACHINE::EH_MACHINE_NONE, 0);
+
+    std::string data{"data pattern"};
+    writer.addSection(SSectionNode(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, E_SH_FLAG::SH_FLAG_NONE, "first", data, static_cast<uint32_t>(data.size())));
+
+    ElfBinaryStorage binary(writer.getTotalBinarySize());
+    writer.resolveBinary(binary);
+
+    auto allocationsBefore = MemoryManagement::numAllocations.load();
+    CElfReaderView elfReader(binary.data(), binary.size());
+    ASSERT_EQ(3u, elfReader.getNumSections());
+    auto section = elfReader.getSection(1);
+    EXPECT_EQ(allocationsBefore, MemoryManagement::numAllocations.load());
+
+    EXPECT_EQ(binary.data(), elfReader.getBinary());
+    EXPECT_EQ(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, section.type);
+    EXPECT_STREQ("first", section.name);
+    ASSERT_EQ(data.size(), section.dataSize);
+    EXPECT_LT(binary.data(), section.data);
+    EXPECT_GT(binary.data() + binary.size(), section.data);
+    EXPECT_EQ(data, std::string(section.data, section.dataSize));
+}
+
+TEST_F(ElfTests, givenTruncatedBinaryWhenReadWithViewThenExceptionIsThrown) {
+    CElfWriter writer(E_EH_TYPE::EH_TYPE_EXECUTABLE, E_EH_MACHINE::EH_MACHINE_NONE, 0);
+
+    std::string data{"data pattern"};
+    writer.addSection(SSectionNode(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, E_SH_FLAG::SH_FLAG_NONE, "first", data, static_cast<uint32_t>(data.size())));
+
+    ElfBinaryStorage binary(writer.getTotalBinarySize());
+    writer.resolveBinary(binary);
+
+    EXPECT_THROW(CElfReaderView(nullptr, binary.size()), ElfException);
+    for (size_t size = 0; size < binary.size(); size++) {
+        EXPECT_THROW(CElfReaderView(binary.data(), size), ElfException);
+    }
+}
+
+TEST_F(ElfTests, givenSectionDataOutsideOfBinaryWhenReadWithViewThenExceptionIsThrown) {
+    CElfWriter writer(E_EH_TYPE::EH_TYPE_EXECUTABLE, E_EH_MACHINE::EH_MACHINE_NONE, 0);
+
+    std::string data{"data pattern"};
+    writer.addSection(SSectionNode(E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, E_SH_FLAG::SH_FLAG_NONE, "first", data, static_cast<uint32_t>(data.size())));
+
+    ElfBinaryStorage binary(writer.getTotalBinarySize());
+    writer.resolveBinary(binary);
+
+    CElfReaderView elfReader(binary.data(), binary.size());
+    auto sectionHeader = reinterpret_cast<SElf64SectionHeader *>(binary.data() + elfReader.getElfHeader()->SectionHeadersOffset + elfReader.getElfHeader()->SectionHeaderEntrySize);
+    sectionHeader->DataOffset = static_cast<Elf64_Off>(binary.size());
+
+    EXPECT_THROW(CElfReaderView(binary.data(), binary.size()), ElfException);
+}
@@ -12,6 +12,9 @@
 #include "runtime/platform/platform.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_async_event_handler.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
 #include "test.h"
 #include "gmock/gmock.h"
 
@@ -366,3 +369,148 @@ TEST_F(AsyncEventsHandlerTests, asyncProcessCallsProcessListBeforeReturning) {
 
     event->release();
 }
+
+class AsyncEventsHandlerCompletionHeapTests : public AsyncEventsHandlerTests {
+  public:
+    class CountingEvent : public Event {
+      public:
+        CountingEvent(CommandQueue *cmdQueue, uint32_t taskCount)
+            : Event(cmdQueue, CL_COMMAND_NDRANGE_KERNEL, 0, taskCount) {}
+
+        void updateExecutionStatus() override {
+            updateCount++;
+            Event::updateExecutionStatus();
+        }
+
+        uint32_t updateCount = 0;
+    };
+
+    void SetUp() override {
+        AsyncEventsHandlerTests::SetUp();
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        cmdQ.reset(new MockCommandQueue(&context, device.get(), 0));
+        *device->getTagAddress() = 0;
+    }
+
+    void TearDown() override {
+        handler.reset();
+        cmdQ.reset();
+        device.reset();
+        AsyncEventsHandlerTests::TearDown();
+    }
+
+    CountingEvent *createEventWithCallback(CommandQueue *queue, uint32_t taskCount, int *callbackCounter) {
+        auto event = new CountingEvent(queue, taskCount);
+        event->addCallback(&this->callbackFcn, CL_COMPLETE, callbackCounter);
+        handler->registerEvent(event);
+        event->updateCount = 0;
+        return event;
+    }
+
+    MockContext context;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockCommandQueue> cmdQ;
+};
+
+TEST_F(AsyncEventsHandlerCompletionHeapTests, givenSubmittedEventsWhenProcessedThenOnlyEventsWithTaskCountNotGreaterThanTagAreUpdated) {
+    int completeCounter = 0;
+    auto heapEvent1 = createEventWithCallback(cmdQ.get(), 1, &completeCounter);
+    auto heapEvent2 = createEventWithCallback(cmdQ.get(), 2, &completeCounter);
+    auto heapEvent3 = createEventWithCallback(cmdQ.get(), 3, &completeCounter);
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(heapEvent1, sleepCandidate);
+    EXPECT_EQ(0u, handler->peekUnsortedListSize());
+    ASSERT_EQ(1u, handler->completionHeaps.size());
+    EXPECT_EQ(3u, handler->completionHeaps[0].events.size());
+
+    handler->process();
+    EXPECT_EQ(1u, heapEvent1->updateCount);
+    EXPECT_EQ(1u, heapEvent2->updateCount);
+    EXPECT_EQ(1u, heapEvent3->updateCount);
+
+    *device->getTagAddress() = 2;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(heapEvent3, sleepCandidate);
+    EXPECT_EQ(2u, heapEvent1->updateCount);
+    EXPECT_EQ(2u, heapEvent2->updateCount);
+    EXPECT_EQ(1u, heapEvent3->updateCount);
+    EXPECT_EQ(2, completeCounter);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *device->getTagAddress() = 3;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(3, completeCounter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    heapEvent1->release();
+    heapEvent2->release();
+    heapEvent3->release();
+}
+
+TEST_F(AsyncEventsHandlerCompletionHeapTests, givenEventsFromDifferentCsrsWhenProcessedThenSeparateHeapsAreUsedAndLowestTaskCountIsSleepCandidate) {
+    std::unique_ptr<MockDevice> device2(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockCommandQueue cmdQ2(&context, device2.get(), 0);
+    *device2->getTagAddress() = 0;
+
+    int completeCounter = 0;
+    auto heapEvent1 = createEventWithCallback(cmdQ.get(), 5, &completeCounter);
+    auto heapEvent2 = createEventWithCallback(&cmdQ2, 4, &completeCounter);
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(heapEvent2, sleepCandidate);
+    EXPECT_EQ(2u, handler->completionHeaps.size());
+
+    *device2->getTagAddress() = 4;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(heapEvent1, sleepCandidate);
+    EXPECT_EQ(1, completeCounter);
+    EXPECT_EQ(1u, heapEvent1->updateCount);
+
+    *device->getTagAddress() = 5;
+    handler->process();
+    EXPECT_EQ(2, completeCounter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    heapEvent1->release();
+    heapEvent2->release();
+}
+
+TEST_F(AsyncEventsHandlerCompletionHeapTests, givenEventsInCompletionHeapWhenHandlerIsDestroyedThenEventsAreUnreferenced) {
+    int completeCounter = 0;
+    auto heapEvent = createEventWithCallback(cmdQ.get(), 1, &completeCounter);
+
+    handler->process();
+    EXPECT_EQ(1u, handler->completionHeaps[0].events.size());
+    EXPECT_EQ(3, heapEvent->getRefInternalCount());
+
+    handler.reset();
+    EXPECT_EQ(2, heapEvent->getRefInternalCount());
+
+    *device->getTagAddress() = 1;
+    heapEvent->updateExecutionStatus();
+    EXPECT_EQ(1, completeCounter);
+    heapEvent->release();
+}
+
+TEST_F(AsyncEventsHandlerCompletionHeapTests, givenCompletionHeapWhenAllItsEventsAreCompletedThenHeapIsRemoved) {
+    int completeCounter = 0;
+    auto heapEvent1 = createEventWithCallback(cmdQ.get(), 1, &completeCounter);
+    auto heapEvent2 = createEventWithCallback(cmdQ.get(), 2, &completeCounter);
+
+    handler->process();
+    EXPECT_EQ(1u, handler->completionHeaps.size());
+
+    *device->getTagAddress() = 1;
+    handler->process();
+    EXPECT_EQ(1u, handler->completionHeaps.size());
+
+    *device->getTagAddress() = 2;
+    handler->process();
+    EXPECT_EQ(0u, handler->completionHeaps.size());
+    EXPECT_EQ(2, completeCounter);
+
+    heapEvent1->release();
+    heapEvent2->release();
+}
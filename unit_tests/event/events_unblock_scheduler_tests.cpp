@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/event/events_unblock_scheduler.h"
+#include "runtime/event/user_event.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_csr.h"
+#include "unit_tests/mocks/mock_kernel.h"
+#include "test.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+struct UnblockRecordingEvent : public Event {
+    UnblockRecordingEvent(std::vector<Event *> &unblockOrder)
+        : Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady), unblockOrder(unblockOrder) {}
+
+    void unblockEventBy(Event &event, uint32_t taskLevel, int32_t transitionStatus) override {
+        nestingLevel++;
+        maxNestingLevel = std::max(maxNestingLevel, nestingLevel);
+        unblockOrder.push_back(this);
+        Event::unblockEventBy(event, taskLevel, transitionStatus);
+        nestingLevel--;
+    }
+
+    std::vector<Event *> &unblockOrder;
+    static int nestingLevel;
+    static int maxNestingLevel;
+};
+int UnblockRecordingEvent::nestingLevel = 0;
+int UnblockRecordingEvent::maxNestingLevel = 0;
+} // namespace
+
+TEST(EventsUnblockSchedulerTest, givenNoSchedulerCreatedThenActiveSchedulerIsNotReturned) {
+    EXPECT_EQ(nullptr, EventsUnblockScheduler::getActiveScheduler());
+    {
+        EventsUnblockScheduler scheduler;
+        EXPECT_EQ(&scheduler, EventsUnblockScheduler::getActiveScheduler());
+    }
+    EXPECT_EQ(nullptr, EventsUnblockScheduler::getActiveScheduler());
+}
+
+TEST(EventsUnblockSchedulerTest, givenChainOfEventsWhenRootIsCompletedThenEventsAreUnblockedWithoutRecursion) {
+    constexpr size_t chainLength = 16;
+    std::vector<Event *> unblockOrder;
+    UserEvent root;
+    std::vector<std::unique_ptr<UnblockRecordingEvent>> chain;
+    Event *parent = &root;
+    for (size_t i = 0; i < chainLength; i++) {
+        chain.emplace_back(new UnblockRecordingEvent(unblockOrder));
+        parent->addChild(*chain.back());
+        parent = chain.back().get();
+    }
+    UnblockRecordingEvent::nestingLevel = 0;
+    UnblockRecordingEvent::maxNestingLevel = 0;
+
+    root.setStatus(CL_COMPLETE);
+
+    EXPECT_EQ(1, UnblockRecordingEvent::maxNestingLevel);
+    ASSERT_EQ(chainLength, unblockOrder.size());
+    for (size_t i = 0; i < chainLength; i++) {
+        EXPECT_EQ(chain[i].get(), unblockOrder[i]);
+        EXPECT_EQ(CL_SUBMITTED, chain[i]->peekExecutionStatus());
+    }
+}
+
+TEST(EventsUnblockSchedulerTest, givenEventsGraphWhenRootIsCompletedThenEventsAreUnblockedLevelByLevel) {
+    std::vector<Event *> unblockOrder;
+    UserEvent root;
+    UnblockRecordingEvent child1(unblockOrder), child2(unblockOrder), grandChild(unblockOrder);
+    root.addChild(child1);
+    root.addChild(child2);
+    child1.addChild(grandChild);
+
+    EventsUnblockScheduler scheduler;
+    root.setStatus(CL_COMPLETE);
+    EXPECT_EQ(0u, unblockOrder.size());
+
+    scheduler.run();
+    ASSERT_EQ(3u, unblockOrder.size());
+    EXPECT_EQ(&grandChild, unblockOrder[2]);
+    EXPECT_EQ(2u, scheduler.peekLevelsCount());
+}
+
+struct EventsUnblockSchedulerHwTest : public DeviceFixture,
+                                      public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        context.reset(new MockContext(pDevice));
+        kernel.reset(new MockKernelWithInternals(*pDevice, context.get()));
+    }
+
+    void TearDown() override {
+        queues.clear();
+        kernel.reset();
+        context.reset();
+        DeviceFixture::TearDown();
+    }
+
+    // every queue is blocked by the user event, so all kernels are unblocked by its single status transition
+    template <typename FamilyType>
+    void enqueueBlockedKernels(UserEvent &userEvent, cl_event *outEvents) {
+        cl_event waitlist = &userEvent;
+        size_t gws[3] = {1, 0, 0};
+        for (size_t i = 0; i < kernelsCount; i++) {
+            queues.emplace_back(new CommandQueueHw<FamilyType>(context.get(), pDevice, 0));
+            auto retVal = queues.back()->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 1, &waitlist, &outEvents[i]);
+            ASSERT_EQ(CL_SUCCESS, retVal);
+        }
+    }
+
+    static constexpr size_t kernelsCount = 4;
+    DebugManagerStateRestore restore;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockKernelWithInternals> kernel;
+    std::vector<std::unique_ptr<CommandQueue>> queues;
+};
+
+HWTEST_F(EventsUnblockSchedulerHwTest, givenKernelsInQueuesBlockedByUserEventWhenUnblockedThenKernelsAreNotFlushedAsBlocking) {
+    auto mockCsr = new MockCsrHw2<FamilyType>(pDevice->getHardwareInfo(), *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    UserEvent userEvent(context.get());
+    cl_event outEvents[kernelsCount];
+    enqueueBlockedKernels<FamilyType>(userEvent, outEvents);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_EQ(static_cast<int>(kernelsCount), mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockCsr->passedDispatchFlags.blocking);
+    for (auto outEvent : outEvents) {
+        EXPECT_EQ(CL_COMPLETE, castToObject<Event>(outEvent)->peekExecutionStatus());
+        clReleaseEvent(outEvent);
+    }
+}
+
+HWTEST_F(EventsUnblockSchedulerHwTest, givenAggregatedSubmissionEnabledWhenKernelsInQueuesBlockedByUserEventAreUnblockedThenOneFlushIsDoneAndDispatchModeIsRestored) {
+    DebugManager.flags.AggregateUnblockedCommandsSubmission.set(true);
+    auto mockCsr = new MockCsrHw2<FamilyType>(pDevice->getHardwareInfo(), *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    UserEvent userEvent(context.get());
+    cl_event outEvents[kernelsCount];
+    enqueueBlockedKernels<FamilyType>(userEvent, outEvents);
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_EQ(DispatchMode::ImmediateDispatch, mockCsr->peekDispatchMode());
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    for (auto outEvent : outEvents) {
+        EXPECT_EQ(CL_COMPLETE, castToObject<Event>(outEvent)->peekExecutionStatus());
+        clReleaseEvent(outEvent);
+    }
+}
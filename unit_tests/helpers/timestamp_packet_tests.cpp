@@ -11,6 +11,7 @@
 #include "runtime/helpers/options.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/helpers/hw_parse.h"
 #include "unit_tests/mocks/mock_context.h"
 #include "unit_tests/mocks/mock_device.h"
@@ -333,6 +334,122 @@ HWCMDTEST_F(IGFX_GEN8_CORE, TimestampPacketTests, givenTimestampPacketDisabledWh
     EXPECT_EQ(hwParser.cmdList.end(), cmdItor);
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, TimestampPacketTests, givenTimestampPacketProfilingEnabledWhenDispatchingGpuWalkerThenStoreStartAndEndTimestampsAroundWalker) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+    MockTimestampPacketContainer timestampPacket(device->getMemoryManager(), 1);
+    MockMultiDispatchInfo multiDispatchInfo(kernel->mockKernel);
+    auto &cmdStream = mockCmdQ->getCS(0);
+
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+    csr.timestampPacketProfilingEnabled = true;
+
+    HardwareInterface<FamilyType>::dispatchWalker(
+        *mockCmdQ,
+        multiDispatchInfo,
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        &timestampPacket,
+        device->getPreemptionMode(),
+        false);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdStream, 0);
+
+    auto tag = timestampPacket.getNode(0)->tag;
+    auto verifyStore = [&](GenCmdList::iterator it, uint32_t expectedRegister, TimestampPacket::DataIndex expectedIndex) {
+        auto storeRegMem = genCmdCast<MI_STORE_REGISTER_MEM *>(*it);
+        ASSERT_NE(nullptr, storeRegMem);
+        EXPECT_EQ(expectedRegister, storeRegMem->getRegisterAddress());
+        EXPECT_EQ(tag->pickAddressForDataWrite(expectedIndex), storeRegMem->getMemoryAddress());
+    };
+
+    auto walkerItor = find<GPGPU_WALKER *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), walkerItor);
+
+    auto itor = walkerItor;
+    verifyStore(--itor, REG_GLOBAL_TIMESTAMP_LDW, TimestampPacket::DataIndex::GlobalStart);
+    verifyStore(--itor, GP_THREAD_TIME_REG_ADDRESS_OFFSET_LOW, TimestampPacket::DataIndex::ContextStart);
+
+    itor = walkerItor;
+    auto pipeControl = genCmdCast<PIPE_CONTROL *>(*++itor);
+    ASSERT_NE(nullptr, pipeControl);
+    EXPECT_EQ(1u, pipeControl->getCommandStreamerStallEnable());
+    EXPECT_EQ(PIPE_CONTROL::POST_SYNC_OPERATION_NO_WRITE, pipeControl->getPostSyncOperation());
+    verifyStore(++itor, GP_THREAD_TIME_REG_ADDRESS_OFFSET_LOW, TimestampPacket::DataIndex::ContextEnd);
+    verifyStore(++itor, REG_GLOBAL_TIMESTAMP_LDW, TimestampPacket::DataIndex::GlobalEnd);
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, TimestampPacketTests, givenTimestampPacketProfilingEnabledWhenEstimatingStreamSizeThenAddStoreRegisterMemForEachDispatch) {
+    MockKernelWithInternals kernel2(*device);
+    MockMultiDispatchInfo multiDispatchInfo(std::vector<Kernel *>({kernel->mockKernel, kernel2.mockKernel}));
+
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+    csr.timestampPacketProfilingEnabled = false;
+    getCommandStream<FamilyType, CL_COMMAND_NDRANGE_KERNEL>(*mockCmdQ, 0, false, false, multiDispatchInfo);
+    auto sizeWithoutProfiling = mockCmdQ->requestedCmdStreamSize;
+
+    csr.timestampPacketProfilingEnabled = true;
+    getCommandStream<FamilyType, CL_COMMAND_NDRANGE_KERNEL>(*mockCmdQ, 0, false, false, multiDispatchInfo);
+    auto sizeWithProfiling = mockCmdQ->requestedCmdStreamSize;
+
+    EXPECT_EQ(4 * sizeof(typename FamilyType::MI_STORE_REGISTER_MEM), EnqueueOperation<FamilyType>::getSizeRequiredForTimestampPacketProfiling());
+    EXPECT_EQ(sizeWithoutProfiling + 2 * EnqueueOperation<FamilyType>::getSizeRequiredForTimestampPacketProfiling(), sizeWithProfiling);
+}
+
+HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteDisabledWhenProfilingFlagIsSetThenProfilingIsNotEnabled) {
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = false;
+    csr.timestampPacketProfilingEnabled = true;
+    EXPECT_FALSE(csr.peekTimestampPacketProfilingEnabled());
+
+    csr.timestampPacketWriteEnabled = true;
+    EXPECT_TRUE(csr.peekTimestampPacketProfilingEnabled());
+}
+
+HWTEST_F(TimestampPacketTests, givenTimestampPacketProfilingEnabledWhenEnqueueingOnProfilingQueueThenEventReadsTimestampsFromPacket) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ReturnRawGpuTimestamps.set(true);
+
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+    csr.timestampPacketProfilingEnabled = true;
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), properties);
+
+    cl_event clEvent;
+    cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &clEvent);
+    auto event = castToObject<Event>(clEvent);
+    EXPECT_TRUE(event->isTimestampPacketProfilingPath());
+
+    auto node = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto writeData = [&](TimestampPacket::DataIndex index, uint32_t value) {
+        *reinterpret_cast<uint32_t *>(node->tag->pickAddressForDataWrite(index)) = value;
+    };
+    writeData(TimestampPacket::DataIndex::ContextStart, 100u);
+    writeData(TimestampPacket::DataIndex::GlobalStart, 200u);
+    writeData(TimestampPacket::DataIndex::ContextEnd, 150u);
+    writeData(TimestampPacket::DataIndex::GlobalEnd, 250u);
+    *csr.getTagAddress() = event->peekTaskCount();
+
+    cl_ulong start = 0;
+    cl_ulong end = 0;
+    EXPECT_EQ(CL_SUCCESS, clGetEventProfilingInfo(clEvent, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clGetEventProfilingInfo(clEvent, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, nullptr));
+    EXPECT_EQ(100u, start);
+    EXPECT_EQ(150u, end);
+
+    clReleaseEvent(clEvent);
+}
+
 HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteEnabledWhenEnqueueingThenObtainNewStampAndPassToEvent) {
     device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
     auto mockMemoryManager = new MockMemoryManager(*device->getExecutionEnvironment());
@@ -6,6 +6,7 @@
  */
 
 #include "CL/cl.h"
+#include "runtime/command_stream/csr_definitions.h"
 #include "runtime/kernel/kernel.h"
 #include "runtime/mem_obj/buffer.h"
 #include "unit_tests/fixtures/context_fixture.h"
@@ -167,3 +168,47 @@ TEST_F(KernelArgBufferTest, given32BitDeviceWhenArgPassedIsNullThenOnly4BytesAre
     EXPECT_EQ(0u, *pKernelArg32bit);
     EXPECT_NE(expValue, *pKernelArg64bit);
 }
+
+TEST_F(KernelArgBufferTest, givenBufferArgWhenSurfacesAccessIsQueriedThenBufferIsWritten) {
+    MockBuffer buffer;
+    auto val = (cl_mem)&buffer;
+    pKernel->setArg(0, sizeof(cl_mem *), &val);
+
+    SurfacesAccess surfacesAccess;
+    EXPECT_TRUE(pKernel->getSurfacesAccess(surfacesAccess));
+    EXPECT_TRUE(surfacesAccess.readAllocations.empty());
+    ASSERT_EQ(1u, surfacesAccess.writtenAllocations.size());
+    EXPECT_EQ(buffer.getGraphicsAllocation(), surfacesAccess.writtenAllocations[0]);
+}
+
+TEST_F(KernelArgBufferTest, givenConstOrReadOnlyBufferArgWhenSurfacesAccessIsQueriedThenBufferIsRead) {
+    pKernelInfo->kernelArgInfo[0].typeQualifier = CL_KERNEL_ARG_TYPE_CONST;
+    MockBuffer buffer;
+    auto val = (cl_mem)&buffer;
+    pKernel->setArg(0, sizeof(cl_mem *), &val);
+
+    SurfacesAccess surfacesAccess;
+    EXPECT_TRUE(pKernel->getSurfacesAccess(surfacesAccess));
+    EXPECT_TRUE(surfacesAccess.writtenAllocations.empty());
+    ASSERT_EQ(1u, surfacesAccess.readAllocations.size());
+    EXPECT_EQ(buffer.getGraphicsAllocation(), surfacesAccess.readAllocations[0]);
+
+    pKernelInfo->kernelArgInfo[0].typeQualifier = CL_KERNEL_ARG_TYPE_NONE;
+    std::unique_ptr<Buffer> readOnlyBuffer(Buffer::create(pContext, CL_MEM_READ_ONLY, MemoryConstants::pageSize, nullptr, retVal));
+    val = readOnlyBuffer.get();
+    pKernel->setArg(0, sizeof(cl_mem *), &val);
+
+    SurfacesAccess readOnlySurfacesAccess;
+    EXPECT_TRUE(pKernel->getSurfacesAccess(readOnlySurfacesAccess));
+    EXPECT_TRUE(readOnlySurfacesAccess.writtenAllocations.empty());
+    ASSERT_EQ(1u, readOnlySurfacesAccess.readAllocations.size());
+    EXPECT_EQ(readOnlyBuffer->getGraphicsAllocation(), readOnlySurfacesAccess.readAllocations[0]);
+}
+
+TEST_F(KernelArgBufferTest, givenSvmPointerArgWithoutAllocationWhenSurfacesAccessIsQueriedThenAccessIsUnknown) {
+    char hostMemory[64];
+    pKernel->setArgSvm(0, sizeof(hostMemory), hostMemory);
+
+    SurfacesAccess surfacesAccess;
+    EXPECT_FALSE(pKernel->getSurfacesAccess(surfacesAccess));
+}
@@ -6,6 +6,7 @@
  */
 
 #include "CL/cl.h"
+#include "runtime/command_stream/csr_definitions.h"
 #include "runtime/kernel/kernel.h"
 #include "runtime/mem_obj/pipe.h"
 #include "unit_tests/fixtures/context_fixture.h"
@@ -201,3 +202,17 @@ TEST_F(KernelArgPipeTest, SetKernelArgNull) {
     auto retVal = this->pKernel->setArg(0, sizeof(cl_mem *), pVal);
     EXPECT_EQ(CL_INVALID_MEM_OBJECT, retVal);
 }
+
+TEST_F(KernelArgPipeTest, givenReadOnlyPipeArgWhenSurfacesAccessIsQueriedThenPipeIsWritten) {
+    pKernelInfo->kernelArgInfo[0].accessQualifier = CL_KERNEL_ARG_ACCESS_READ_ONLY;
+    pKernelInfo->kernelArgInfo[0].typeQualifier = CL_KERNEL_ARG_TYPE_PIPE;
+    MockPipe pipe(pContext);
+    auto val = (cl_mem)&pipe;
+    pKernel->setArg(0, sizeof(cl_mem *), &val);
+
+    SurfacesAccess surfacesAccess;
+    EXPECT_TRUE(pKernel->getSurfacesAccess(surfacesAccess));
+    EXPECT_TRUE(surfacesAccess.readAllocations.empty());
+    ASSERT_EQ(1u, surfacesAccess.writtenAllocations.size());
+    EXPECT_EQ(pipe.getGraphicsAllocation(), surfacesAccess.writtenAllocations[0]);
+}
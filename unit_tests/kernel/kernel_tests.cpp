@@ -1647,6 +1647,95 @@ HWTEST_F(KernelResidencyTest, givenKernelWhenMakeResidentIsCalledThenKernelIsaIs
     memoryManager->freeGraphicsMemory(pKernelInfo->kernelAllocation);
 }
 
+HWTEST_F(KernelResidencyTest, givenKernelWithSvmArgWhenMakeResidentIsCalledTwiceThenArgsResidencyCacheIsReused) {
+    auto pKernelInfo = std::make_unique<KernelInfo>();
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.storeMakeResidentAllocations = true;
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+
+    pKernelInfo->kernelArgInfo.resize(1);
+    pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector.push_back(KernelArgPatchInfo());
+    pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector[0].size = sizeof(uint64_t);
+
+    MockProgram program(*pDevice->getExecutionEnvironment());
+    std::unique_ptr<MockKernel> pKernel(new MockKernel(&program, *pKernelInfo, *pDevice));
+    ASSERT_EQ(CL_SUCCESS, pKernel->initialize());
+    char pCrossThreadData[64] = {};
+    pKernel->setCrossThreadData(pCrossThreadData, sizeof(pCrossThreadData));
+
+    auto svmAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    pKernel->setArgSvmAlloc(0, svmAllocation->getUnderlyingBuffer(), svmAllocation);
+    EXPECT_FALSE(pKernel->isArgsResidencyCacheValid());
+
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(pKernel->isArgsResidencyCacheValid());
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(svmAllocation));
+
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(pKernel->isArgsResidencyCacheValid());
+    EXPECT_EQ(2u, commandStreamReceiver.makeResidentAllocations[svmAllocation]);
+
+    memoryManager->freeGraphicsMemory(svmAllocation);
+}
+
+HWTEST_F(KernelResidencyTest, givenValidArgsResidencyCacheWhenArgOrExecInfoChangesThenCacheIsInvalidatedAndNewAllocationsAreMadeResident) {
+    auto pKernelInfo = std::make_unique<KernelInfo>();
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.storeMakeResidentAllocations = true;
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+
+    pKernelInfo->kernelArgInfo.resize(1);
+    pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector.push_back(KernelArgPatchInfo());
+    pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector[0].size = sizeof(uint64_t);
+
+    MockProgram program(*pDevice->getExecutionEnvironment());
+    std::unique_ptr<MockKernel> pKernel(new MockKernel(&program, *pKernelInfo, *pDevice));
+    ASSERT_EQ(CL_SUCCESS, pKernel->initialize());
+    char pCrossThreadData[64] = {};
+    pKernel->setCrossThreadData(pCrossThreadData, sizeof(pCrossThreadData));
+
+    auto firstSvmAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    auto secondSvmAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+    auto execInfoAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize);
+
+    pKernel->setArgSvmAlloc(0, firstSvmAllocation->getUnderlyingBuffer(), firstSvmAllocation);
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(pKernel->isArgsResidencyCacheValid());
+
+    pKernel->setArgSvmAlloc(0, secondSvmAllocation->getUnderlyingBuffer(), secondSvmAllocation);
+    EXPECT_FALSE(pKernel->isArgsResidencyCacheValid());
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(secondSvmAllocation));
+    EXPECT_EQ(1u, commandStreamReceiver.makeResidentAllocations[firstSvmAllocation]);
+
+    pKernel->setKernelExecInfo(execInfoAllocation);
+    EXPECT_FALSE(pKernel->isArgsResidencyCacheValid());
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(execInfoAllocation));
+
+    pKernel->clearKernelExecInfo();
+    EXPECT_FALSE(pKernel->isArgsResidencyCacheValid());
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_EQ(1u, commandStreamReceiver.makeResidentAllocations[execInfoAllocation]);
+
+    memoryManager->freeGraphicsMemory(firstSvmAllocation);
+    memoryManager->freeGraphicsMemory(secondSvmAllocation);
+    memoryManager->freeGraphicsMemory(execInfoAllocation);
+}
+
+HWTEST_F(KernelResidencyTest, givenKernelUsingSharedObjectsWhenMakeResidentIsCalledThenArgsResidencyCacheIsNotKept) {
+    auto pKernelInfo = std::make_unique<KernelInfo>();
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    MockProgram program(*pDevice->getExecutionEnvironment());
+    std::unique_ptr<MockKernel> pKernel(new MockKernel(&program, *pKernelInfo, *pDevice));
+    ASSERT_EQ(CL_SUCCESS, pKernel->initialize());
+    pKernel->setUsingSharedArgs(true);
+
+    pKernel->makeResident(commandStreamReceiver);
+    EXPECT_FALSE(pKernel->isArgsResidencyCacheValid());
+}
+
 TEST(KernelImageDetectionTests, givenKernelWithImagesOnlyWhenItIsAskedIfItHasImagesOnlyThenTrueIsReturned) {
     auto device = std::make_unique<MockDevice>(*platformDevices[0]);
     auto pKernelInfo = std::make_unique<KernelInfo>();
@@ -699,10 +699,10 @@ TEST_P(ValidHostPtr, isResident_returnsValueFromSetResident) {
     buffer = createBuffer();
     ASSERT_NE(nullptr, buffer);
 
-    buffer->getGraphicsAllocation()->residencyTaskCount[0u] = 1;
+    buffer->getGraphicsAllocation()->updateResidencyTaskCount(1, 0u);
     EXPECT_TRUE(buffer->getGraphicsAllocation()->isResident(0u));
 
-    buffer->getGraphicsAllocation()->residencyTaskCount[0u] = ObjectNotResident;
+    buffer->getGraphicsAllocation()->updateResidencyTaskCount(ObjectNotResident, 0u);
     EXPECT_FALSE(buffer->getGraphicsAllocation()->isResident(0u));
 }
 
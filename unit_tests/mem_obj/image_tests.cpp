@@ -507,10 +507,10 @@ TEST_P(CreateImageHostPtr, isResidentReturnsValueFromSetResident) {
     image = createImage(retVal);
     ASSERT_NE(nullptr, image);
 
-    image->getGraphicsAllocation()->residencyTaskCount[0u] = 1;
+    image->getGraphicsAllocation()->updateResidencyTaskCount(1, 0u);
     EXPECT_TRUE(image->getGraphicsAllocation()->isResident(0u));
 
-    image->getGraphicsAllocation()->residencyTaskCount[0u] = ObjectNotResident;
+    image->getGraphicsAllocation()->updateResidencyTaskCount(ObjectNotResident, 0u);
     EXPECT_FALSE(image->getGraphicsAllocation()->isResident(0u));
 }
 
@@ -59,11 +59,11 @@ TEST(MemObj, useCount) {
     MemObj memObj(&context, CL_MEM_OBJECT_BUFFER, CL_MEM_USE_HOST_PTR,
                   sizeof(buffer), buffer, buffer, mockAllocation, true, false, false);
 
-    EXPECT_EQ(ObjectNotResident, memObj.getGraphicsAllocation()->residencyTaskCount[0u]);
-    memObj.getGraphicsAllocation()->residencyTaskCount[0u] = 1;
-    EXPECT_EQ(1, memObj.getGraphicsAllocation()->residencyTaskCount[0u]);
-    memObj.getGraphicsAllocation()->residencyTaskCount[0u]--;
-    EXPECT_EQ(0, memObj.getGraphicsAllocation()->residencyTaskCount[0u]);
+    EXPECT_EQ(ObjectNotResident, memObj.getGraphicsAllocation()->getResidencyTaskCount(0u));
+    memObj.getGraphicsAllocation()->updateResidencyTaskCount(1, 0u);
+    EXPECT_EQ(1, memObj.getGraphicsAllocation()->getResidencyTaskCount(0u));
+    memObj.getGraphicsAllocation()->updateResidencyTaskCount(0, 0u);
+    EXPECT_EQ(0, memObj.getGraphicsAllocation()->getResidencyTaskCount(0u));
 }
 
 TEST(MemObj, GivenMemObjWhenInititalizedFromHostPtrThenInitializeFields) {
@@ -233,3 +233,81 @@ TEST_F(DeferredDeleterTest, givenDeferredDeleterWhenNonBlockingDrainIsCalledThen
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+namespace {
+class PendingDeferrableDeletion : public DeferrableDeletion {
+  public:
+    PendingDeferrableDeletion(std::atomic<bool> &completed, bool &destroyed) : completed(completed), destroyed(destroyed) {}
+    ~PendingDeferrableDeletion() override {
+        destroyed = true;
+    }
+    bool apply() override {
+        applyCalled++;
+        return completed;
+    }
+    std::atomic<bool> &completed;
+    bool &destroyed;
+    std::atomic<int> applyCalled{0};
+};
+} // namespace
+
+TEST_F(DeferredDeleterTest, givenDeletionOfResourcesInUseWhenQueueIsClearedThenDeletionStaysInQueueUntilResourcesAreReleased) {
+    std::atomic<bool> completed{false};
+    bool destroyed = false;
+    auto deletion = new PendingDeferrableDeletion(completed, destroyed);
+    deleter->DeferredDeleter::deferDeletion(deletion);
+
+    deleter->drain(false);
+    EXPECT_FALSE(deleter->isQueueEmpty());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+    EXPECT_EQ(1, deletion->applyCalled);
+    EXPECT_FALSE(destroyed);
+
+    completed = true;
+    deleter->drain(false);
+    EXPECT_TRUE(destroyed);
+}
+
+TEST_F(DeferredDeleterTest, givenDeletionOfResourcesInUseAndOtherDeletionWhenQueueIsClearedThenOnlyOtherDeletionIsReleased) {
+    std::atomic<bool> completed{false};
+    bool destroyed = false;
+    deleter->DeferredDeleter::deferDeletion(new PendingDeferrableDeletion(completed, destroyed));
+    deleter->DeferredDeleter::deferDeletion(createDeletion());
+
+    deleter->drain(false);
+    EXPECT_FALSE(deleter->isQueueEmpty());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+
+    completed = true;
+    deleter->drain(false);
+    EXPECT_TRUE(destroyed);
+}
+
+TEST(DeferredDeleter, givenDeletionOfResourcesInUseWhenWorkingThreadIsRunningThenDeletionIsRetriedUntilResourcesAreReleased) {
+    std::atomic<bool> completed{false};
+    bool destroyed = false;
+    auto deleter = std::unique_ptr<DeferredDeleter>(new DeferredDeleter());
+    deleter->addClient();
+    auto deletion = new PendingDeferrableDeletion(completed, destroyed);
+    deleter->deferDeletion(deletion);
+
+    while (deletion->applyCalled < 2) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(destroyed);
+
+    completed = true;
+    deleter->drain(true);
+    deleter->removeClient();
+    EXPECT_TRUE(destroyed);
+}
+
+TEST(DeferredDeleter, givenDeletionOfResourcesInUseWhenDeleterIsDestroyedThenDeletionIsDestroyed) {
+    std::atomic<bool> completed{false};
+    bool destroyed = false;
+    auto deleter = std::unique_ptr<DeferredDeleter>(new DeferredDeleter());
+    deleter->deferDeletion(new PendingDeferrableDeletion(completed, destroyed));
+
+    deleter.reset();
+    EXPECT_TRUE(destroyed);
+}
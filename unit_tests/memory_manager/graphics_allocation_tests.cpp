@@ -7,24 +7,88 @@
 
 #include "gtest/gtest.h"
 #include "runtime/memory_manager/graphics_allocation.h"
+#include "unit_tests/mocks/mock_graphics_allocation.h"
+
+#include <thread>
+#include <vector>
 
 using namespace OCLRT;
 
+namespace {
+const uint32_t osContextsCount = 32u;
+}
+
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenTaskCountsAreInitializedProperly) {
     GraphicsAllocation graphicsAllocation1(nullptr, 0u, 0u, 0u);
     GraphicsAllocation graphicsAllocation2(nullptr, 0u, 0u);
-    for (auto i = 0u; i < maxOsContextCount; i++) {
+    for (auto i = 0u; i < osContextsCount; i++) {
         EXPECT_EQ(ObjectNotUsed, graphicsAllocation1.getTaskCount(i));
         EXPECT_EQ(ObjectNotUsed, graphicsAllocation2.getTaskCount(i));
+        EXPECT_EQ(ObjectNotResident, graphicsAllocation1.getResidencyTaskCount(i));
+        EXPECT_FALSE(graphicsAllocation2.isResident(i));
     }
 }
-TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenAccessTaskCountForInvalidContextThenAbort) {
-    GraphicsAllocation graphicsAllocation(nullptr, 0u, 0u);
-    EXPECT_THROW(graphicsAllocation.getTaskCount(maxOsContextCount), std::exception);
+TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenNoUsageInfoIsAllocated) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 0u);
+    EXPECT_EQ(1u, graphicsAllocation.getUsageInfoChunksCount());
+    graphicsAllocation.getTaskCount(osContextsCount - 1);
+    graphicsAllocation.getResidencyTaskCount(osContextsCount - 1);
+    EXPECT_EQ(1u, graphicsAllocation.getUsageInfoChunksCount());
 }
-TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenUpdateTaskCountForInvalidContextThenAbort) {
+TEST(GraphicsAllocationTest, givenFirstContextsWhenTaskCountsAreUpdatedThenUsageInfoIsKeptInsideAllocation) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 0u);
+    for (auto i = 0u; i < MockGraphicsAllocation::usageInfosPerChunk; i++) {
+        graphicsAllocation.updateTaskCount(1u, i);
+        graphicsAllocation.updateResidencyTaskCount(1, i);
+    }
+    EXPECT_EQ(1u, graphicsAllocation.getUsageInfoChunksCount());
+}
+TEST(GraphicsAllocationTest, givenManyContextsWhenTaskCountsAreUpdatedThenEachContextIsTrackedSeparately) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 0u);
+    for (auto i = 0u; i < osContextsCount; i++) {
+        graphicsAllocation.updateTaskCount(i + 1, i);
+        graphicsAllocation.updateResidencyTaskCount(static_cast<int>(i + 2), i);
+    }
+    EXPECT_EQ(osContextsCount / MockGraphicsAllocation::usageInfosPerChunk, graphicsAllocation.getUsageInfoChunksCount());
+    for (auto i = 0u; i < osContextsCount; i++) {
+        EXPECT_EQ(i + 1, graphicsAllocation.getTaskCount(i));
+        EXPECT_EQ(static_cast<int>(i + 2), graphicsAllocation.getResidencyTaskCount(i));
+        EXPECT_TRUE(graphicsAllocation.isResident(i));
+    }
+    for (auto i = 0u; i < osContextsCount; i++) {
+        graphicsAllocation.updateTaskCount(ObjectNotUsed, i);
+        EXPECT_EQ(i + 1 < osContextsCount, graphicsAllocation.peekWasUsed());
+    }
+}
+TEST(GraphicsAllocationTest, givenContextsUpdatingTaskCountsConcurrentlyWhenUsageInfosGrowThenNoUpdateIsLost) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 0u);
+    const uint32_t iterationsCount = 1000u;
+    std::vector<std::thread> threads;
+    for (auto contextId = 0u; contextId < osContextsCount; contextId++) {
+        threads.emplace_back([&graphicsAllocation, contextId, iterationsCount]() {
+            for (auto taskCount = 1u; taskCount <= iterationsCount; taskCount++) {
+                graphicsAllocation.updateTaskCount(taskCount, contextId);
+                graphicsAllocation.getTaskCount((contextId + 1) % osContextsCount);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto contextId = 0u; contextId < osContextsCount; contextId++) {
+        EXPECT_EQ(iterationsCount, graphicsAllocation.getTaskCount(contextId));
+    }
+    EXPECT_EQ(osContextsCount / MockGraphicsAllocation::usageInfosPerChunk, graphicsAllocation.getUsageInfoChunksCount());
+}
+TEST(GraphicsAllocationTest, givenLastContextUpdatedFirstWhenTaskCountsAreQueriedThenPreviousContextsAreNotUsed) {
     GraphicsAllocation graphicsAllocation(nullptr, 0u, 0u);
-    EXPECT_THROW(graphicsAllocation.updateTaskCount(0u, maxOsContextCount), std::exception);
+    graphicsAllocation.updateTaskCount(5u, osContextsCount - 1);
+    EXPECT_TRUE(graphicsAllocation.peekWasUsed());
+    for (auto i = 0u; i < osContextsCount - 1; i++) {
+        EXPECT_EQ(ObjectNotUsed, graphicsAllocation.getTaskCount(i));
+        EXPECT_FALSE(graphicsAllocation.isResident(i));
+    }
+    EXPECT_EQ(5u, graphicsAllocation.getTaskCount(osContextsCount - 1));
 }
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenUpdatedTaskCountThenAllocationWasUsed) {
     GraphicsAllocation graphicsAllocation(nullptr, 0u, 0u);
@@ -36,13 +100,13 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenUpdatedTaskCountThenOnly
     GraphicsAllocation graphicsAllocation(nullptr, 0u, 0u);
     graphicsAllocation.updateTaskCount(1u, 0u);
     EXPECT_EQ(1u, graphicsAllocation.getTaskCount(0u));
-    for (auto i = 1u; i < maxOsContextCount; i++) {
+    for (auto i = 1u; i < osContextsCount; i++) {
         EXPECT_EQ(ObjectNotUsed, graphicsAllocation.getTaskCount(i));
     }
     graphicsAllocation.updateTaskCount(2u, 1u);
     EXPECT_EQ(1u, graphicsAllocation.getTaskCount(0u));
     EXPECT_EQ(2u, graphicsAllocation.getTaskCount(1u));
-    for (auto i = 2u; i < maxOsContextCount; i++) {
+    for (auto i = 2u; i < osContextsCount; i++) {
         EXPECT_EQ(ObjectNotUsed, graphicsAllocation.getTaskCount(i));
     }
 }
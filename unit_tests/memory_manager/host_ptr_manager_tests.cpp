@@ -7,6 +7,7 @@
 
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/memory_manager/deferred_deleter.h"
 #include "runtime/memory_manager/memory_constants.h"
 #include "unit_tests/fixtures/memory_manager_fixture.h"
 #include "unit_tests/mocks/mock_csr.h"
@@ -906,6 +907,36 @@ TEST_F(HostPtrAllocationTest, whenOverlappedFragmentIsBiggerThenStoredAndStoredF
     }
 }
 
+TEST_F(HostPtrAllocationTest, givenOverlappedAllocationPendingInDeferredDeleterWhenBiggerOverlappingHostPtrIsPreparedAfterGpuCompletesThenPendingAllocationIsFreed) {
+    memoryManager->setDeferredDeleter(new DeferredDeleter());
+    void *cpuPtr = reinterpret_cast<void *>(0x100004);
+
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, cpuPtr);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+
+    graphicsAllocation->updateTaskCount(currentGpuTag + 1, 0u);
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
+    memoryManager->getDeferredDeleter()->drain(false);
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+
+    currentGpuTag++;
+    csr->latestSentTaskCount = currentGpuTag;
+
+    auto biggerPtr = alignDown(cpuPtr, MemoryConstants::pageSize);
+    auto biggerSize = 10 * MemoryConstants::pageSize;
+    auto osStorage = hostPtrManager->prepareOsStorageForAllocation(*memoryManager, biggerSize, biggerPtr);
+    EXPECT_EQ(1u, osStorage.fragmentCount);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_NE(nullptr, hostPtrManager->getFragment(biggerPtr));
+
+    hostPtrManager->releaseHandleStorage(osStorage);
+    memoryManager->cleanOsHandles(osStorage);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
 TEST_F(HostPtrAllocationTest, checkAllocationsForOverlappingWithoutBiggerOverlap) {
 
     void *cpuPtr1 = (void *)0x100004;
@@ -1238,6 +1238,96 @@ TEST_F(MemoryManagerWithCsrTest, givenAllocationThatWasUsedAndIsNotCompletedWhen
     usedAllocationAndNotGpuCompleted->updateTaskCount(ObjectNotUsed, 0);
 }
 
+TEST_F(MemoryManagerWithCsrTest, givenAllocationCompletedOnFirstContextAndNotCompletedOnSecondWhencheckGpuUsageAndDestroyGraphicsAllocationsIsCalledThenItIsAddedToTemporaryAllocationListOfSecondContext) {
+    uint32_t secondGpuTag = initialHardwareTag;
+    auto secondCsr = new MockCommandStreamReceiver(executionEnvironment);
+    secondCsr->tagAddress = &secondGpuTag;
+    secondCsr->setDeviceIndex(1u);
+    executionEnvironment.commandStreamReceivers.push_back(std::unique_ptr<CommandStreamReceiver>(secondCsr));
+
+    auto allocation = memoryManager->allocateGraphicsMemory(4096);
+    allocation->updateTaskCount(currentGpuTag - 1, 0u);
+    allocation->updateTaskCount(secondGpuTag + 1, 1u);
+
+    uint32_t contextIdInUse = 0u;
+    EXPECT_TRUE(memoryManager->isAllocationInUse(*allocation, contextIdInUse));
+    EXPECT_EQ(1u, contextIdInUse);
+
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_EQ(allocation, secondCsr->getTemporaryAllocations().peekHead());
+
+    secondGpuTag++;
+    secondCsr->getInternalAllocationStorage()->cleanAllocationList(secondGpuTag, TEMPORARY_ALLOCATION);
+    EXPECT_TRUE(secondCsr->getTemporaryAllocations().peekIsEmpty());
+    executionEnvironment.commandStreamReceivers.pop_back();
+}
+
+TEST_F(MemoryManagerWithCsrTest, givenDeferredDeleterWhenAllocationInUseIsDestroyedThenDeleterFreesItOnceGpuCompletes) {
+    memoryManager->overrideAsyncDeleterFlag(true);
+    auto deleter = static_cast<MockDeferredDeleter *>(memoryManager->getDeferredDeleter());
+
+    auto allocation = memoryManager->allocateGraphicsMemory(4096);
+    allocation->updateTaskCount(currentGpuTag + 1, 0u);
+
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    EXPECT_EQ(1, deleter->deferDeletionCalled);
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_FALSE(deleter->isQueueEmpty());
+
+    deleter->drain(false);
+    EXPECT_FALSE(deleter->isQueueEmpty());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+
+    currentGpuTag++;
+    deleter->drain(false);
+    EXPECT_TRUE(deleter->isQueueEmpty());
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+    memoryManager->waitForDeletions();
+}
+
+TEST_F(MemoryManagerWithCsrTest, givenDeferredDeleterWithUnflushedPendingDeletionWhenHostPtrAllocationIsMadeThenItDoesNotWaitForPendingDeletion) {
+    memoryManager->setDeferredDeleter(new DeferredDeleter());
+
+    auto allocation = memoryManager->allocateGraphicsMemory(4096);
+    allocation->updateTaskCount(currentGpuTag + 1, 0u);
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+
+    auto hostPtr = reinterpret_cast<void *>(0x30000);
+    auto hostPtrAllocation = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, hostPtr);
+    EXPECT_NE(nullptr, hostPtrAllocation);
+
+    memoryManager->freeGraphicsMemory(hostPtrAllocation);
+    memoryManager->waitForDeletions();
+    EXPECT_EQ(allocation, csr->getTemporaryAllocations().peekHead());
+}
+
+TEST_F(MemoryManagerWithCsrTest, givenDeferredDeleterWithAllocationInUseWhenDeleterIsStoppedThenAllocationIsAddedToTemporaryAllocationList) {
+    memoryManager->overrideAsyncDeleterFlag(true);
+
+    auto allocation = memoryManager->allocateGraphicsMemory(4096);
+    allocation->updateTaskCount(currentGpuTag + 1, 0u);
+
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+
+    memoryManager->waitForDeletions();
+    EXPECT_EQ(allocation, csr->getTemporaryAllocations().peekHead());
+}
+
+TEST_F(MemoryManagerWithCsrTest, givenDeferredDeleterWhenCompletedAllocationIsDestroyedThenItIsFreedInPlace) {
+    memoryManager->overrideAsyncDeleterFlag(true);
+    auto deleter = static_cast<MockDeferredDeleter *>(memoryManager->getDeferredDeleter());
+
+    auto allocation = memoryManager->allocateGraphicsMemory(4096);
+    allocation->updateTaskCount(currentGpuTag, 0u);
+
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    EXPECT_EQ(0, deleter->deferDeletionCalled);
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    memoryManager->waitForDeletions();
+}
+
 class MockAlignMallocMemoryManager : public MockMemoryManager {
   public:
     MockAlignMallocMemoryManager() {
@@ -1394,8 +1484,8 @@ TEST(GraphicsAllocation, givenSharedHandleBasedConstructorWhenGraphicsAllocation
 
 TEST(GraphicsAllocation, givenGraphicsAllocationCreatedWithDefaultConstructorThenItIsNotResidentInAllContexts) {
     MockGraphicsAllocation graphicsAllocation(nullptr, 1u);
-    for (uint32_t index = 0u; index < maxOsContextCount; index++) {
-        EXPECT_EQ(ObjectNotResident, graphicsAllocation.residencyTaskCount[index]);
+    for (uint32_t index = 0u; index < 32u; index++) {
+        EXPECT_EQ(ObjectNotResident, graphicsAllocation.getResidencyTaskCount(index));
     }
 }
 
@@ -1420,6 +1510,26 @@ TEST(ResidencyDataTest, givenTwoOsContextsWhenTheyAreRegistredFromHigherToLowerT
     EXPECT_EQ(1, osContext2->getRefInternalCount());
 }
 
+TEST(ResidencyDataTest, givenManyOsContextsWhenTheyAreRegisteredThenAllocationTracksUsageInEachOfThem) {
+    const uint32_t osContextsCount = 32u;
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    for (uint32_t contextId = 0u; contextId < osContextsCount; contextId++) {
+        memoryManager.registerOsContext(new OsContext(nullptr, contextId));
+    }
+    EXPECT_EQ(osContextsCount, memoryManager.getOsContextCount());
+
+    MockGraphicsAllocation graphicsAllocation(nullptr, 1u);
+    for (uint32_t contextId = 0u; contextId < osContextsCount; contextId++) {
+        graphicsAllocation.updateTaskCount(contextId, contextId);
+        graphicsAllocation.updateResidencyTaskCount(static_cast<int>(contextId), contextId);
+    }
+    for (uint32_t contextId = 0u; contextId < osContextsCount; contextId++) {
+        EXPECT_EQ(contextId, graphicsAllocation.getTaskCount(contextId));
+        EXPECT_TRUE(graphicsAllocation.isResident(contextId));
+    }
+}
+
 TEST(ResidencyDataTest, givenResidencyDataWhenUpdateCompletionDataIsCalledThenItIsProperlyUpdated) {
     struct MockResidencyData : public ResidencyData {
         using ResidencyData::lastFenceValues;
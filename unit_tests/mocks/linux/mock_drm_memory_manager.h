@@ -35,9 +35,15 @@ int closeMock(int) {
 
 class TestedDrmMemoryManager : public DrmMemoryManager {
   public:
+    using DrmMemoryManager::allocateHostHugePages;
     using DrmMemoryManager::allocUserptr;
+    using DrmMemoryManager::hostHugePagesMode;
+    using DrmMemoryManager::madviseFunction;
+    using DrmMemoryManager::mmapFunction;
+    using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::setDomainCpu;
     using DrmMemoryManager::sharingBufferObjects;
+    using DrmMemoryManager::userptrCache;
 
     TestedDrmMemoryManager(Drm *drm, ExecutionEnvironment &executionEnvironment) : DrmMemoryManager(drm, gemCloseWorkerMode::gemCloseWorkerInactive, false, false, executionEnvironment) {
         this->lseekFunction = &lseekMock;
@@ -49,6 +55,9 @@ class TestedDrmMemoryManager : public DrmMemoryManager {
         mmapMockCallCount = 0;
         munmapMockCallCount = 0;
         hostPtrManager.reset(new MockHostPtrManager);
+        // tests counting ioctls enable the cache explicitly
+        userptrCache.reset();
+        hostHugePagesMode = 0;
     };
     TestedDrmMemoryManager(Drm *drm, bool allowForcePin, bool validateHostPtrMemory, ExecutionEnvironment &executionEnvironment) : DrmMemoryManager(drm, gemCloseWorkerMode::gemCloseWorkerInactive, allowForcePin, validateHostPtrMemory, executionEnvironment) {
         this->lseekFunction = &lseekMock;
@@ -59,6 +68,8 @@ class TestedDrmMemoryManager : public DrmMemoryManager {
         lseekCalledCount = 0;
         mmapMockCallCount = 0;
         munmapMockCallCount = 0;
+        userptrCache.reset();
+        hostHugePagesMode = 0;
     }
 
     void unreference(BufferObject *bo) {
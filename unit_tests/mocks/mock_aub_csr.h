@@ -53,10 +53,6 @@ struct MockAubCsr : public AUBCommandStreamReceiverHw<GfxFamily> {
     MockAubCsr(const HardwareInfo &hwInfoIn, const std::string &fileName, bool standalone, ExecutionEnvironment &executionEnvironment)
         : AUBCommandStreamReceiverHw<GfxFamily>(hwInfoIn, fileName, standalone, executionEnvironment){};
 
-    DispatchMode peekDispatchMode() const {
-        return this->dispatchMode;
-    }
-
     GraphicsAllocation *getTagAllocation() const {
         return this->tagAllocation;
     }
@@ -25,6 +25,11 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
     void flush() override {
         flushCalled = true;
     }
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writeMemoryCalledCnt++;
+        sizeCapturedFromWriteMemory = size;
+        AUBCommandStreamReceiver::AubFileStream::writeMemory(physAddress, memory, size, addressSpace, hint);
+    }
     std::unique_lock<std::mutex> lockStream() override {
         lockStreamCalled = true;
         return AUBCommandStreamReceiver::AubFileStream::lockStream();
@@ -36,6 +41,8 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
         addressSpaceCapturedFromExpectMemory = addressSpace;
     }
     uint32_t initCalledCnt = 0;
+    uint32_t writeMemoryCalledCnt = 0;
+    size_t sizeCapturedFromWriteMemory = 0;
     bool flushCalled = false;
     bool lockStreamCalled = false;
     uint64_t physAddressCapturedFromExpectMemory = 0;
@@ -19,8 +19,11 @@ MockDeferredDeleter::MockDeferredDeleter() {
 
 void MockDeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     deferDeletionCalled++;
-    deletion->apply();
-    delete deletion;
+    if (deletion->apply()) {
+        delete deletion;
+        return;
+    }
+    DeferredDeleter::deferDeletion(deletion);
 }
 
 void MockDeferredDeleter::addClient() {
@@ -76,7 +79,7 @@ bool MockDeferredDeleter::isThreadRunning() {
 
 bool MockDeferredDeleter::isQueueEmpty() {
     std::lock_guard<std::mutex> lock(queueMutex);
-    return queue.peekIsEmpty();
+    return queue.peekIsEmpty() && pendingQueue.peekIsEmpty();
 }
 
 void MockDeferredDeleter::setElementsToRelease(int elementsNum) {
@@ -13,6 +13,18 @@ class MockGraphicsAllocation : public GraphicsAllocation {
     using GraphicsAllocation::GraphicsAllocation;
 
   public:
+    using GraphicsAllocation::UsageInfoChunk;
+    using GraphicsAllocation::usageInfos;
+    using GraphicsAllocation::usageInfosPerChunk;
+
+    size_t getUsageInfoChunksCount() const {
+        size_t chunksCount = 0;
+        for (auto chunk = &usageInfos; chunk; chunk = chunk->next.load()) {
+            chunksCount++;
+        }
+        return chunksCount;
+    }
+
     MockGraphicsAllocation(void *buffer, size_t sizeIn) : GraphicsAllocation(buffer, castToUint64(buffer), 0llu, sizeIn) {
     }
     void resetInspectionId() {
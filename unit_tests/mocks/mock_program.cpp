@@ -33,10 +33,13 @@ cl_int GlobalMockSipProgram::processGenBinaryOnce() {
     return ret;
 }
 void GlobalMockSipProgram::resetAllocationState() {
-    for (uint32_t index = 0u; index < maxOsContextCount; index++) {
-        this->kernelInfoArray[0]->kernelAllocation->residencyTaskCount[index] = 0xffffffff;
+    auto mockAllocation = static_cast<MockGraphicsAllocation *>(this->kernelInfoArray[0]->kernelAllocation);
+    for (MockGraphicsAllocation::UsageInfoChunk *chunk = &mockAllocation->usageInfos; chunk; chunk = chunk->next.load()) {
+        for (auto &usageInfo : chunk->usageInfos) {
+            usageInfo.residencyTaskCount = ObjectNotResident;
+        }
     }
-    static_cast<MockGraphicsAllocation *>(this->kernelInfoArray[0]->kernelAllocation)->resetInspectionId();
+    mockAllocation->resetInspectionId();
 }
 void GlobalMockSipProgram::initSipProgram() {
     cl_int retVal = 0;
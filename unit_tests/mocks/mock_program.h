@@ -29,11 +29,14 @@ class MockProgram : public Program {
     using Program::resolveProgramBinary;
     using Program::updateNonUniformFlag;
 
+    using Program::buildMutex;
     using Program::elfBinary;
     using Program::elfBinarySize;
     using Program::genBinary;
+    using Program::genBinaryIsElfView;
     using Program::genBinarySize;
     using Program::irBinary;
+    using Program::irBinaryIsElfView;
     using Program::irBinarySize;
     using Program::isProgramBinaryResolved;
     using Program::isSpirV;
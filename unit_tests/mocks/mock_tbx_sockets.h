@@ -29,6 +29,12 @@ class MockTbxSockets : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override { return true; };
     bool writeMMIO(uint32_t offset, uint32_t data) override { return true; };
 
+    bool flush() override {
+        flushCalledCount++;
+        return true;
+    };
+
     uint32_t typeCapturedFromWriteMemory = 0;
+    uint32_t flushCalledCount = 0;
 };
 } // namespace OCLRT
@@ -13,16 +13,23 @@ namespace OCLRT {
 
 class MockOfflineCompiler : public OfflineCompiler {
   public:
+    using OfflineCompiler::buildTargets;
+    using OfflineCompiler::DeviceTarget;
+    using OfflineCompiler::generateMultiTargetElfBinary;
     using OfflineCompiler::generateFilePathForIr;
     using OfflineCompiler::generateOptsSuffix;
     using OfflineCompiler::igcDeviceCtx;
     using OfflineCompiler::inputFileLlvm;
     using OfflineCompiler::inputFileSpirV;
+    using OfflineCompiler::intermediateRepresentations;
+    using OfflineCompiler::IntermediateRepresentation;
+    using OfflineCompiler::isMultiTarget;
     using OfflineCompiler::isSpirV;
     using OfflineCompiler::options;
     using OfflineCompiler::outputDirectory;
     using OfflineCompiler::outputFile;
     using OfflineCompiler::sourceCode;
+    using OfflineCompiler::targets;
     using OfflineCompiler::useLlvmText;
     using OfflineCompiler::useOptionsSuffix;
 
@@ -8,6 +8,7 @@
 #include "environment.h"
 #include "mock/mock_offline_compiler.h"
 #include "offline_compiler_tests.h"
+#include "elf/reader.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/file_io.h"
 #include "runtime/helpers/options.h"
@@ -821,4 +822,139 @@ TEST(OfflineCompilerTest, givenEnabledOptsSuffixWhenGenerateOptsSuffixIsCalledTh
     EXPECT_STREQ("A_B_C", suffix.c_str());
 }
 
+TEST(OfflineCompilerTest, givenAllDevicesOptionWhenCmdLineParsedThenTargetIsCreatedForEachSupportedDevice) {
+    MockOfflineCompiler compiler;
+    auto argv = {
+        "cloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        "all"};
+
+    auto retVal = compiler.parseCommandLine(argv.size(), argv.begin());
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    size_t supportedDevicesCount = 0;
+    for (unsigned int productId = 0; productId < IGFX_MAX_PRODUCT; ++productId) {
+        if (hardwarePrefix[productId] && hardwareInfoTable[productId]) {
+            EXPECT_EQ(1, std::count_if(compiler.targets.begin(), compiler.targets.end(), [productId](const MockOfflineCompiler::DeviceTarget &target) {
+                          return target.deviceName == hardwarePrefix[productId];
+                      }));
+            supportedDevicesCount++;
+        }
+    }
+    EXPECT_EQ(supportedDevicesCount, compiler.targets.size());
+    EXPECT_EQ(supportedDevicesCount > 1, compiler.isMultiTarget());
+}
+
+TEST(OfflineCompilerTest, givenRepeatedDeviceInListWhenCmdLineParsedThenSingleTargetIsCreated) {
+    MockOfflineCompiler compiler;
+    std::string devices = gEnvironment->devicePrefix + "," + gEnvironment->devicePrefix;
+    auto argv = {
+        "cloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        devices.c_str()};
+
+    auto retVal = compiler.parseCommandLine(argv.size(), argv.begin());
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(1u, compiler.targets.size());
+    EXPECT_FALSE(compiler.isMultiTarget());
+    EXPECT_NE(std::string::npos, compiler.getInternalOptions().find("-cl-ext="));
+}
+
+TEST(OfflineCompilerTest, givenUnknownDeviceInListWhenCmdLineParsedThenErrorForThatDeviceIsReturned) {
+    MockOfflineCompiler compiler;
+    std::string devices = gEnvironment->devicePrefix + ",foobar";
+    auto argv = {
+        "cloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        devices.c_str()};
+
+    testing::internal::CaptureStdout();
+    auto retVal = compiler.parseCommandLine(argv.size(), argv.begin());
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(CL_INVALID_DEVICE, retVal);
+    EXPECT_STREQ("Error: Cannot get HW Info for device foobar.\n", output.c_str());
+}
+
+TEST(OfflineCompilerTest, givenTargetsOfSameDeviceFamilyWhenBuiltThenSourceIsTranslatedOnceAndEachTargetHasGenBinary) {
+    MockOfflineCompiler compiler;
+    auto argv = {
+        "cloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    auto retVal = compiler.initialize(argv.size(), argv.begin());
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, compiler.targets.size());
+    compiler.targets.push_back(compiler.targets[0]);
+    compiler.targets[1].deviceName = "second";
+    ASSERT_TRUE(compiler.isMultiTarget());
+
+    retVal = compiler.buildTargets();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, compiler.intermediateRepresentations.size());
+    EXPECT_FALSE(compiler.intermediateRepresentations[0].binary.empty());
+    for (const auto &target : compiler.targets) {
+        EXPECT_EQ(CL_SUCCESS, target.retVal);
+        EXPECT_EQ(0u, target.irIndex);
+        EXPECT_FALSE(target.genBinary.empty());
+    }
+    EXPECT_EQ(compiler.targets[0].genBinary, compiler.targets[1].genBinary);
+}
+
+TEST(OfflineCompilerTest, givenMultipleTargetsWhenElfBinaryIsGeneratedThenDeviceSectionNamedAfterEachTargetIsAdded) {
+    MockOfflineCompiler compiler;
+    MockOfflineCompiler::DeviceTarget first;
+    first.deviceName = "first";
+    first.genBinary = "first gen binary";
+    MockOfflineCompiler::DeviceTarget second;
+    second.deviceName = "second";
+    second.genBinary = "second gen binary";
+    compiler.targets.push_back(first);
+    compiler.targets.push_back(second);
+    MockOfflineCompiler::IntermediateRepresentation ir;
+    ir.binary = "ir";
+    ir.codeType = IGC::CodeType::spirV;
+    compiler.intermediateRepresentations.push_back(ir);
+
+    EXPECT_TRUE(compiler.generateMultiTargetElfBinary());
+    ASSERT_NE(0u, compiler.getElfBinarySize());
+
+    CLElfLib::ElfBinaryStorage elfBinary(compiler.getElfBinary(), compiler.getElfBinary() + compiler.getElfBinarySize());
+    CLElfLib::CElfReader elfReader(elfBinary);
+    std::vector<std::string> devBinarySections;
+    bool hasSpirvSection = false;
+    for (const auto &sectionHeader : elfReader.getSectionHeaders()) {
+        if (sectionHeader.Type == CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY) {
+            devBinarySections.push_back(elfReader.getSectionName(sectionHeader));
+            devBinarySections.push_back(std::string(elfReader.getSectionData(sectionHeader.DataOffset), static_cast<size_t>(sectionHeader.DataSize)));
+        }
+        hasSpirvSection |= (sectionHeader.Type == CLElfLib::E_SH_TYPE::SH_TYPE_SPIRV);
+    }
+    std::vector<std::string> expectedDevBinarySections = {std::string(CLElfLib::devBinarySectionNamePrefix) + "first", "first gen binary",
+                                                          std::string(CLElfLib::devBinarySectionNamePrefix) + "second", "second gen binary"};
+    EXPECT_EQ(expectedDevBinarySections, devBinarySections);
+    EXPECT_TRUE(hasSpirvSection);
+}
+
+TEST(OfflineCompilerTest, givenTargetWithoutGenBinaryWhenMultiTargetElfBinaryIsGeneratedThenFalseIsReturned) {
+    MockOfflineCompiler compiler;
+    MockOfflineCompiler::DeviceTarget target;
+    target.deviceName = "first";
+    compiler.targets.push_back(target);
+
+    EXPECT_FALSE(compiler.generateMultiTargetElfBinary());
+    EXPECT_EQ(0u, compiler.getElfBinarySize());
+}
+
 } // namespace OCLRT
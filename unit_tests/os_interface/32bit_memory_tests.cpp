@@ -23,6 +23,7 @@
 #include "gtest/gtest.h"
 #include "runtime/os_interface/32bit_memory.h"
 #include "runtime/helpers/aligned_memory.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 
 using namespace OCLRT;
 
@@ -57,3 +58,17 @@ TEST(Memory32Bit, Given32bitAllocatorWithBaseAndSizeWhenAskedForBaseThenCorrectB
 
     EXPECT_EQ(base, allocator32bit.getBase());
 }
+
+TEST(Memory32Bit, givenSegregatedHeapAllocatorDisabledWhenAskedForAllocationThenPageAlignedPointerIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UseSegregatedHeapAllocator.set(false);
+
+    size_t size = 100u;
+    Allocator32bit allocator32bit;
+    auto ptr = allocator32bit.allocate(size);
+    EXPECT_NE(0u, ptr);
+    EXPECT_EQ(ptr, alignDown(ptr, MemoryConstants::pageSize));
+    EXPECT_EQ(MemoryConstants::pageSize, size);
+    auto ret = allocator32bit.free(ptr, size);
+    EXPECT_EQ(0, ret);
+}
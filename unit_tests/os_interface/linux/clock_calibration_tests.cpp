@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/clock_calibration.h"
+#include "runtime/os_interface/linux/os_interface.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/os_interface/linux/device_command_stream_fixture.h"
+#include "unit_tests/os_interface/linux/mock_os_time_linux.h"
+#include "test.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace OCLRT;
+
+namespace {
+const uint64_t timestampMask36 = (1ull << OCLRT_NUM_TIMESTAMP_BITS) - 1;
+const uint64_t msInNs = 1000000ull;
+
+std::atomic<uint64_t> simulatedCpuTimeNs{0};
+
+int getSimulatedTime(clockid_t clkId, struct timespec *tp) throw() {
+    uint64_t now = simulatedCpuTimeNs.load();
+    tp->tv_sec = now / NSEC_PER_SEC;
+    tp->tv_nsec = now % NSEC_PER_SEC;
+    return 0;
+}
+
+// Exposes a 36-bit GPU timestamp register running at a nominal 12 MHz with a constant drift against
+// the simulated CPU clock. Each register read takes readLatencyNs of CPU time and the GPU tick is
+// sampled at a varying point inside that window, like a real ioctl round trip.
+class DrmMockDriftingClock : public DrmMockSuccess {
+  public:
+    int ioctl(unsigned long request, void *arg) override {
+        if (request != DRM_IOCTL_I915_REG_READ) {
+            return 0;
+        }
+        auto reg = reinterpret_cast<drm_i915_reg_read *>(arg);
+        if (reg->offset != (TIMESTAMP_LOW_REG | 1)) {
+            return -1;
+        }
+        regReadCalled++;
+        uint64_t sampledAt = readLatencyNs * ((regReadCalled * 37) % 100) / 100;
+        simulatedCpuTimeNs += sampledAt;
+        reg->val = getGpuTicks(simulatedCpuTimeNs.load());
+        simulatedCpuTimeNs += readLatencyNs - sampledAt;
+        return 0;
+    }
+
+    uint64_t getGpuTicks(uint64_t cpuTimeNs) const {
+        double ticks = static_cast<double>(cpuTimeNs) * nominalTicksPerNs * (1.0 + driftPpm * 1e-6);
+        return (initialGpuTicks + static_cast<uint64_t>(ticks)) & timestampMask36;
+    }
+
+    uint64_t initialGpuTicks = 1000;
+    double nominalTicksPerNs = 0.012;
+    double driftPpm = 50.0;
+    uint64_t readLatencyNs = 2000;
+    std::atomic<uint32_t> regReadCalled{0};
+};
+
+int64_t ticksDistance(uint64_t lhs, uint64_t rhs) {
+    return static_cast<int64_t>(((lhs - rhs + (timestampMask36 + 1) / 2) & timestampMask36)) - static_cast<int64_t>((timestampMask36 + 1) / 2);
+}
+} // namespace
+
+struct ClockCalibrationTest : public ::testing::Test {
+    void SetUp() override {
+        simulatedCpuTimeNs = 10 * msInNs;
+        osInterface.reset(new OSInterface());
+        osTime = MockOSTimeLinux::create(osInterface.get());
+        osTime->setGetTimeFunc(getSimulatedTime);
+        drm.reset(new DrmMockDriftingClock());
+        osTime->updateDrm(drm.get());
+        osTime->enableClockCalibration(maxAnchorAgeNs);
+        drm->regReadCalled = 0;
+    }
+
+    void sampleAnchors(size_t count, uint64_t intervalNs) {
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_TRUE(osTime->sampleClockAnchor());
+            simulatedCpuTimeNs += intervalNs;
+        }
+    }
+
+    const uint64_t maxAnchorAgeNs = 40 * msInNs;
+    std::unique_ptr<OSInterface> osInterface;
+    std::unique_ptr<MockOSTimeLinux> osTime;
+    std::unique_ptr<DrmMockDriftingClock> drm;
+};
+
+TEST_F(ClockCalibrationTest, givenDriftingGpuClockWhenCalibratedThenCpuGpuTimeIsAnsweredWithoutRegisterReadsWithinErrorBound) {
+    sampleAnchors(ClockCalibration::defaultMaxAnchors, 10 * msInNs);
+    ASSERT_TRUE(osTime->clockCalibration->isCalibrated());
+    drm->regReadCalled = 0;
+
+    for (int i = 0; i < 10; i++) {
+        TimeStampData cpuGpuTime = {0, 0};
+        EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(simulatedCpuTimeNs.load(), cpuGpuTime.CPUTimeinNS);
+
+        uint64_t convertedTicks = 0;
+        uint64_t errorBound = 0;
+        EXPECT_TRUE(osTime->clockCalibration->convert(cpuGpuTime.CPUTimeinNS, convertedTicks, &errorBound));
+        EXPECT_EQ(convertedTicks, cpuGpuTime.GPUTimeStamp);
+        EXPECT_GE(ClockCalibration::defaultMaxErrorTicks, errorBound);
+
+        int64_t error = ticksDistance(cpuGpuTime.GPUTimeStamp, drm->getGpuTicks(cpuGpuTime.CPUTimeinNS));
+        EXPECT_GE(static_cast<int64_t>(errorBound), std::abs(error));
+
+        simulatedCpuTimeNs += 3 * msInNs;
+    }
+    EXPECT_EQ(0u, drm->regReadCalled);
+}
+
+TEST_F(ClockCalibrationTest, givenTooFewAnchorsWhenCpuGpuTimeIsQueriedThenRegisterIsRead) {
+    sampleAnchors(ClockCalibration::minAnchorsToFit - 1, 10 * msInNs);
+    EXPECT_FALSE(osTime->clockCalibration->isCalibrated());
+    drm->regReadCalled = 0;
+
+    TimeStampData cpuGpuTime = {0, 0};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(1u, drm->regReadCalled);
+}
+
+TEST_F(ClockCalibrationTest, givenStaleAnchorsWhenCpuGpuTimeIsQueriedThenRegisterIsRead) {
+    sampleAnchors(ClockCalibration::defaultMaxAnchors, 10 * msInNs);
+    ASSERT_TRUE(osTime->clockCalibration->isCalibrated());
+    simulatedCpuTimeNs += 2 * maxAnchorAgeNs;
+    drm->regReadCalled = 0;
+
+    TimeStampData cpuGpuTime = {0, 0};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(1u, drm->regReadCalled);
+}
+
+TEST_F(ClockCalibrationTest, givenGpuTimestampWrappingBetweenAnchorsWhenConvertingThenResultIsMaskedToTimestampBits) {
+    drm->initialGpuTicks = timestampMask36 - drm->getGpuTicks(simulatedCpuTimeNs.load() + 30 * msInNs) + drm->initialGpuTicks;
+    sampleAnchors(ClockCalibration::defaultMaxAnchors, 10 * msInNs);
+    ASSERT_TRUE(osTime->clockCalibration->isCalibrated());
+
+    uint64_t convertedTicks = 0;
+    uint64_t errorBound = 0;
+    uint64_t cpuTimeNs = simulatedCpuTimeNs.load();
+    EXPECT_TRUE(osTime->clockCalibration->convert(cpuTimeNs, convertedTicks, &errorBound));
+    EXPECT_GE(timestampMask36, convertedTicks);
+    EXPECT_LT(convertedTicks, drm->initialGpuTicks);
+    EXPECT_GE(static_cast<int64_t>(errorBound), std::abs(ticksDistance(convertedTicks, drm->getGpuTicks(cpuTimeNs))));
+}
+
+TEST_F(ClockCalibrationTest, givenGpuClockJumpWhenAnchorIsSampledThenModelIsRestarted) {
+    sampleAnchors(ClockCalibration::defaultMaxAnchors, 10 * msInNs);
+    ASSERT_TRUE(osTime->clockCalibration->isCalibrated());
+
+    drm->initialGpuTicks += 1000000;
+    sampleAnchors(1, 10 * msInNs);
+    EXPECT_EQ(1u, osTime->clockCalibration->getAnchorsCount());
+    EXPECT_FALSE(osTime->clockCalibration->isCalibrated());
+}
+
+TEST_F(ClockCalibrationTest, givenNewDrmWhenTimestampTypeIsDetectedThenCalibrationIsReset) {
+    sampleAnchors(ClockCalibration::defaultMaxAnchors, 10 * msInNs);
+    ASSERT_TRUE(osTime->clockCalibration->isCalibrated());
+
+    osTime->timestampTypeDetect();
+    EXPECT_EQ(0u, osTime->clockCalibration->getAnchorsCount());
+    EXPECT_FALSE(osTime->clockCalibration->isCalibrated());
+}
+
+TEST(ClockCalibration, givenExactLinearAnchorsWhenConvertingThenResultMatchesLine) {
+    ClockCalibration calibration(OCLRT_NUM_TIMESTAMP_BITS, 100 * msInNs);
+    for (uint64_t i = 0; i < ClockCalibration::defaultMaxAnchors; i++) {
+        calibration.addAnchor(i * msInNs, 500 + i * 12000);
+    }
+    ASSERT_TRUE(calibration.isCalibrated());
+
+    uint64_t gpuTicks = 0;
+    uint64_t errorBound = 0;
+    EXPECT_TRUE(calibration.convert(20 * msInNs, gpuTicks, &errorBound));
+    EXPECT_EQ(500u + 20 * 12000, gpuTicks);
+    EXPECT_GE(2u, errorBound);
+}
+
+TEST(ClockCalibration, givenAnchorNotNewerThanLastOneWhenAddedThenItIsIgnored) {
+    ClockCalibration calibration(OCLRT_NUM_TIMESTAMP_BITS, 100 * msInNs);
+    calibration.addAnchor(2 * msInNs, 24000);
+    calibration.addAnchor(2 * msInNs, 24000);
+    calibration.addAnchor(msInNs, 12000);
+    EXPECT_EQ(1u, calibration.getAnchorsCount());
+}
+
+TEST(ClockCalibration, givenTooFewAnchorsOrCpuTimeBeforeFirstAnchorWhenConvertingThenConversionFails) {
+    ClockCalibration calibration(OCLRT_NUM_TIMESTAMP_BITS, 100 * msInNs);
+    uint64_t gpuTicks = 0;
+    EXPECT_FALSE(calibration.convert(msInNs, gpuTicks));
+    for (uint64_t i = 1; i <= ClockCalibration::minAnchorsToFit; i++) {
+        calibration.addAnchor(i * msInNs, i * 12000);
+    }
+    EXPECT_TRUE(calibration.convert(4 * msInNs, gpuTicks));
+    EXPECT_FALSE(calibration.convert(0, gpuTicks));
+}
+
+TEST(ClockCalibration, givenNoisyAnchorsWhenErrorBoundExceedsLimitThenConversionFails) {
+    ClockCalibration calibration(OCLRT_NUM_TIMESTAMP_BITS, 100 * msInNs, ClockCalibration::defaultMaxAnchors, 10);
+    for (uint64_t i = 0; i < ClockCalibration::defaultMaxAnchors; i++) {
+        calibration.addAnchor(i * msInNs, i * 12000 + (i % 2) * 8);
+    }
+    ASSERT_TRUE(calibration.isCalibrated());
+
+    uint64_t gpuTicks = 0;
+    EXPECT_TRUE(calibration.convert(ClockCalibration::defaultMaxAnchors * msInNs / 2, gpuTicks));
+    EXPECT_FALSE(calibration.convert(90 * msInNs, gpuTicks));
+}
+
+TEST(ClockCalibrationWorker, givenCalibrationIntervalFlagWhenOsTimeIsCreatedThenBackgroundWorkerSamplesAnchorsUntilStopped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GpuClockCalibrationIntervalMs.set(1);
+
+    std::unique_ptr<DrmMockDriftingClock> drm(new DrmMockDriftingClock());
+    std::unique_ptr<OSInterface> osInterface(new OSInterface());
+    osInterface->get()->setDrm(drm.get());
+    auto osTime = MockOSTimeLinux::create(osInterface.get());
+    ASSERT_NE(nullptr, osTime->clockCalibration.get());
+    ASSERT_NE(nullptr, osTime->clockCalibrationThread.get());
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (osTime->clockCalibration->getAnchorsCount() < ClockCalibration::minAnchorsToFit &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_LE(ClockCalibration::minAnchorsToFit, osTime->clockCalibration->getAnchorsCount());
+
+    osTime->stopClockCalibration();
+    EXPECT_EQ(nullptr, osTime->clockCalibrationThread.get());
+    uint32_t regReadsAfterStop = drm->regReadCalled;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(regReadsAfterStop, drm->regReadCalled);
+}
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "runtime/command_stream/device_command_stream.h"
 #include "runtime/execution_environment/execution_environment.h"
@@ -33,6 +34,7 @@ class DrmMockForWorker : public Drm {
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
     std::atomic<std::thread::id> ioctl_caller_thread_id;
+    std::vector<uint32_t> closedHandles;
     DrmMockForWorker() : Drm(33) {
     }
     int ioctl(unsigned long request, void *arg) override {
@@ -40,6 +42,9 @@ class DrmMockForWorker : public Drm {
             //when drm ioctl is called, try acquire mutex
             //main thread can hold mutex, to prevent ioctl handling
             std::lock_guard<std::mutex> lock(mutex);
+            if (request == DRM_IOCTL_GEM_CLOSE) {
+                closedHandles.push_back(static_cast<drm_gem_close *>(arg)->handle);
+            }
         }
         if (request == DRM_IOCTL_GEM_CLOSE)
             gem_close_cnt++;
@@ -183,3 +188,71 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenObjectsPushedFromManyThreadsWhenWorkerIsClosedThenAllObjectsAreClosed) {
+    const int threadsCount = 4;
+    const int objectsPerThread = 256;
+    this->drmMock->gem_close_expected = threadsCount * objectsPerThread;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadsCount; i++) {
+        threads.push_back(std::thread([&, i]() {
+            for (int j = 0; j < objectsPerThread; j++) {
+                worker->push(new BufferObjectWrapper(this->drmMock, i * objectsPerThread + j));
+            }
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    delete worker;
+    EXPECT_EQ(static_cast<size_t>(threadsCount * objectsPerThread), this->drmMock->closedHandles.size());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenObjectsPushedWhileWorkerIsBusyWhenTheyAreClosedThenObjectsHoldingAddressRangesAreClosedFirst) {
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::queue;
+    };
+    this->drmMock->gem_close_expected = 4;
+
+    auto worker = new MockDrmGemCloseWorker(*mm);
+    std::unique_lock<std::mutex> lock(this->drmMock->mutex);
+
+    // worker blocks on ioctl of the first object
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
+    while (!worker->queue.peekIsEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+
+    worker->push(new BufferObjectWrapper(this->drmMock, 2));
+    auto objectWithAddressRange = new BufferObjectWrapper(this->drmMock, 3);
+    objectWithAddressRange->setUnmapSize(MemoryConstants::pageSize);
+    worker->push(objectWithAddressRange);
+    worker->push(new BufferObjectWrapper(this->drmMock, 4));
+    lock.unlock();
+
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+
+    std::vector<uint32_t> expectedOrder = {1, 3, 2, 4};
+    EXPECT_EQ(expectedOrder, this->drmMock->closedHandles);
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenClosedWorkerWhenObjectIsPushedThenItIsClosedFromCallingThread) {
+    this->drmMock->gem_close_expected = 1;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    worker->close(true);
+    EXPECT_FALSE(worker->isActive());
+
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(1u, this->drmMock->closedHandles.size());
+    EXPECT_EQ(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+
+    delete worker;
+}
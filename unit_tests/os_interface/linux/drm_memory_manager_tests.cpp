@@ -2287,17 +2287,17 @@ TEST(MmapFlags, givenVariousMmapParametersGetTimeDeltaForTheOperation) {
 TEST(DrmMemoryManager, givenDefaultMemoryManagerWhenItIsCreatedThenAsyncDeleterEnabledIsTrue) {
     ExecutionEnvironment executionEnvironment;
     DrmMemoryManager memoryManager(Drm::get(0), gemCloseWorkerMode::gemCloseWorkerInactive, false, true, executionEnvironment);
-    EXPECT_FALSE(memoryManager.isAsyncDeleterEnabled());
-    EXPECT_EQ(nullptr, memoryManager.getDeferredDeleter());
+    EXPECT_TRUE(memoryManager.isAsyncDeleterEnabled());
+    EXPECT_NE(nullptr, memoryManager.getDeferredDeleter());
 }
 
-TEST(DrmMemoryManager, givenEnabledAsyncDeleterFlagWhenMemoryManagerIsCreatedThenAsyncDeleterEnabledIsFalseAndDeleterIsNullptr) {
+TEST(DrmMemoryManager, givenEnabledAsyncDeleterFlagWhenMemoryManagerIsCreatedThenAsyncDeleterEnabledIsTrueAndDeleterIsNotNullptr) {
     ExecutionEnvironment executionEnvironment;
     DebugManagerStateRestore dbgStateRestore;
     DebugManager.flags.EnableDeferredDeleter.set(true);
     DrmMemoryManager memoryManager(Drm::get(0), gemCloseWorkerMode::gemCloseWorkerInactive, false, true, executionEnvironment);
-    EXPECT_FALSE(memoryManager.isAsyncDeleterEnabled());
-    EXPECT_EQ(nullptr, memoryManager.getDeferredDeleter());
+    EXPECT_TRUE(memoryManager.isAsyncDeleterEnabled());
+    EXPECT_NE(nullptr, memoryManager.getDeferredDeleter());
 }
 
 TEST(DrmMemoryManager, givenDisabledAsyncDeleterFlagWhenMemoryManagerIsCreatedThenAsyncDeleterEnabledIsFalseAndDeleterIsNullptr) {
@@ -2728,6 +2728,74 @@ TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenEnabledValidateHostMem
     testedMemoryManager->cleanOsHandles(handleStorage);
 }
 
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrCacheWhenHostPtrIsAllocatedAgainAfterReleaseThenCachedBufferObjectIsReusedAndPinnedAgain) {
+    std::unique_ptr<TestedDrmMemoryManager> testedMemoryManager(new TestedDrmMemoryManager(this->mock, false, true, executionEnvironment));
+    ASSERT_NE(nullptr, testedMemoryManager->getPinBB());
+    testedMemoryManager->userptrCache.reset(new DrmUserptrCache(2));
+
+    mock->reset();
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.execbuffer2 = 2;
+
+    void *ptr = ::alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, ptr);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, testedMemoryManager->userptrCache->size());
+
+    allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, ptr);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(0u, testedMemoryManager->userptrCache->size());
+    testedMemoryManager->freeGraphicsMemory(allocation);
+
+    mock->testIoctls();
+
+    // cached object is released with memory manager
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 2;
+    testedMemoryManager.reset();
+    mock->testIoctls();
+    ::alignedFree(ptr);
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrCacheWhenPinningFailsWithEfaultThenCachedBufferObjectsOfTheRangeAreReleased) {
+    std::unique_ptr<TestedDrmMemoryManager> testedMemoryManager(new TestedDrmMemoryManager(this->mock, false, true, executionEnvironment));
+    ASSERT_NE(nullptr, testedMemoryManager->getPinBB());
+    testedMemoryManager->userptrCache.reset(new DrmUserptrCache(2));
+
+    mock->reset();
+
+    void *ptr = ::alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto allocation = testedMemoryManager->allocateGraphicsMemory(MemoryConstants::pageSize, ptr);
+    ASSERT_NE(nullptr, allocation);
+    testedMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, testedMemoryManager->userptrCache->size());
+
+    // pinning of bigger range wrapping the cached pages fails
+    DrmMockCustom::IoctlResExt ioctlResExt = {3, -1};
+    mock->ioctl_res_ext = &ioctlResExt;
+    mock->errnoValue = EFAULT;
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.execbuffer2 = 2;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    OsHandleStorage handleStorage;
+    handleStorage.fragmentStorageData[0].cpuPtr = ptr;
+    handleStorage.fragmentStorageData[0].fragmentSize = 2 * MemoryConstants::pageSize;
+
+    auto result = testedMemoryManager->populateOsHandles(handleStorage);
+    EXPECT_EQ(MemoryManager::AllocationStatus::InvalidHostPointer, result);
+    EXPECT_EQ(0u, testedMemoryManager->userptrCache->size());
+    mock->testIoctls();
+
+    testedMemoryManager->cleanOsHandles(handleStorage);
+    mock->ioctl_res_ext = &mock->NONE;
+    ::alignedFree(ptr);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenEnabledValidateHostMemoryWhenPopulateOsHandlesSucceedsThenFragmentIsStoredInHostPtrManager) {
     std::unique_ptr<TestedDrmMemoryManager> testedMemoryManager(new TestedDrmMemoryManager(this->mock, false, true, executionEnvironment));
     ASSERT_NE(nullptr, testedMemoryManager->getPinBB());
@@ -2779,3 +2847,155 @@ TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenCl
         EXPECT_EQ(nullptr, handleStorage.fragmentStorageData[i].residency);
     }
 }
+
+namespace {
+struct HugePagesMappingRecord {
+    std::vector<int> mmapFlags;
+    std::vector<std::pair<void *, size_t>> unmappedRanges;
+    std::vector<std::pair<void *, size_t>> advisedRanges;
+    bool failHugeTlbMapping = true;
+} hugePagesRecord;
+
+// returns range misaligned to huge page by one 4KB page
+void *hugePagesMmapMock(void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
+    hugePagesRecord.mmapFlags.push_back(flags);
+    if (flags & MAP_HUGETLB) {
+        return hugePagesRecord.failHugeTlbMapping ? MAP_FAILED : reinterpret_cast<void *>(0x40000000);
+    }
+    return reinterpret_cast<void *>(0x40001000);
+}
+
+void *failingMmapMock(void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
+    return MAP_FAILED;
+}
+
+int hugePagesMunmapMock(void *addr, size_t length) noexcept {
+    hugePagesRecord.unmappedRanges.push_back({addr, length});
+    return 0;
+}
+
+int hugePagesMadviseMock(void *addr, size_t length, int advice) noexcept {
+    if (advice == MADV_HUGEPAGE) {
+        hugePagesRecord.advisedRanges.push_back({addr, length});
+    }
+    return 0;
+}
+} // namespace
+
+TEST_F(DrmMemoryManagerTest, givenTransparentHostHugePagesWhenHugePagesAreAllocatedThenMappingIsTrimmedToHugePageBoundariesAndAdvised) {
+    hugePagesRecord = {};
+    memoryManager->hostHugePagesMode = 1;
+    memoryManager->mmapFunction = hugePagesMmapMock;
+    memoryManager->munmapFunction = hugePagesMunmapMock;
+    memoryManager->madviseFunction = hugePagesMadviseMock;
+
+    auto size = 2 * MemoryConstants::pageSize2Mb;
+    auto ptr = memoryManager->allocateHostHugePages(size);
+    EXPECT_EQ(reinterpret_cast<void *>(0x40200000), ptr);
+
+    ASSERT_EQ(1u, hugePagesRecord.mmapFlags.size());
+    EXPECT_EQ(0, hugePagesRecord.mmapFlags[0] & MAP_HUGETLB);
+    ASSERT_EQ(2u, hugePagesRecord.unmappedRanges.size());
+    EXPECT_EQ(reinterpret_cast<void *>(0x40001000), hugePagesRecord.unmappedRanges[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb - MemoryConstants::pageSize, hugePagesRecord.unmappedRanges[0].second);
+    EXPECT_EQ(ptrOffset(ptr, size), hugePagesRecord.unmappedRanges[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize, hugePagesRecord.unmappedRanges[1].second);
+    ASSERT_EQ(1u, hugePagesRecord.advisedRanges.size());
+    EXPECT_EQ(ptr, hugePagesRecord.advisedRanges[0].first);
+    EXPECT_EQ(size, hugePagesRecord.advisedRanges[0].second);
+}
+
+TEST_F(DrmMemoryManagerTest, givenExplicitHostHugePagesWhenHugeTlbMappingSucceedsThenItIsReturnedWithoutAdvice) {
+    hugePagesRecord = {};
+    hugePagesRecord.failHugeTlbMapping = false;
+    memoryManager->hostHugePagesMode = 2;
+    memoryManager->mmapFunction = hugePagesMmapMock;
+    memoryManager->munmapFunction = hugePagesMunmapMock;
+    memoryManager->madviseFunction = hugePagesMadviseMock;
+
+    auto ptr = memoryManager->allocateHostHugePages(MemoryConstants::pageSize2Mb);
+    EXPECT_EQ(reinterpret_cast<void *>(0x40000000), ptr);
+    ASSERT_EQ(1u, hugePagesRecord.mmapFlags.size());
+    EXPECT_NE(0, hugePagesRecord.mmapFlags[0] & MAP_HUGETLB);
+    EXPECT_TRUE(hugePagesRecord.unmappedRanges.empty());
+    EXPECT_TRUE(hugePagesRecord.advisedRanges.empty());
+}
+
+TEST_F(DrmMemoryManagerTest, givenExplicitHostHugePagesWhenNoHugePagesAreReservedThenTransparentHugePagesAreUsed) {
+    hugePagesRecord = {};
+    memoryManager->hostHugePagesMode = 2;
+    memoryManager->mmapFunction = hugePagesMmapMock;
+    memoryManager->munmapFunction = hugePagesMunmapMock;
+    memoryManager->madviseFunction = hugePagesMadviseMock;
+
+    auto ptr = memoryManager->allocateHostHugePages(MemoryConstants::pageSize2Mb);
+    EXPECT_EQ(reinterpret_cast<void *>(0x40200000), ptr);
+    ASSERT_EQ(2u, hugePagesRecord.mmapFlags.size());
+    EXPECT_NE(0, hugePagesRecord.mmapFlags[0] & MAP_HUGETLB);
+    EXPECT_EQ(0, hugePagesRecord.mmapFlags[1] & MAP_HUGETLB);
+    EXPECT_EQ(1u, hugePagesRecord.advisedRanges.size());
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostHugePagesEnabledWhenAllocationWithSmallHugePagePaddingIsCreatedThenItIsBackedByHugePageAlignedMapping) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    memoryManager->hostHugePagesMode = 1;
+    memoryManager->mmapFunction = mmap;
+    memoryManager->munmapFunction = munmap;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemory(2 * MemoryConstants::pageSize2Mb - MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    auto ptr = allocation->getUnderlyingBuffer();
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % MemoryConstants::pageSize2Mb);
+    EXPECT_EQ(2 * MemoryConstants::pageSize2Mb, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(MemoryPool::System4KBPages, allocation->getMemoryPool());
+    EXPECT_EQ(2 * MemoryConstants::pageSize2Mb, allocation->getBO()->peekUnmapSize());
+    EXPECT_EQ(MMAP_ALLOCATOR, allocation->getBO()->peekAllocationType());
+    memset(ptr, 0, allocation->getUnderlyingBufferSize());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostHugePagesEnabledWhenAllocationSmallerThanHugePageIsCreatedThenHugePagesAreNotUsed) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    memoryManager->hostHugePagesMode = 1;
+    memoryManager->mmapFunction = failingMmapMock;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize2Mb - MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryPool::System4KBPages, allocation->getMemoryPool());
+    EXPECT_EQ(0u, allocation->getBO()->peekUnmapSize());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostHugePagesEnabledWhenAllocationWithLargeHugePagePaddingIsCreatedThenHugePagesAreNotUsed) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    memoryManager->hostHugePagesMode = 1;
+    memoryManager->mmapFunction = failingMmapMock;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize2Mb + MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryConstants::pageSize2Mb + MemoryConstants::pageSize, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0u, allocation->getBO()->peekUnmapSize());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostHugePagesEnabledWhenMappingFailsThenAllocationFallsBackToAlignedMalloc) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    memoryManager->hostHugePagesMode = 2;
+    memoryManager->mmapFunction = failingMmapMock;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemory(2 * MemoryConstants::pageSize2Mb));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2 * MemoryConstants::pageSize2Mb, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(MemoryPool::System4KBPages, allocation->getMemoryPool());
+    EXPECT_EQ(0u, allocation->getBO()->peekUnmapSize());
+    memoryManager->freeGraphicsMemory(allocation);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/drm_userptr_cache.h"
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+namespace {
+// cache never dereferences stored objects
+BufferObject *fakeBo(uintptr_t value) {
+    return reinterpret_cast<BufferObject *>(value);
+}
+} // namespace
+
+TEST(DrmUserptrCacheTest, givenEmptyCacheWhenObjectIsTakenThenNullptrIsReturned) {
+    DrmUserptrCache cache(4);
+    EXPECT_EQ(nullptr, cache.take(0x1000, 0x1000));
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(4u, cache.getCapacity());
+}
+
+TEST(DrmUserptrCacheTest, givenStoredObjectWhenTheSameRangeIsTakenThenObjectIsReturnedAndRemovedFromCache) {
+    DrmUserptrCache cache(4);
+    EXPECT_EQ(nullptr, cache.store(0x1000, 0x2000, fakeBo(0x10)));
+    EXPECT_EQ(1u, cache.size());
+
+    EXPECT_EQ(nullptr, cache.take(0x1000, 0x1000));
+    EXPECT_EQ(nullptr, cache.take(0x2000, 0x1000));
+    EXPECT_EQ(fakeBo(0x10), cache.take(0x1000, 0x2000));
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(nullptr, cache.take(0x1000, 0x2000));
+}
+
+TEST(DrmUserptrCacheTest, givenFullCacheWhenObjectIsStoredThenLeastRecentlyStoredObjectIsEvicted) {
+    DrmUserptrCache cache(2);
+    EXPECT_EQ(nullptr, cache.store(0x1000, 0x1000, fakeBo(0x10)));
+    EXPECT_EQ(nullptr, cache.store(0x2000, 0x1000, fakeBo(0x20)));
+    EXPECT_EQ(fakeBo(0x10), cache.store(0x3000, 0x1000, fakeBo(0x30)));
+    EXPECT_EQ(2u, cache.size());
+
+    EXPECT_EQ(nullptr, cache.take(0x1000, 0x1000));
+    EXPECT_EQ(fakeBo(0x20), cache.take(0x2000, 0x1000));
+    // taken object is stored again as the most recent one
+    EXPECT_EQ(nullptr, cache.store(0x2000, 0x1000, fakeBo(0x20)));
+    EXPECT_EQ(fakeBo(0x30), cache.store(0x4000, 0x1000, fakeBo(0x40)));
+}
+
+TEST(DrmUserptrCacheTest, givenCachedRangeWhenAnotherObjectOfTheSameRangeIsStoredThenPreviousObjectIsReturned) {
+    DrmUserptrCache cache(2);
+    EXPECT_EQ(nullptr, cache.store(0x1000, 0x1000, fakeBo(0x10)));
+    EXPECT_EQ(fakeBo(0x10), cache.store(0x1000, 0x1000, fakeBo(0x20)));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(fakeBo(0x20), cache.take(0x1000, 0x1000));
+}
+
+TEST(DrmUserptrCacheTest, givenCachedObjectsWhenRangeIsEvictedThenOnlyOverlappingObjectsAreRemoved) {
+    DrmUserptrCache cache(8);
+    cache.store(0x1000, 0x1000, fakeBo(0x10));
+    cache.store(0x2000, 0x2000, fakeBo(0x20));
+    cache.store(0x3000, 0x1000, fakeBo(0x30));
+    cache.store(0x5000, 0x1000, fakeBo(0x50));
+
+    std::vector<BufferObject *> evicted;
+    cache.evict(0x3000, 0x2000, evicted);
+
+    ASSERT_EQ(2u, evicted.size());
+    EXPECT_EQ(fakeBo(0x20), evicted[0]);
+    EXPECT_EQ(fakeBo(0x30), evicted[1]);
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(fakeBo(0x10), cache.take(0x1000, 0x1000));
+    EXPECT_EQ(fakeBo(0x50), cache.take(0x5000, 0x1000));
+}
+
+TEST(DrmUserptrCacheTest, givenCachedObjectsWhenAllAreEvictedThenCacheIsEmpty) {
+    DrmUserptrCache cache(4);
+    cache.store(0x1000, 0x1000, fakeBo(0x10));
+    cache.store(0x2000, 0x1000, fakeBo(0x20));
+
+    std::vector<BufferObject *> evicted;
+    cache.evictAll(evicted);
+    EXPECT_EQ(2u, evicted.size());
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(DrmUserptrCacheTest, givenZeroCapacityWhenObjectIsStoredThenTheSameObjectIsReturned) {
+    DrmUserptrCache cache(0);
+    EXPECT_EQ(fakeBo(0x10), cache.store(0x1000, 0x1000, fakeBo(0x10)));
+    EXPECT_EQ(0u, cache.size());
+}
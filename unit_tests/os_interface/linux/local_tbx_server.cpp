@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unit_tests/os_interface/linux/local_tbx_server.h"
+#include "runtime/tbx/tbx_proto.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCLRT {
+
+namespace {
+const uint64_t serverPageSize = 4096;
+const size_t receiveBufferSize = 256 * 1024;
+}
+
+LocalTbxServer::LocalTbxServer() {
+    listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket < 0) {
+        return;
+    }
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+
+    if (::bind(listenSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        ::listen(listenSocket, 1) != 0 ||
+        ::getsockname(listenSocket, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0) {
+        ::close(listenSocket);
+        listenSocket = -1;
+        return;
+    }
+    port = ntohs(address.sin_port);
+    worker = std::thread([this] { run(); });
+}
+
+LocalTbxServer::~LocalTbxServer() {
+    if (listenSocket >= 0) {
+        // unblocks accept when no client connected
+        ::shutdown(listenSocket, SHUT_RDWR);
+    }
+    waitForClient();
+    if (listenSocket >= 0) {
+        ::close(listenSocket);
+    }
+}
+
+void LocalTbxServer::waitForClient() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void LocalTbxServer::run() {
+    auto clientSocket = ::accept(listenSocket, nullptr, nullptr);
+    if (clientSocket < 0) {
+        return;
+    }
+    while (serveClient(clientSocket)) {
+    }
+    ::close(clientSocket);
+}
+
+bool LocalTbxServer::receive(int clientSocket, void *data, size_t size) {
+    auto buffer = reinterpret_cast<char *>(data);
+    while (size > 0) {
+        if (receiveOffset == receiveBuffer.size()) {
+            // read as much as client already sent to avoid system call per message
+            receiveBuffer.resize(receiveBufferSize);
+            auto bytesReceived = ::recv(clientSocket, receiveBuffer.data(), receiveBuffer.size(), 0);
+            if (bytesReceived <= 0) {
+                receiveBuffer.clear();
+                receiveOffset = 0;
+                return false;
+            }
+            receiveBuffer.resize(static_cast<size_t>(bytesReceived));
+            receiveOffset = 0;
+            recvCalls++;
+        }
+        auto sizeThisIteration = std::min(size, receiveBuffer.size() - receiveOffset);
+        memcpy(buffer, receiveBuffer.data() + receiveOffset, sizeThisIteration);
+        receiveOffset += sizeThisIteration;
+        buffer += sizeThisIteration;
+        size -= sizeThisIteration;
+    }
+    return true;
+}
+
+bool LocalTbxServer::send(int clientSocket, const void *data, size_t size) {
+    auto buffer = reinterpret_cast<const char *>(data);
+    size_t totalSent = 0;
+    while (totalSent < size) {
+        auto bytesSent = ::send(clientSocket, buffer + totalSent, size - totalSent, 0);
+        if (bytesSent <= 0) {
+            return false;
+        }
+        totalSent += static_cast<size_t>(bytesSent);
+    }
+    return true;
+}
+
+bool LocalTbxServer::serveClient(int clientSocket) {
+    HAS_MSG msg = {};
+    if (!receive(clientSocket, &msg.hdr, sizeof(msg.hdr))) {
+        return false;
+    }
+    if (msg.hdr.size > sizeof(msg.u) || !receive(clientSocket, &msg.u, msg.hdr.size)) {
+        protocolError = true;
+        return false;
+    }
+    if (messagesReceived != 0 && msg.hdr.trans_id != lastTransId + 1) {
+        protocolError = true;
+    }
+    lastTransId = msg.hdr.trans_id;
+    messagesReceived++;
+
+    switch (msg.hdr.msg_type) {
+    case HAS_CONTROL_REQ_TYPE:
+        return true;
+    case HAS_GTT_REQ_TYPE: {
+        std::lock_guard<std::mutex> lock(mtx);
+        gtt[msg.u.gtt64_req.offset] = (static_cast<uint64_t>(msg.u.gtt64_req.data_h) << 32) | msg.u.gtt64_req.data;
+        return true;
+    }
+    case HAS_MMIO_REQ_TYPE: {
+        if (msg.u.mmio_req.write) {
+            std::lock_guard<std::mutex> lock(mtx);
+            mmio[msg.u.mmio_req.offset] = msg.u.mmio_req.data;
+            return true;
+        }
+        HAS_MSG response = {};
+        response.hdr.msg_type = HAS_MMIO_RES_TYPE;
+        response.hdr.trans_id = msg.hdr.trans_id;
+        response.hdr.size = sizeof(HAS_MMIO_RES);
+        response.u.mmio_res.data = readServerMMIO(msg.u.mmio_req.offset);
+        return send(clientSocket, &response, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES));
+    }
+    case HAS_WRITE_DATA_REQ_TYPE: {
+        auto address = (static_cast<uint64_t>(msg.u.write_req.address_h) << 32) | msg.u.write_req.address;
+        std::vector<char> data(msg.u.write_req.size);
+        if (!receive(clientSocket, data.data(), data.size())) {
+            protocolError = true;
+            return false;
+        }
+        writeMemory(address, data.data(), data.size());
+        return true;
+    }
+    case HAS_READ_DATA_REQ_TYPE: {
+        auto address = (static_cast<uint64_t>(msg.u.read_req.address_h) << 32) | msg.u.read_req.address;
+        HAS_MSG response = {};
+        response.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+        response.hdr.trans_id = msg.hdr.trans_id;
+        response.hdr.size = sizeof(HAS_READ_DATA_RES);
+        response.u.read_res.address = msg.u.read_req.address;
+        response.u.read_res.address_h = msg.u.read_req.address_h;
+        response.u.read_res.size = msg.u.read_req.size;
+        std::vector<char> data(msg.u.read_req.size);
+        readMemory(address, data.data(), data.size());
+        return send(clientSocket, &response, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES)) &&
+               send(clientSocket, data.data(), data.size());
+    }
+    default:
+        protocolError = true;
+        return false;
+    }
+}
+
+void LocalTbxServer::writeMemory(uint64_t address, const char *data, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    while (size > 0) {
+        auto &page = memoryPages[address / serverPageSize];
+        if (page.empty()) {
+            page.resize(serverPageSize, 0);
+        }
+        auto offsetInPage = static_cast<size_t>(address % serverPageSize);
+        auto sizeThisPage = std::min(size, static_cast<size_t>(serverPageSize) - offsetInPage);
+        memcpy(page.data() + offsetInPage, data, sizeThisPage);
+        address += sizeThisPage;
+        data += sizeThisPage;
+        size -= sizeThisPage;
+    }
+}
+
+void LocalTbxServer::readMemory(uint64_t address, char *data, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    while (size > 0) {
+        auto offsetInPage = static_cast<size_t>(address % serverPageSize);
+        auto sizeThisPage = std::min(size, static_cast<size_t>(serverPageSize) - offsetInPage);
+        auto page = memoryPages.find(address / serverPageSize);
+        if (page != memoryPages.end()) {
+            memcpy(data, page->second.data() + offsetInPage, sizeThisPage);
+        } else {
+            memset(data, 0, sizeThisPage);
+        }
+        address += sizeThisPage;
+        data += sizeThisPage;
+        size -= sizeThisPage;
+    }
+}
+
+void LocalTbxServer::readServerMemory(uint64_t address, void *data, size_t size) {
+    readMemory(address, reinterpret_cast<char *>(data), size);
+}
+
+uint32_t LocalTbxServer::readServerMMIO(uint32_t offset) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = mmio.find(offset);
+    return it != mmio.end() ? it->second : 0;
+}
+
+uint64_t LocalTbxServer::readServerGTT(uint32_t index) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = gtt.find(index);
+    return it != gtt.end() ? it->second : 0;
+}
+} // namespace OCLRT
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace OCLRT {
+
+// Stand-in for TBX server, accepts a single client on loopback interface and emulates
+// memory, GTT and MMIO requests, so TBX protocol can be tested and measured without simulator
+class LocalTbxServer {
+  public:
+    LocalTbxServer();
+    ~LocalTbxServer();
+
+    LocalTbxServer(const LocalTbxServer &) = delete;
+    LocalTbxServer &operator=(const LocalTbxServer &) = delete;
+
+    bool isListening() const { return listenSocket >= 0; }
+    uint16_t getPort() const { return port; }
+
+    // Blocks until client disconnects
+    void waitForClient();
+
+    uint32_t peekMessagesReceived() const { return messagesReceived; }
+    uint32_t peekRecvCalls() const { return recvCalls; }
+    uint32_t peekLastTransId() const { return lastTransId; }
+    bool isProtocolErrorDetected() const { return protocolError; }
+
+    void readServerMemory(uint64_t address, void *data, size_t size);
+    uint32_t readServerMMIO(uint32_t offset);
+    uint64_t readServerGTT(uint32_t index);
+
+  protected:
+    void run();
+    bool serveClient(int clientSocket);
+    bool receive(int clientSocket, void *data, size_t size);
+    bool send(int clientSocket, const void *data, size_t size);
+    void writeMemory(uint64_t address, const char *data, size_t size);
+    void readMemory(uint64_t address, char *data, size_t size);
+
+    int listenSocket = -1;
+    uint16_t port = 0;
+    std::thread worker;
+    std::vector<char> receiveBuffer;
+    size_t receiveOffset = 0;
+
+    std::mutex mtx;
+    std::unordered_map<uint64_t, std::vector<char>> memoryPages;
+    std::map<uint32_t, uint32_t> mmio;
+    std::map<uint32_t, uint64_t> gtt;
+
+    std::atomic<uint32_t> messagesReceived{0};
+    std::atomic<uint32_t> recvCalls{0};
+    std::atomic<uint32_t> lastTransId{0};
+    std::atomic<bool> protocolError{false};
+};
+} // namespace OCLRT
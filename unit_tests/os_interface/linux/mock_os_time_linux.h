@@ -12,6 +12,9 @@
 namespace OCLRT {
 class MockOSTimeLinux : public OSTimeLinux {
   public:
+    using OSTimeLinux::clockCalibration;
+    using OSTimeLinux::clockCalibrationThread;
+
     MockOSTimeLinux(OSInterface *osInterface) : OSTimeLinux(osInterface){};
     void setResolutionFunc(resolutionFunc_t func) {
         this->resolutionFunc = func;
@@ -24,6 +27,9 @@ class MockOSTimeLinux : public OSTimeLinux {
         pDrm = drm;
         timestampTypeDetect();
     }
+    void enableClockCalibration(uint64_t maxAnchorAgeNs) {
+        clockCalibration.reset(new ClockCalibration(timestampSizeInBits, maxAnchorAgeNs));
+    }
     static std::unique_ptr<MockOSTimeLinux> create(OSInterface *osInterface) {
         return std::unique_ptr<MockOSTimeLinux>(new MockOSTimeLinux(osInterface));
     }
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/tbx/tbx_sockets_imp.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/os_interface/linux/local_tbx_server.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace OCLRT;
+
+struct TbxSocketsImpTest : public ::testing::Test {
+    void SetUp() override {
+        ASSERT_TRUE(server.isListening());
+    }
+
+    std::unique_ptr<TbxSocketsImp> connect() {
+        auto sockets = std::make_unique<TbxSocketsImp>(errorStream);
+        EXPECT_TRUE(sockets->init("127.0.0.1", server.getPort()));
+        return sockets;
+    }
+
+    DebugManagerStateRestore stateRestore;
+    std::stringstream errorStream;
+    LocalTbxServer server;
+};
+
+TEST_F(TbxSocketsImpTest, givenBatchingDisabledWhenRequestsAreSentThenServerReceivesEachRequestAndRepliesToReads) {
+    auto sockets = connect();
+
+    std::vector<char> data(3 * 4096 + 10);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i);
+    }
+    EXPECT_TRUE(sockets->writeMemory(0x1000, data.data(), data.size(), 0));
+    EXPECT_TRUE(sockets->writeMMIO(0x2230, 0xABCD));
+    EXPECT_TRUE(sockets->writeGTT(0x10, 0x1234567890ull));
+
+    std::vector<char> dataRead(data.size());
+    EXPECT_TRUE(sockets->readMemory(0x1000, dataRead.data(), dataRead.size()));
+    EXPECT_EQ(data, dataRead);
+
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(sockets->readMMIO(0x2230, &mmioValue));
+    EXPECT_EQ(0xABCDu, mmioValue);
+
+    sockets->close();
+    server.waitForClient();
+    EXPECT_EQ(6u, server.peekMessagesReceived());
+    EXPECT_EQ(0x1234567890ull, server.readServerGTT(0x10 / sizeof(uint64_t)));
+    EXPECT_FALSE(server.isProtocolErrorDetected());
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchingEnabledWhenWritesAreSentThenNothingIsSentUntilResponseIsAwaited) {
+    DebugManager.flags.TbxBatchBufferSize.set(64 * 1024);
+    auto sockets = connect();
+
+    const uint32_t mmioWrites = 100;
+    for (uint32_t i = 0; i < mmioWrites; i++) {
+        EXPECT_TRUE(sockets->writeMMIO(0x2230, i));
+    }
+    EXPECT_EQ(0u, sockets->peekSocketSendCalls());
+
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(sockets->readMMIO(0x2230, &mmioValue));
+    EXPECT_EQ(mmioWrites - 1, mmioValue);
+    EXPECT_EQ(1u, sockets->peekSocketSendCalls());
+
+    sockets->close();
+    server.waitForClient();
+    EXPECT_EQ(1 + mmioWrites + 1, server.peekMessagesReceived());
+    EXPECT_FALSE(server.isProtocolErrorDetected());
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchingEnabledWhenWriteIsLargerThanBatchBufferThenDataIsSentDirectlyInOrder) {
+    DebugManager.flags.TbxBatchBufferSize.set(4096);
+    auto sockets = connect();
+
+    std::vector<char> data(64 * 1024);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    EXPECT_TRUE(sockets->writeMemory(0x100000, data.data(), data.size(), 0));
+
+    std::vector<char> dataRead(data.size());
+    EXPECT_TRUE(sockets->readMemory(0x100000, dataRead.data(), dataRead.size()));
+    EXPECT_EQ(data, dataRead);
+
+    sockets->close();
+    server.waitForClient();
+    EXPECT_FALSE(server.isProtocolErrorDetected());
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchingEnabledWhenSocketIsClosedThenQueuedRequestsAreSent) {
+    DebugManager.flags.TbxBatchBufferSize.set(4096);
+    auto sockets = connect();
+
+    EXPECT_TRUE(sockets->writeMMIO(0x2234, 0x100));
+    EXPECT_EQ(0u, sockets->peekSocketSendCalls());
+
+    sockets->close();
+    server.waitForClient();
+    EXPECT_EQ(0x100u, server.readServerMMIO(0x2234));
+    EXPECT_EQ(2u, server.peekMessagesReceived());
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchingEnabledWhenFlushIsCalledThenQueuedRequestsAreSent) {
+    DebugManager.flags.TbxBatchBufferSize.set(4096);
+    auto sockets = connect();
+
+    EXPECT_TRUE(sockets->writeMMIO(0x2234, 0x100));
+    EXPECT_TRUE(sockets->flush());
+    EXPECT_EQ(1u, sockets->peekSocketSendCalls());
+    EXPECT_TRUE(sockets->flush());
+    EXPECT_EQ(1u, sockets->peekSocketSendCalls());
+    sockets->close();
+}
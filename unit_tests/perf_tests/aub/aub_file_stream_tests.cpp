@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub_mem_dump/aub_mem_dump.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// synthetic working set dumped by every capture test
+const uint64_t workingSetSize = MemoryConstants::gigaByte;
+const size_t sourceBufferSize = static_cast<size_t>(2 * MemoryConstants::megaByte);
+const int32_t asyncWriteBufferSize = static_cast<int32_t>(8 * MemoryConstants::megaByte);
+const int32_t compressionBlockSize = static_cast<int32_t>(MemoryConstants::megaByte);
+const char *aubFileName = "perf_synthetic_working_set.aub";
+
+long long captureWorkingSet(int32_t writeBufferSize, int32_t blockSize, size_t recordSize) {
+    auto sourceBuffer = alignedMalloc(sourceBufferSize, MemoryConstants::pageSize);
+    memset(sourceBuffer, 0xCD, sourceBufferSize);
+
+    auto previousWriteBufferSize = DebugManager.flags.AubDumpAsyncWriteBufferSize.get();
+    DebugManager.flags.AubDumpAsyncWriteBufferSize.set(writeBufferSize);
+    auto previousBlockSize = DebugManager.flags.AubDumpCompressionBlockSize.get();
+    DebugManager.flags.AubDumpCompressionBlockSize.set(blockSize);
+
+    Timer t;
+    t.start();
+    {
+        AubMemDump::AubFileStream stream;
+        stream.open(aubFileName);
+        stream.init(0, 0);
+        for (uint64_t physAddress = 0; physAddress < workingSetSize; physAddress += recordSize) {
+            auto offset = static_cast<size_t>(physAddress % sourceBufferSize);
+            stream.writeMemory(physAddress, ptrOffset(sourceBuffer, offset), recordSize,
+                               AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+        }
+        stream.close();
+    }
+    t.end();
+
+    DebugManager.flags.AubDumpAsyncWriteBufferSize.set(previousWriteBufferSize);
+    DebugManager.flags.AubDumpCompressionBlockSize.set(previousBlockSize);
+    std::remove(aubFileName);
+    alignedFree(sourceBuffer);
+    return t.get();
+}
+
+void checkCaptureTime(const char *testName, int32_t writeBufferSize, int32_t blockSize, size_t recordSize) {
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = captureWorkingSet(writeBufferSize, blockSize, recordSize);
+    }
+    long long time = majorityVote(times[0], times[1], times[2]);
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << workingSetSize / MemoryConstants::megaByte << " MB captured in " << time << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+
+TEST(AubFileStreamPerfTest, givenSynchronousWriterWhenWorkingSetIsDumpedPerPageThenCaptureTimeIsReported) {
+    checkCaptureTime(__FUNCTION__, 0, 0, MemoryConstants::pageSize);
+}
+
+TEST(AubFileStreamPerfTest, givenAsyncWriterWhenWorkingSetIsDumpedPerPageThenCaptureTimeIsReported) {
+    checkCaptureTime(__FUNCTION__, asyncWriteBufferSize, 0, MemoryConstants::pageSize);
+}
+
+TEST(AubFileStreamPerfTest, givenAsyncWriterWhenWorkingSetIsDumpedInCoalescedRecordsThenCaptureTimeIsReported) {
+    auto sizeMemoryWriteHeader = sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite) - sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite::data);
+    auto maxRecordSize = alignDown(AubMemDump::g_dwordCountMax * sizeof(uint32_t) - sizeMemoryWriteHeader, MemoryConstants::pageSize);
+    checkCaptureTime(__FUNCTION__, asyncWriteBufferSize, 0, maxRecordSize);
+}
+
+TEST(AubFileStreamPerfTest, givenCompressedWriterWhenWorkingSetIsDumpedInCoalescedRecordsThenCaptureTimeIsReported) {
+    auto sizeMemoryWriteHeader = sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite) - sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite::data);
+    auto maxRecordSize = alignDown(AubMemDump::g_dwordCountMax * sizeof(uint32_t) - sizeMemoryWriteHeader, MemoryConstants::pageSize);
+    checkCaptureTime(__FUNCTION__, 0, compressionBlockSize, maxRecordSize);
+}
+} // namespace ULT
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/event/async_events_handler.h"
+#include "runtime/event/event.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "unit_tests/perf_tests/fixtures/command_queue_fixture.h"
+#include "unit_tests/perf_tests/fixtures/device_fixture.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+const uint32_t eventsCount = 50000;
+// number of tasks completed by a single tag update
+const uint32_t tasksPerTagUpdate = 64;
+
+struct CallbackRecord {
+    std::chrono::steady_clock::time_point callbackTime;
+    long long handlerCpuTime = 0;
+    std::atomic<uint32_t> *callbacksCalled = nullptr;
+};
+
+long long getThreadCpuTime() {
+    timespec time = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<long long>(time.tv_sec) * 1000000000ll + time.tv_nsec;
+}
+
+void CL_CALLBACK recordCallback(cl_event event, cl_int status, void *data) {
+    auto record = reinterpret_cast<CallbackRecord *>(data);
+    record->callbackTime = std::chrono::steady_clock::now();
+    record->handlerCpuTime = getThreadCpuTime();
+    record->callbacksCalled->fetch_add(1);
+}
+
+struct AsyncEventsHandlerPerfTest : public DeviceFixture,
+                                    public CommandQueueFixture,
+                                    public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        CommandQueueFixture::SetUp(nullptr, pDevice, 0);
+        previousAsyncEventsHandler = DebugManager.flags.EnableAsyncEventsHandler.get();
+        DebugManager.flags.EnableAsyncEventsHandler.set(false);
+    }
+
+    void TearDown() override {
+        DebugManager.flags.EnableAsyncEventsHandler.set(previousAsyncEventsHandler);
+        CommandQueueFixture::TearDown();
+        DeviceFixture::TearDown();
+    }
+
+    // Registers callback-bearing events for tasks that are not yet completed and then advances the tag,
+    // waiting for the handler to report each batch of completions.
+    // Returns average callback latency, accumulates maximal latency and handler thread CPU time.
+    long long runWorkload(long long &maxLatency, long long &handlerCpuTime) {
+        std::atomic<uint32_t> callbacksCalled(0);
+        std::vector<CallbackRecord> records(eventsCount);
+        std::vector<Event *> events(eventsCount);
+        std::vector<std::chrono::steady_clock::time_point> tagUpdateTimes(eventsCount / tasksPerTagUpdate + 1);
+
+        auto baseTaskCount = *pTagMemory;
+        {
+            AsyncEventsHandler handler;
+            for (uint32_t i = 0; i < eventsCount; i++) {
+                records[i].callbacksCalled = &callbacksCalled;
+                events[i] = new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, baseTaskCount + i + 1);
+                events[i]->addCallback(recordCallback, CL_COMPLETE, &records[i]);
+                handler.registerEvent(events[i]);
+            }
+
+            for (uint32_t completed = 0; completed < eventsCount;) {
+                completed = std::min(completed + tasksPerTagUpdate, eventsCount);
+                tagUpdateTimes[(completed - 1) / tasksPerTagUpdate] = std::chrono::steady_clock::now();
+                *pTagMemory = baseTaskCount + completed;
+                while (callbacksCalled.load() < completed) {
+                    std::this_thread::yield();
+                }
+            }
+            handler.closeThread();
+        }
+
+        long long totalLatency = 0;
+        maxLatency = 0;
+        handlerCpuTime = 0;
+        for (uint32_t i = 0; i < eventsCount; i++) {
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(records[i].callbackTime - tagUpdateTimes[i / tasksPerTagUpdate]).count();
+            totalLatency += latency;
+            maxLatency = std::max(maxLatency, static_cast<long long>(latency));
+            handlerCpuTime = std::max(handlerCpuTime, records[i].handlerCpuTime);
+            events[i]->release();
+        }
+        return totalLatency / eventsCount;
+    }
+
+    bool previousAsyncEventsHandler = false;
+};
+
+TEST_F(AsyncEventsHandlerPerfTest, givenManyEventsWithCallbacksWhenTagAdvancesThenCallbackLatencyAndHandlerCpuTimeAreReported) {
+    const char *testName = "AsyncEventsHandlerPerfTest_callbackLatency";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    long long latencies[3] = {0, 0, 0};
+    long long maxLatencies[3] = {0, 0, 0};
+    long long cpuTimes[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        latencies[i] = runWorkload(maxLatencies[i], cpuTimes[i]);
+    }
+    long long latency = majorityVote(latencies[0], latencies[1], latencies[2]);
+    long long maxLatency = majorityVote(maxLatencies[0], maxLatencies[1], maxLatencies[2]);
+    long long cpuTime = majorityVote(cpuTimes[0], cpuTimes[1], cpuTimes[2]);
+    double ratio = static_cast<double>(latency) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << eventsCount << " events, average callback latency " << latency << " ns, max "
+              << maxLatency << " ns, handler thread CPU time " << cpuTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "unit_tests/perf_tests/api/api_tests.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// one user event gates first level of copies spread over queues, every copy gates one copy of second level
+const size_t outOfOrderQueuesCount = 4;
+const size_t outOfOrderLevelWidth = 1000;
+// in-order queues serialize their own copies, so graph is widened with queues
+const size_t inOrderQueuesCount = 64;
+const size_t copySize = 64;
+
+struct UserEventDagPerfTest : public api_tests {
+    void SetUp() override {
+        api_tests::SetUp();
+        srcBuffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, copySize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        dstBuffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, copySize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+    }
+
+    void TearDown() override {
+        clReleaseMemObject(srcBuffer);
+        clReleaseMemObject(dstBuffer);
+        for (auto queue : queues) {
+            clReleaseCommandQueue(queue);
+        }
+        api_tests::TearDown();
+    }
+
+    void createQueues(size_t count, cl_queue_properties queueProperties) {
+        cl_device_id device = pPlatform->getDevice(0);
+        cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, queueProperties, 0};
+        for (size_t i = 0; i < count; i++) {
+            queues.push_back(clCreateCommandQueueWithProperties(pContext, device, properties, &retVal));
+            ASSERT_EQ(CL_SUCCESS, retVal);
+        }
+    }
+
+    long long unblockGraph(size_t firstLevelWidth, bool aggregateSubmission) {
+        auto previousAggregateSubmission = DebugManager.flags.AggregateUnblockedCommandsSubmission.get();
+        DebugManager.flags.AggregateUnblockedCommandsSubmission.set(aggregateSubmission);
+
+        auto userEvent = clCreateUserEvent(pContext, &retVal);
+        std::vector<cl_event> firstLevel(firstLevelWidth);
+        std::vector<cl_event> secondLevel(firstLevelWidth);
+        for (size_t i = 0; i < firstLevelWidth; i++) {
+            retVal = clEnqueueCopyBuffer(queues[i % queues.size()], srcBuffer, dstBuffer, 0, 0, copySize, 1, &userEvent, &firstLevel[i]);
+            EXPECT_EQ(CL_SUCCESS, retVal);
+        }
+        for (size_t i = 0; i < firstLevelWidth; i++) {
+            retVal = clEnqueueCopyBuffer(queues[(i + 1) % queues.size()], dstBuffer, srcBuffer, 0, 0, copySize, 1, &firstLevel[i], &secondLevel[i]);
+            EXPECT_EQ(CL_SUCCESS, retVal);
+        }
+
+        Timer t;
+        t.start();
+        clSetUserEventStatus(userEvent, CL_COMPLETE);
+        clWaitForEvents(static_cast<cl_uint>(secondLevel.size()), secondLevel.data());
+        t.end();
+
+        for (size_t i = 0; i < firstLevelWidth; i++) {
+            clReleaseEvent(firstLevel[i]);
+            clReleaseEvent(secondLevel[i]);
+        }
+        clReleaseEvent(userEvent);
+        DebugManager.flags.AggregateUnblockedCommandsSubmission.set(previousAggregateSubmission);
+        return t.get();
+    }
+
+    void checkUnblockTime(const char *testName, size_t firstLevelWidth, bool aggregateSubmission) {
+        const double multiplier = 1.5000;
+        double previousRatio = -1.0;
+        uint64_t hash = Hash::hash(testName, strlen(testName));
+        bool success = getTestRatio(hash, previousRatio);
+
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            times[i] = unblockGraph(firstLevelWidth, aggregateSubmission);
+        }
+        long long time = majorityVote(times[0], times[1], times[2]);
+        double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+        std::cout << testName << ": " << 2 * firstLevelWidth << " blocked copies on " << queues.size() << " queues unblocked in " << time << " ns" << std::endl;
+
+        if (success) {
+            EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+        }
+        updateTestRatio(hash, ratio);
+    }
+
+    std::vector<cl_command_queue> queues;
+    cl_mem srcBuffer = nullptr;
+    cl_mem dstBuffer = nullptr;
+};
+
+TEST_F(UserEventDagPerfTest, givenWideGraphOnOutOfOrderQueuesWhenUserEventIsCompletedThenUnblockTimeIsReported) {
+    createQueues(outOfOrderQueuesCount, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    checkUnblockTime(__FUNCTION__, outOfOrderLevelWidth, false);
+}
+
+TEST_F(UserEventDagPerfTest, givenGraphOnInOrderQueuesWhenUserEventIsCompletedThenUnblockTimeIsReported) {
+    createQueues(inOrderQueuesCount, 0);
+    checkUnblockTime(__FUNCTION__, inOrderQueuesCount, false);
+}
+
+TEST_F(UserEventDagPerfTest, givenGraphOnInOrderQueuesWhenUserEventIsCompletedWithAggregatedSubmissionThenUnblockTimeIsReported) {
+    createQueues(inOrderQueuesCount, 0);
+    checkUnblockTime(__FUNCTION__, inOrderQueuesCount, true);
+}
+} // namespace ULT
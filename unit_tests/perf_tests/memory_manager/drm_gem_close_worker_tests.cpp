@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/os_interface/linux/drm_gem_close_worker.h"
+#include "runtime/os_interface/linux/drm_memory_manager.h"
+#include "runtime/os_interface/linux/drm_null_device.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+namespace {
+const uint32_t allocationsCount = 100000;
+
+// every ioctl succeeds immediately, only CPU cost of closing objects is measured
+class PerfDrmNullDevice : public DrmNullDevice {
+  public:
+    PerfDrmNullDevice() : DrmNullDevice(-1) {}
+};
+
+// Returns time of releasing all allocations, including closing of their buffer objects by worker
+long long releaseAllocations(gemCloseWorkerMode mode) {
+    PerfDrmNullDevice drm;
+    ExecutionEnvironment executionEnvironment;
+    auto memoryManager = new DrmMemoryManager(&drm, mode, false, false, executionEnvironment);
+    executionEnvironment.memoryManager.reset(memoryManager);
+
+    std::vector<GraphicsAllocation *> allocations;
+    allocations.reserve(allocationsCount);
+    for (uint32_t i = 0; i < allocationsCount; i++) {
+        allocations.push_back(memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize));
+    }
+
+    Timer t;
+    t.start();
+    for (auto allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+    auto worker = memoryManager->peekGemCloseWorker();
+    while (worker && !worker->isEmpty()) {
+        std::this_thread::yield();
+    }
+    t.end();
+    return t.get();
+}
+
+long long measure(gemCloseWorkerMode mode) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = releaseAllocations(mode);
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+} // namespace
+
+TEST(DrmGemCloseWorkerPerfTest, givenManyAllocationsWhenTheyAreReleasedThenTeardownTimesAreReported) {
+    const char *testName = "DrmGemCloseWorkerPerfTest_teardownOfManyAllocations";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    auto inPlaceTime = measure(gemCloseWorkerMode::gemCloseWorkerInactive);
+    auto workerTime = measure(gemCloseWorkerMode::gemCloseWorkerActive);
+    double ratio = static_cast<double>(workerTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << allocationsCount << " allocations, closed in place " << inPlaceTime
+              << " ns, closed by worker " << workerTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
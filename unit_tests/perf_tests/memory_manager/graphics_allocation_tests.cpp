@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+namespace {
+const uint32_t allocationsCount = 4096;
+const uint32_t submissionsCount = 64;
+
+// Each context makes every allocation resident for a number of submissions, then evicts it,
+// same sequence of accesses as command stream receivers perform in makeResident and makeNonResident
+long long runSubmissions(uint32_t osContextsCount) {
+    std::vector<std::unique_ptr<GraphicsAllocation>> allocations;
+    for (uint32_t i = 0; i < allocationsCount; i++) {
+        allocations.emplace_back(new GraphicsAllocation(nullptr, 0llu, 0llu, MemoryConstants::pageSize));
+    }
+
+    Timer t;
+    t.start();
+    for (uint32_t submission = 1; submission <= submissionsCount; submission++) {
+        for (uint32_t contextId = 0; contextId < osContextsCount; contextId++) {
+            for (auto &allocation : allocations) {
+                if (allocation->getResidencyTaskCount(contextId) < static_cast<int>(submission)) {
+                    allocation->updateTaskCount(submission, contextId);
+                }
+                allocation->updateResidencyTaskCount(static_cast<int>(submission), contextId);
+            }
+        }
+    }
+    for (uint32_t contextId = 0; contextId < osContextsCount; contextId++) {
+        for (auto &allocation : allocations) {
+            EXPECT_TRUE(allocation->isResident(contextId));
+            allocation->updateResidencyTaskCount(ObjectNotResident, contextId);
+            allocation->updateTaskCount(ObjectNotUsed, contextId);
+        }
+    }
+    t.end();
+
+    for (auto &allocation : allocations) {
+        EXPECT_FALSE(allocation->peekWasUsed());
+    }
+    return t.get();
+}
+
+long long measure(uint32_t osContextsCount) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = runSubmissions(osContextsCount);
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+} // namespace
+
+TEST(GraphicsAllocationPerfTest, givenManyOsContextsWhenAllocationsAreMadeResidentInEachOfThemThenTimesAreReported) {
+    const char *testName = "GraphicsAllocationPerfTest_manyOsContextsResidency";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    auto singleContextTime = measure(1u);
+    auto manyContextsTime = measure(32u);
+    double ratio = static_cast<double>(manyContextsTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << allocationsCount << " allocations, " << submissionsCount << " submissions, 1 context "
+              << singleContextTime << " ns, 32 contexts " << manyContextsTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
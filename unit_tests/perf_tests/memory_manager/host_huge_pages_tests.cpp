@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/os_interface/linux/drm_memory_manager.h"
+#include "runtime/os_interface/linux/drm_null_device.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+namespace {
+const size_t bufferSize = static_cast<size_t>(256 * MemoryConstants::megaByte);
+const uint32_t traversalsCount = 8;
+
+class PerfDrmNullDevice : public DrmNullDevice {
+  public:
+    PerfDrmNullDevice() : DrmNullDevice(-1) {}
+};
+
+struct HostHugePagesTimes {
+    long long mapTime = 0;
+    long long traversalTime = 0;
+};
+
+// Map time covers allocation and first touch of every page, traversal reads one value of every page in random order
+HostHugePagesTimes traverseBuffer(int32_t hostHugePagesMode) {
+    PerfDrmNullDevice drm;
+    ExecutionEnvironment executionEnvironment;
+    auto previousMode = DebugManager.flags.EnableHostHugePages.get();
+    DebugManager.flags.EnableHostHugePages.set(hostHugePagesMode);
+    auto memoryManager = new DrmMemoryManager(&drm, gemCloseWorkerMode::gemCloseWorkerInactive, false, false, executionEnvironment);
+    executionEnvironment.memoryManager.reset(memoryManager);
+    DebugManager.flags.EnableHostHugePages.set(previousMode);
+
+    auto pagesCount = bufferSize / MemoryConstants::pageSize;
+    std::vector<uint32_t> pages(pagesCount);
+    std::iota(pages.begin(), pages.end(), 0u);
+    std::shuffle(pages.begin(), pages.end(), std::mt19937(0));
+
+    HostHugePagesTimes times;
+    Timer t;
+    t.start();
+    auto allocation = memoryManager->allocateGraphicsMemory(bufferSize);
+    auto buffer = static_cast<uint64_t *>(allocation->getUnderlyingBuffer());
+    for (size_t page = 0; page < pagesCount; page++) {
+        buffer[page * MemoryConstants::pageSize / sizeof(uint64_t)] = page;
+    }
+    t.end();
+    times.mapTime = t.get();
+
+    uint64_t sum = 0;
+    t.start();
+    for (uint32_t i = 0; i < traversalsCount; i++) {
+        for (auto page : pages) {
+            sum += buffer[page * MemoryConstants::pageSize / sizeof(uint64_t)];
+        }
+    }
+    t.end();
+    times.traversalTime = t.get();
+    EXPECT_EQ(traversalsCount * (pagesCount * (pagesCount - 1) / 2), sum);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    return times;
+}
+
+HostHugePagesTimes measure(int32_t hostHugePagesMode) {
+    long long mapTimes[3] = {0, 0, 0};
+    long long traversalTimes[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        auto times = traverseBuffer(hostHugePagesMode);
+        mapTimes[i] = times.mapTime;
+        traversalTimes[i] = times.traversalTime;
+    }
+    HostHugePagesTimes times;
+    times.mapTime = majorityVote(mapTimes[0], mapTimes[1], mapTimes[2]);
+    times.traversalTime = majorityVote(traversalTimes[0], traversalTimes[1], traversalTimes[2]);
+    return times;
+}
+} // namespace
+
+TEST(HostHugePagesPerfTest, givenLargeBufferWhenItIsMappedAndTraversedThenTimesWithAndWithoutHugePagesAreReported) {
+    const char *testName = "HostHugePagesPerfTest_largeBufferTraversal";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    auto smallPagesTimes = measure(0);
+    auto hugePagesTimes = measure(1);
+    double ratio = static_cast<double>(hugePagesTimes.traversalTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << bufferSize / MemoryConstants::megaByte << " MB buffer, 4KB pages: map "
+              << smallPagesTimes.mapTime << " ns, traversal " << smallPagesTimes.traversalTime << " ns, huge pages: map "
+              << hugePagesTimes.mapTime << " ns, traversal " << hugePagesTimes.traversalTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
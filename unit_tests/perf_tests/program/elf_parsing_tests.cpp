@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "elf/reader.h"
+#include "elf/writer.h"
+#include "patch_list.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/program/program.h"
+#include "unit_tests/perf_tests/fixtures/device_fixture.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace OCLRT;
+using namespace iOpenCL;
+
+namespace ULT {
+
+namespace {
+const uint32_t fatBinaryTargetsCount = 8;
+const size_t fatBinaryTargetSize = static_cast<size_t>(100 * MemoryConstants::megaByte / fatBinaryTargetsCount);
+
+// multi-target ELF of about 100 MB, one device binary section per target
+CLElfLib::ElfBinaryStorage createFatElfBinary(const HardwareInfo &hwInfo) {
+    CLElfLib::CElfWriter elfWriter(CLElfLib::E_EH_TYPE::EH_TYPE_OPENCL_EXECUTABLE, CLElfLib::E_EH_MACHINE::EH_MACHINE_NONE, 0);
+    for (uint32_t i = 0; i < fatBinaryTargetsCount; i++) {
+        std::string genBinary(fatBinaryTargetSize, static_cast<char>(i));
+        SProgramBinaryHeader genBinaryHeader = {0};
+        genBinaryHeader.Magic = MAGIC_CL;
+        genBinaryHeader.Version = CURRENT_ICBE_VERSION;
+        genBinaryHeader.Device = hwInfo.pPlatform->eRenderCoreFamily;
+        genBinaryHeader.GPUPointerSizeInBytes = 8;
+        memcpy(&genBinary[0], &genBinaryHeader, sizeof(genBinaryHeader));
+
+        auto sectionName = std::string(CLElfLib::devBinarySectionNamePrefix) + "target_" + std::to_string(i);
+        elfWriter.addSection(CLElfLib::SSectionNode(CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, CLElfLib::E_SH_FLAG::SH_FLAG_NONE,
+                                                    sectionName, std::move(genBinary), static_cast<uint32_t>(fatBinaryTargetSize)));
+    }
+    CLElfLib::ElfBinaryStorage elfBinary(elfWriter.getTotalBinarySize());
+    elfWriter.resolveBinary(elfBinary);
+    return elfBinary;
+}
+} // namespace
+
+struct ElfParsingPerfTest : public DeviceFixture,
+                            public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        elfBinary = createFatElfBinary(pDevice->getHardwareInfo());
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    template <typename ParseFunc>
+    long long measure(ParseFunc parse) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            parse();
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    CLElfLib::ElfBinaryStorage elfBinary;
+};
+
+TEST_F(ElfParsingPerfTest, givenFatBinaryWhenParsedThenCopyingAndInPlaceParsingTimesAreReported) {
+    const char *testName = "ElfParsingPerfTest_fatBinary";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    auto copyingParseTime = measure([this]() {
+        CLElfLib::CElfReader elfReader(elfBinary);
+        EXPECT_EQ(fatBinaryTargetsCount + 2u, elfReader.getSectionHeaders().size());
+    });
+
+    auto inPlaceParseTime = measure([this]() {
+        CLElfLib::CElfReaderView elfReader(elfBinary.data(), elfBinary.size());
+        EXPECT_EQ(fatBinaryTargetsCount + 2u, elfReader.getNumSections());
+    });
+
+    auto programLoadTime = measure([this]() {
+        Program program(*pDevice->getExecutionEnvironment(), nullptr, false);
+        program.setDevice(pDevice);
+        uint32_t binaryVersion = 0;
+        EXPECT_EQ(CL_SUCCESS, program.processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion));
+        size_t genBinarySize = 0;
+        EXPECT_NE(nullptr, program.getGenBinary(genBinarySize));
+        EXPECT_EQ(fatBinaryTargetSize, genBinarySize);
+    });
+    double ratio = static_cast<double>(programLoadTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << elfBinary.size() << " bytes, copying parse " << copyingParseTime
+              << " ns, in place parse " << inPlaceParseTime << " ns, program load " << programLoadTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "patch_list.h"
+#include "runtime/context/context.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/platform/platform.h"
+#include "runtime/program/create.inl"
+#include "runtime/program/program.h"
+#include "unit_tests/perf_tests/fixtures/device_fixture.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace OCLRT;
+using namespace iOpenCL;
+
+namespace ULT {
+
+namespace {
+const uint32_t buildKernelsCount = 500;
+const uint32_t buildKernelIsaSize = 4096;
+const uint32_t buildKernelNameSize = 12;
+const uint32_t workSizeTokensCount = 9;
+
+struct KernelPatchList {
+    SPatchExecutionEnvironment executionEnvironment;
+    SPatchDataParameterStream dataParameterStream;
+    SPatchDataParameterBuffer workSizes[workSizeTokensCount];
+};
+
+// gen binary with buildKernelsCount kernels, each carrying ISA and patch tokens describing its work sizes
+std::vector<char> createGenBinaryWithPatchTokens(const HardwareInfo &hwInfo) {
+    size_t kernelBlobSize = sizeof(SKernelBinaryHeaderCommon) + buildKernelNameSize + buildKernelIsaSize + sizeof(KernelPatchList);
+    std::vector<char> binary(sizeof(SProgramBinaryHeader) + buildKernelsCount * kernelBlobSize, 0);
+
+    auto programHeader = reinterpret_cast<SProgramBinaryHeader *>(binary.data());
+    programHeader->Magic = MAGIC_CL;
+    programHeader->Version = CURRENT_ICBE_VERSION;
+    programHeader->Device = hwInfo.pPlatform->eRenderCoreFamily;
+    programHeader->GPUPointerSizeInBytes = 8;
+    programHeader->NumberOfKernels = buildKernelsCount;
+
+    const uint32_t workSizeTypes[] = {DATA_PARAMETER_LOCAL_WORK_SIZE, DATA_PARAMETER_GLOBAL_WORK_SIZE, DATA_PARAMETER_NUM_WORK_GROUPS};
+
+    auto kernelBlob = ptrOffset(binary.data(), sizeof(SProgramBinaryHeader));
+    for (uint32_t i = 0; i < buildKernelsCount; i++) {
+        auto kernelHeader = reinterpret_cast<SKernelBinaryHeaderCommon *>(kernelBlob);
+        kernelHeader->KernelNameSize = buildKernelNameSize;
+        kernelHeader->KernelHeapSize = buildKernelIsaSize;
+        kernelHeader->PatchListSize = sizeof(KernelPatchList);
+
+        auto kernelName = ptrOffset(kernelBlob, sizeof(SKernelBinaryHeaderCommon));
+        snprintf(kernelName, buildKernelNameSize, "kernel_%04u", i);
+        memset(ptrOffset(kernelName, buildKernelNameSize), static_cast<int>(i), buildKernelIsaSize);
+
+        auto patchList = reinterpret_cast<KernelPatchList *>(ptrOffset(kernelName, buildKernelNameSize + buildKernelIsaSize));
+        patchList->executionEnvironment.Token = PATCH_TOKEN_EXECUTION_ENVIRONMENT;
+        patchList->executionEnvironment.Size = sizeof(SPatchExecutionEnvironment);
+        patchList->executionEnvironment.CompiledSIMD16 = 1;
+        patchList->executionEnvironment.LargestCompiledSIMDSize = 16;
+        patchList->dataParameterStream.Token = PATCH_TOKEN_DATA_PARAMETER_STREAM;
+        patchList->dataParameterStream.Size = sizeof(SPatchDataParameterStream);
+        patchList->dataParameterStream.DataParameterStreamSize = workSizeTokensCount * sizeof(uint32_t);
+        for (uint32_t token = 0; token < workSizeTokensCount; token++) {
+            auto &workSize = patchList->workSizes[token];
+            workSize.Token = PATCH_TOKEN_DATA_PARAMETER_BUFFER;
+            workSize.Size = sizeof(SPatchDataParameterBuffer);
+            workSize.Type = workSizeTypes[token / 3];
+            workSize.Offset = token * sizeof(uint32_t);
+            workSize.DataSize = sizeof(uint32_t);
+            workSize.SourceOffset = (token % 3) * sizeof(uint32_t);
+        }
+
+        kernelHeader->CheckSum = static_cast<uint32_t>(Hash::hash(kernelName, kernelBlobSize - sizeof(SKernelBinaryHeaderCommon)) & 0xFFFFFFFF);
+        kernelBlob = ptrOffset(kernelBlob, kernelBlobSize);
+    }
+    return binary;
+}
+} // namespace
+
+struct ProgramBuildPerfTest : public DeviceFixture,
+                              public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        // parsing workers are owned by the platform
+        constructPlatform();
+        cl_device_id clDevice = pDevice;
+        cl_int retVal = CL_SUCCESS;
+        pContext = Context::create<Context>(nullptr, DeviceVector(&clDevice, 1), nullptr, nullptr, retVal);
+        ASSERT_NE(nullptr, pContext);
+        binary = createGenBinaryWithPatchTokens(pDevice->getHardwareInfo());
+
+        previousLazyThreshold = DebugManager.flags.LazyKernelMaterializationThreshold.get();
+        previousParallelThreshold = DebugManager.flags.ParallelKernelParsingThreshold.get();
+        // every kernel is parsed and uploaded during build
+        DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    }
+
+    void TearDown() override {
+        DebugManager.flags.LazyKernelMaterializationThreshold.set(previousLazyThreshold);
+        DebugManager.flags.ParallelKernelParsingThreshold.set(previousParallelThreshold);
+        delete pContext;
+        DeviceFixture::TearDown();
+    }
+
+    // Returns wall time of clBuildProgram equivalent for a program created from binary
+    long long buildProgram() {
+        cl_int retVal = CL_SUCCESS;
+        cl_device_id device = pDevice;
+        auto program = Program::createFromGenBinary<Program>(*pDevice->getExecutionEnvironment(), pContext, binary.data(), binary.size(), false, &retVal);
+        Timer t;
+        t.start();
+        retVal = program->build(1, &device, nullptr, nullptr, nullptr, false);
+        t.end();
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(buildKernelsCount, program->getNumKernels());
+        EXPECT_TRUE(program->getKernelInfo(size_t(0))->isValid);
+        delete program;
+        return t.get();
+    }
+
+    long long measure() {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            times[i] = buildProgram();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    Context *pContext = nullptr;
+    std::vector<char> binary;
+    int32_t previousLazyThreshold = -1;
+    int32_t previousParallelThreshold = -1;
+};
+
+TEST_F(ProgramBuildPerfTest, givenProgramWithManyKernelsWhenBuiltThenSerialAndParallelBuildTimesAreReported) {
+    const char *testName = "ProgramBuildPerfTest_parallelKernelParsing";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    DebugManager.flags.ParallelKernelParsingThreshold.set(-1);
+    auto serialBuildTime = measure();
+
+    DebugManager.flags.ParallelKernelParsingThreshold.set(2);
+    auto parallelBuildTime = measure();
+    double ratio = static_cast<double>(parallelBuildTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << buildKernelsCount << " kernels, serial build " << serialBuildTime
+              << " ns, parallel build " << parallelBuildTime << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
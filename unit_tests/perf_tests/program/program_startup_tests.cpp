@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "patch_list.h"
+#include "runtime/context/context.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/program/create.inl"
+#include "runtime/program/program.h"
+#include "unit_tests/perf_tests/fixtures/device_fixture.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <vector>
+
+using namespace OCLRT;
+using namespace iOpenCL;
+
+namespace ULT {
+
+const uint32_t kernelsCount = 2000;
+const uint32_t kernelIsaSize = 1024;
+const uint32_t kernelNameSize = 12;
+
+// gen binary with kernelsCount kernels carrying ISA only, so the time measured is dominated by ISA allocations
+std::vector<char> createGenBinary(const HardwareInfo &hwInfo) {
+    size_t kernelBlobSize = sizeof(SKernelBinaryHeaderCommon) + kernelNameSize + kernelIsaSize;
+    std::vector<char> binary(sizeof(SProgramBinaryHeader) + kernelsCount * kernelBlobSize, 0);
+
+    auto programHeader = reinterpret_cast<SProgramBinaryHeader *>(binary.data());
+    programHeader->Magic = MAGIC_CL;
+    programHeader->Version = CURRENT_ICBE_VERSION;
+    programHeader->Device = hwInfo.pPlatform->eRenderCoreFamily;
+    programHeader->GPUPointerSizeInBytes = 8;
+    programHeader->NumberOfKernels = kernelsCount;
+
+    auto kernelBlob = ptrOffset(binary.data(), sizeof(SProgramBinaryHeader));
+    for (uint32_t i = 0; i < kernelsCount; i++) {
+        auto kernelHeader = reinterpret_cast<SKernelBinaryHeaderCommon *>(kernelBlob);
+        kernelHeader->KernelNameSize = kernelNameSize;
+        kernelHeader->KernelHeapSize = kernelIsaSize;
+
+        auto kernelName = ptrOffset(kernelBlob, sizeof(SKernelBinaryHeaderCommon));
+        snprintf(kernelName, kernelNameSize, "kernel_%04u", i);
+        memset(ptrOffset(kernelName, kernelNameSize), static_cast<int>(i), kernelIsaSize);
+
+        kernelHeader->CheckSum = static_cast<uint32_t>(Hash::hash(kernelName, kernelNameSize + kernelIsaSize) & 0xFFFFFFFF);
+        kernelBlob = ptrOffset(kernelBlob, kernelBlobSize);
+    }
+    return binary;
+}
+
+struct ProgramStartupPerfTest : public DeviceFixture,
+                                public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        cl_device_id clDevice = pDevice;
+        cl_int retVal = CL_SUCCESS;
+        pContext = Context::create<Context>(nullptr, DeviceVector(&clDevice, 1), nullptr, nullptr, retVal);
+        ASSERT_NE(nullptr, pContext);
+        binary = createGenBinary(pDevice->getHardwareInfo());
+
+        previousLazyThreshold = DebugManager.flags.LazyKernelMaterializationThreshold.get();
+        previousIsaPool = DebugManager.flags.EnableKernelIsaPool.get();
+        // measure full startup cost, every kernel gets its ISA uploaded while the binary is processed
+        DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    }
+
+    void TearDown() override {
+        DebugManager.flags.LazyKernelMaterializationThreshold.set(previousLazyThreshold);
+        DebugManager.flags.EnableKernelIsaPool.set(previousIsaPool);
+        delete pContext;
+        DeviceFixture::TearDown();
+    }
+
+    // Returns time of creating the program and processing its binary, reports number of distinct ISA allocations
+    long long createProgram(size_t &isaAllocationsCount) {
+        cl_int retVal = CL_SUCCESS;
+        Timer t;
+        t.start();
+        auto program = Program::createFromGenBinary<Program>(*pDevice->getExecutionEnvironment(), pContext, binary.data(), binary.size(), false, &retVal);
+        retVal = program->processGenBinary();
+        t.end();
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(kernelsCount, program->getNumKernels());
+
+        std::set<GraphicsAllocation *> isaAllocations;
+        for (size_t i = 0; i < program->getNumKernels(); i++) {
+            isaAllocations.insert(program->getKernelInfo(i)->getGraphicsAllocation());
+        }
+        isaAllocationsCount = isaAllocations.size();
+        delete program;
+        return t.get();
+    }
+
+    long long measure(size_t &isaAllocationsCount) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            times[i] = createProgram(isaAllocationsCount);
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    Context *pContext = nullptr;
+    std::vector<char> binary;
+    int32_t previousLazyThreshold = -1;
+    bool previousIsaPool = true;
+};
+
+TEST_F(ProgramStartupPerfTest, givenProgramWithManyKernelsWhenBinaryIsProcessedThenStartupTimeAndIsaAllocationsCountAreReported) {
+    const char *testName = "ProgramStartupPerfTest_kernelIsaPool";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    size_t separateAllocationsCount = 0;
+    DebugManager.flags.EnableKernelIsaPool.set(false);
+    auto separateAllocationsTime = measure(separateAllocationsCount);
+
+    size_t pooledAllocationsCount = 0;
+    DebugManager.flags.EnableKernelIsaPool.set(true);
+    auto pooledAllocationsTime = measure(pooledAllocationsCount);
+    double ratio = static_cast<double>(pooledAllocationsTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << kernelsCount << " kernels, allocation per kernel " << separateAllocationsTime << " ns with "
+              << separateAllocationsCount << " ISA allocations, ISA pool " << pooledAllocationsTime << " ns with "
+              << pooledAllocationsCount << " ISA allocations" << std::endl;
+
+    EXPECT_EQ(kernelsCount, separateAllocationsCount);
+    EXPECT_EQ(1u, pooledAllocationsCount);
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
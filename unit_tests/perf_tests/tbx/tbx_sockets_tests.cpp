@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/tbx/tbx_sockets_imp.h"
+#include "unit_tests/os_interface/linux/local_tbx_server.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+// typical flush of TBX CSR: page table entries, pages of resident allocations and MMIO programming
+const uint32_t pagesWritten = 16 * 1024;
+const uint32_t mmioWritesPerPage = 2;
+const int32_t batchBufferSize = static_cast<int32_t>(MemoryConstants::megaByte);
+
+long long sendWorkload(int32_t bufferSize) {
+    auto previousBufferSize = DebugManager.flags.TbxBatchBufferSize.get();
+    DebugManager.flags.TbxBatchBufferSize.set(bufferSize);
+
+    std::vector<char> page(MemoryConstants::pageSize, 0x5A);
+    uint64_t pteEntry = 0x7;
+    uint32_t status = 0;
+    std::stringstream errorStream;
+
+    LocalTbxServer server;
+    EXPECT_TRUE(server.isListening());
+
+    Timer t;
+    t.start();
+    {
+        TbxSocketsImp sockets(errorStream);
+        sockets.init("127.0.0.1", server.getPort());
+        for (uint32_t i = 0; i < pagesWritten; i++) {
+            uint64_t physAddress = static_cast<uint64_t>(i) * MemoryConstants::pageSize;
+            sockets.writeMemory(physAddress + 0x100000000ull, &pteEntry, sizeof(pteEntry), 0);
+            sockets.writeMemory(physAddress, page.data(), page.size(), 0);
+            for (uint32_t j = 0; j < mmioWritesPerPage; j++) {
+                sockets.writeMMIO(0x2230, i);
+            }
+        }
+        sockets.readMMIO(0x2234, &status);
+        sockets.close();
+    }
+    server.waitForClient();
+    t.end();
+
+    EXPECT_FALSE(server.isProtocolErrorDetected());
+    DebugManager.flags.TbxBatchBufferSize.set(previousBufferSize);
+    return t.get();
+}
+
+void checkSendTime(const char *testName, int32_t bufferSize) {
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = sendWorkload(bufferSize);
+    }
+    long long time = majorityVote(times[0], times[1], times[2]);
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << pagesWritten << " pages sent to local TBX server in " << time << " ns" << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+
+TEST(TbxSocketsPerfTest, givenBatchingDisabledWhenWorkloadIsSentToLocalServerThenSendTimeIsReported) {
+    checkSendTime(__FUNCTION__, 0);
+}
+
+TEST(TbxSocketsPerfTest, givenBatchingEnabledWhenWorkloadIsSentToLocalServerThenSendTimeIsReported) {
+    checkSendTime(__FUNCTION__, batchBufferSize);
+}
+} // namespace ULT
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/utilities/heap_allocator.h"
+#include "runtime/utilities/segregated_heap_allocator.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+namespace {
+const uint64_t heapBase = 0x100000000llu;
+const uint64_t heapSize = 4 * MemoryConstants::gigaByte - MemoryConstants::pageSize;
+const uint32_t liveAllocationsCount = 4096;
+const uint32_t operationsCount = 200000;
+
+struct HeapOperation {
+    uint32_t slot;
+    size_t size;
+};
+
+// Churn resembling kernel ISA and constant surface allocations: mostly small sizes, some big ones,
+// each operation frees allocation held in random slot and allocates a new one in its place
+std::vector<HeapOperation> createOperations() {
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<uint32_t> slots(0, liveAllocationsCount - 1);
+    std::uniform_int_distribution<size_t> smallSizes(1, 64 * MemoryConstants::kiloByte);
+    std::uniform_int_distribution<size_t> bigSizes(4 * MemoryConstants::megaByte + 1, 16 * MemoryConstants::megaByte);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+
+    std::vector<HeapOperation> operations(operationsCount);
+    for (auto &operation : operations) {
+        operation.slot = slots(generator);
+        operation.size = percent(generator) < 2 ? bigSizes(generator) : smallSizes(generator);
+    }
+    return operations;
+}
+
+struct HeapAllocation {
+    uint64_t ptr = 0;
+    size_t size = 0;
+};
+
+// inspect is called with the allocator after the churn, before remaining allocations are freed
+template <typename AllocatorT, typename InspectT>
+long long runOperations(const std::vector<HeapOperation> &operations, InspectT inspect) {
+    AllocatorT allocator(heapBase, heapSize);
+    std::vector<HeapAllocation> allocations(liveAllocationsCount);
+
+    Timer t;
+    t.start();
+    for (const auto &operation : operations) {
+        auto &allocation = allocations[operation.slot];
+        allocator.free(allocation.ptr, allocation.size);
+        allocation.size = operation.size;
+        allocation.ptr = allocator.allocate(allocation.size);
+    }
+    t.end();
+
+    inspect(allocator);
+    for (auto &allocation : allocations) {
+        allocator.free(allocation.ptr, allocation.size);
+    }
+    return t.get();
+}
+} // namespace
+
+TEST(HeapAllocatorPerfTest, givenAllocationChurnWhenExecutedOnBothHeapAllocatorsThenTimesAreReported) {
+    const char *testName = "HeapAllocatorPerfTest_segregatedFitChurn";
+    setReferenceTime();
+
+    const double multiplier = 1.5000;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+    bool success = getTestRatio(hash, previousRatio);
+
+    auto operations = createOperations();
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = runOperations<HeapAllocator>(operations, [](HeapAllocator &allocator) {});
+    }
+    auto freeChunkListsTime = majorityVote(times[0], times[1], times[2]);
+
+    HeapFragmentationStats stats;
+    for (int i = 0; i < 3; i++) {
+        times[i] = runOperations<SegregatedHeapAllocator>(operations, [&stats](SegregatedHeapAllocator &allocator) {
+            stats = allocator.getFragmentationStats();
+        });
+    }
+    auto segregatedFitTime = majorityVote(times[0], times[1], times[2]);
+    double ratio = static_cast<double>(segregatedFitTime) / static_cast<double>(refTime);
+
+    std::cout << testName << ": " << operationsCount << " operations, free chunk lists " << freeChunkListsTime
+              << " ns, segregated fit " << segregatedFitTime << " ns, "
+              << stats.freeBlocksCount << " free blocks, fragmentation " << stats.getFragmentation() << std::endl;
+
+    if (success) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
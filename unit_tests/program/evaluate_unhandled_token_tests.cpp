@@ -9,6 +9,7 @@
 #include "runtime/execution_environment/execution_environment.h"
 #include "runtime/program/create.inl"
 #include "runtime/program/program.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 
 using namespace OCLRT;
 
@@ -21,6 +22,8 @@ inline void PushBackToken(ContainerT &container, const TokenT &token) {
 }
 
 struct MockProgramRecordUnhandledTokens : public Program {
+    using Program::kernelInfoArray;
+
     bool allowUnhandledTokens;
     mutable int lastUnhandledTokenFound;
 
@@ -158,3 +161,50 @@ TEST(EvaluateUnhandledToken, WhenDecodingKernelBinaryIfUnhandledTokenIsFoundAndI
     EXPECT_EQ(CL_INVALID_KERNEL, retVal);
     EXPECT_EQ(unhandledTokenId, lastUnhandledTokenFound);
 }
+
+TEST(EvaluateUnhandledToken, GivenLazyKernelMaterializationWhenKernelBinaryWithUnhandledTokenIsQueriedThenErrorIsReturnedAndParsedStateIsDropped) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(1);
+
+    auto binary = CreateBinary(false, true, unhandledTokenId);
+    iOpenCL::SPatchExecutionEnvironment executionEnvironment = {};
+    executionEnvironment.Token = iOpenCL::PATCH_TOKEN_EXECUTION_ENVIRONMENT;
+    executionEnvironment.Size = static_cast<uint32_t>(sizeof(iOpenCL::SPatchExecutionEnvironment));
+    executionEnvironment.RequiredWorkGroupSizeX = 8;
+    std::vector<char> executionEnvironmentToken;
+    PushBackToken(executionEnvironmentToken, executionEnvironment);
+    binary.insert(binary.end() - sizeof(iOpenCL::SPatchItemHeader), executionEnvironmentToken.begin(), executionEnvironmentToken.end());
+    auto kernelBinaryHeader = reinterpret_cast<iOpenCL::SKernelBinaryHeaderCommon *>(binary.data() + sizeof(iOpenCL::SProgramBinaryHeader));
+    kernelBinaryHeader->PatchListSize += executionEnvironment.Size;
+
+    ExecutionEnvironment execEnv;
+    cl_int retVal = CL_INVALID_BINARY;
+    std::unique_ptr<MockProgramRecordUnhandledTokens> program(Program::createFromGenBinary<MockProgramRecordUnhandledTokens>(execEnv, nullptr, binary.data(), binary.size(), false, &retVal));
+    program->allowUnhandledTokens = false;
+    EXPECT_EQ(CL_SUCCESS, program->processGenBinary());
+    ASSERT_EQ(1u, program->getNumKernels());
+
+    retVal = CL_SUCCESS;
+    EXPECT_EQ(nullptr, program->getKernelInfo("testKernel", &retVal));
+    EXPECT_EQ(CL_INVALID_PROGRAM_EXECUTABLE, retVal);
+    retVal = CL_SUCCESS;
+    EXPECT_EQ(nullptr, program->getKernelInfo(size_t(0), &retVal));
+    EXPECT_EQ(CL_INVALID_PROGRAM_EXECUTABLE, retVal);
+
+    auto pendingKernelInfo = program->kernelInfoArray[0];
+    EXPECT_FALSE(pendingKernelInfo->isMaterialized);
+    EXPECT_EQ(nullptr, pendingKernelInfo->patchInfo.executionEnvironment);
+    EXPECT_EQ(WorkloadInfo::undefinedOffset, pendingKernelInfo->reqdWorkGroupSize[0]);
+
+    retVal = CL_SUCCESS;
+    EXPECT_EQ(nullptr, program->getKernelInfo("notExistingKernel", &retVal));
+    EXPECT_EQ(CL_INVALID_KERNEL_NAME, retVal);
+
+    program->allowUnhandledTokens = true;
+    auto kernelInfo = program->getKernelInfo("testKernel", &retVal);
+    ASSERT_EQ(pendingKernelInfo, kernelInfo);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(kernelInfo->isMaterialized);
+    EXPECT_NE(nullptr, kernelInfo->patchInfo.executionEnvironment);
+    EXPECT_EQ(8u, kernelInfo->reqdWorkGroupSize[0]);
+}
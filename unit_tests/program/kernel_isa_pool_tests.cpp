@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/memory_manager/os_agnostic_memory_manager.h"
+#include "runtime/program/kernel_info.h"
+#include "runtime/program/kernel_isa_pool.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace OCLRT;
+
+TEST(KernelIsaPoolTest, givenIsaSizeWhenGettingSlotSizeThenPaddingIsAddedAndSizeIsAligned) {
+    EXPECT_EQ(KernelIsaPool::isaPrefetchPadding + KernelIsaPool::isaAlignment, KernelIsaPool::getSlotSize(1));
+    EXPECT_EQ(KernelIsaPool::isaPrefetchPadding + 128, KernelIsaPool::getSlotSize(128));
+    EXPECT_EQ(0u, KernelIsaPool::getSlotSize(100) % KernelIsaPool::isaAlignment);
+}
+
+TEST(KernelIsaPoolTest, givenReservedSizeWhenAllocatingKernelsThenAllOfThemShareOneChunkAtAlignedOffsets) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    KernelIsaPool pool(memoryManager);
+
+    char isa[3][100];
+    for (size_t i = 0; i < 3; i++) {
+        memset(isa[i], static_cast<int>(i + 1), sizeof(isa[i]));
+    }
+    pool.reserve(3 * KernelIsaPool::getSlotSize(sizeof(isa[0])));
+
+    GraphicsAllocation *allocations[3] = {};
+    uint32_t offsets[3] = {};
+    for (size_t i = 0; i < 3; i++) {
+        allocations[i] = pool.allocate(isa[i], sizeof(isa[i]), offsets[i]);
+        ASSERT_NE(nullptr, allocations[i]);
+        EXPECT_EQ(allocations[0], allocations[i]);
+        EXPECT_EQ(0u, offsets[i] % KernelIsaPool::isaAlignment);
+        EXPECT_EQ(0, memcmp(isa[i], ptrOffset(allocations[i]->getUnderlyingBuffer(), offsets[i]), sizeof(isa[i])));
+    }
+    EXPECT_EQ(1u, pool.getChunksCount());
+    EXPECT_EQ(3 * KernelIsaPool::getSlotSize(sizeof(isa[0])), allocations[0]->getUnderlyingBufferSize());
+    EXPECT_LE(offsets[0] + sizeof(isa[0]) + KernelIsaPool::isaPrefetchPadding, offsets[1]);
+
+    auto padding = ptrOffset(static_cast<char *>(allocations[0]->getUnderlyingBuffer()), offsets[0] + sizeof(isa[0]));
+    for (size_t i = 0; i < KernelIsaPool::isaPrefetchPadding; i++) {
+        EXPECT_EQ(0, padding[i]);
+    }
+}
+
+TEST(KernelIsaPoolTest, givenFullChunkWhenAllocatingKernelThenNewChunkIsCreated) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    KernelIsaPool pool(memoryManager);
+
+    char isa[64] = {};
+    uint32_t offset = 0;
+    pool.reserve(KernelIsaPool::getSlotSize(sizeof(isa)));
+    auto firstChunk = pool.allocate(isa, sizeof(isa), offset);
+    auto secondChunk = pool.allocate(isa, sizeof(isa), offset);
+
+    ASSERT_NE(nullptr, firstChunk);
+    ASSERT_NE(nullptr, secondChunk);
+    EXPECT_NE(firstChunk, secondChunk);
+    EXPECT_EQ(0u, offset);
+    EXPECT_EQ(2u, pool.getChunksCount());
+    EXPECT_EQ(KernelIsaPool::minChunkSize, secondChunk->getUnderlyingBufferSize());
+}
+
+TEST(KernelIsaPoolTest, givenKernelInfoWhenCreatingKernelAllocationFromPoolThenAllocationIsMarkedAsShared) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    KernelIsaPool pool(memoryManager);
+
+    SKernelBinaryHeaderCommon kernelHeader = {};
+    char heap[0x40] = {};
+    kernelHeader.KernelHeapSize = sizeof(heap);
+
+    KernelInfo firstKernelInfo;
+    KernelInfo secondKernelInfo;
+    for (auto kernelInfo : {&firstKernelInfo, &secondKernelInfo}) {
+        kernelInfo->heapInfo.pKernelHeader = &kernelHeader;
+        kernelInfo->heapInfo.pKernelHeap = heap;
+        EXPECT_TRUE(kernelInfo->createKernelAllocation(pool));
+        EXPECT_TRUE(kernelInfo->isKernelAllocationShared);
+    }
+    EXPECT_EQ(firstKernelInfo.kernelAllocation, secondKernelInfo.kernelAllocation);
+    EXPECT_EQ(0u, firstKernelInfo.kernelAllocationOffset);
+    EXPECT_EQ(KernelIsaPool::getSlotSize(sizeof(heap)), secondKernelInfo.kernelAllocationOffset);
+}
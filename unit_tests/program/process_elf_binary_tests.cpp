@@ -6,12 +6,15 @@
  */
 
 #include "runtime/helpers/file_io.h"
+#include "runtime/helpers/hw_info.h"
 #include "runtime/program/program.h"
 #include "runtime/helpers/string.h"
 #include "unit_tests/helpers/test_files.h"
+#include "unit_tests/mocks/mock_device.h"
 #include "unit_tests/mocks/mock_program.h"
 #include "gtest/gtest.h"
 #include <cstring>
+#include <vector>
 
 using namespace OCLRT;
 
@@ -191,6 +194,44 @@ TEST_F(ProcessElfBinaryTests, BackToBack) {
     deleteDataReadFromFile(pBinary);
 }
 
+TEST_F(ProcessElfBinaryTests, givenSingleTargetBinaryWhenProcessedThenGenBinaryPointsIntoStoredElfBinary) {
+    uint32_t binaryVersion;
+    void *pBinary = nullptr;
+    std::string filePath;
+    retrieveBinaryKernelFilename(filePath, "CopyBuffer_simd8_", ".bin");
+
+    size_t binarySize = loadDataFromFile(filePath.c_str(), pBinary);
+    cl_int retVal = program->processElfBinary(pBinary, binarySize, binaryVersion);
+    deleteDataReadFromFile(pBinary);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(program->genBinaryIsElfView);
+    EXPECT_LE(program->elfBinary.data(), program->genBinary);
+    EXPECT_GE(program->elfBinary.data() + program->elfBinary.size(), program->genBinary + program->genBinarySize);
+}
+
+TEST_F(ProcessElfBinaryTests, givenGenBinaryPointingIntoElfBinaryWhenElfBinaryIsRebuiltThenGenBinaryIsCopied) {
+    uint32_t binaryVersion;
+    void *pBinary = nullptr;
+    std::string filePath;
+    retrieveBinaryKernelFilename(filePath, "CopyBuffer_simd8_", ".bin");
+
+    size_t binarySize = loadDataFromFile(filePath.c_str(), pBinary);
+    cl_int retVal = program->processElfBinary(pBinary, binarySize, binaryVersion);
+    deleteDataReadFromFile(pBinary);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_TRUE(program->genBinaryIsElfView);
+
+    std::vector<char> genBinary(program->genBinary, program->genBinary + program->genBinarySize);
+    program->isProgramBinaryResolved = false;
+    retVal = program->resolveProgramBinary();
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(program->genBinaryIsElfView);
+    ASSERT_EQ(genBinary.size(), program->genBinarySize);
+    EXPECT_EQ(0, memcmp(genBinary.data(), program->genBinary, genBinary.size()));
+}
+
 TEST_F(ProcessElfBinaryTests, BuildOptionsEmpty) {
     uint32_t binaryVersion;
     void *pBinary = nullptr;
@@ -252,3 +293,117 @@ TEST_F(ProcessElfBinaryTests, GivenBinaryWhenInvalidCURRENT_ICBE_VERSIONThenInva
     EXPECT_EQ(CL_INVALID_BINARY, retVal);
     EXPECT_EQ(binaryVersion, iOpenCL::CURRENT_ICBE_VERSION - 3u);
 }
+
+class ProcessMultiTargetElfBinaryTests : public ProcessElfBinaryTests {
+  public:
+    void SetUp() override {
+        ProcessElfBinaryTests::SetUp();
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        program->setDevice(device.get());
+        productName = hardwarePrefix[device->getHardwareInfo().pPlatform->eProductFamily];
+    }
+
+    void TearDown() override {
+        program->setDevice(nullptr);
+    }
+
+    void addDevBinarySection(const std::string &sectionName, uint32_t version, uint32_t steppingId) {
+        SProgramBinaryHeader genBinaryHeader = {0};
+        genBinaryHeader.Magic = iOpenCL::MAGIC_CL;
+        genBinaryHeader.Version = version;
+        genBinaryHeader.Device = device->getHardwareInfo().pPlatform->eRenderCoreFamily;
+        genBinaryHeader.GPUPointerSizeInBytes = 8;
+        genBinaryHeader.SteppingId = steppingId;
+        std::string genBinary(reinterpret_cast<const char *>(&genBinaryHeader), sizeof(genBinaryHeader));
+        elfWriter.addSection(CLElfLib::SSectionNode(CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY, CLElfLib::E_SH_FLAG::SH_FLAG_NONE, sectionName, std::move(genBinary), static_cast<uint32_t>(sizeof(genBinaryHeader))));
+    }
+
+    CLElfLib::ElfBinaryStorage resolveElfBinary() {
+        CLElfLib::ElfBinaryStorage elfBinary(elfWriter.getTotalBinarySize());
+        elfWriter.resolveBinary(elfBinary);
+        return elfBinary;
+    }
+
+    std::unique_ptr<MockDevice> device;
+    CLElfLib::CElfWriter elfWriter{CLElfLib::E_EH_TYPE::EH_TYPE_OPENCL_EXECUTABLE, CLElfLib::E_EH_MACHINE::EH_MACHINE_NONE, 0};
+    const char *productName = nullptr;
+};
+
+TEST_F(ProcessMultiTargetElfBinaryTests, givenSectionsForCoreFamilyAndProductWhenProcessedThenSectionOfProductIsUsed) {
+    ASSERT_NE(nullptr, productName);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "unknown", iOpenCL::CURRENT_ICBE_VERSION, 1u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + productName, iOpenCL::CURRENT_ICBE_VERSION, 2u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "other", iOpenCL::CURRENT_ICBE_VERSION, 3u);
+    auto elfBinary = resolveElfBinary();
+
+    uint32_t binaryVersion = 0;
+    cl_int retVal = program->processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(sizeof(SProgramBinaryHeader), program->genBinarySize);
+    EXPECT_EQ(2u, reinterpret_cast<SProgramBinaryHeader *>(program->genBinary)->SteppingId);
+}
+
+TEST_F(ProcessMultiTargetElfBinaryTests, givenSectionsNotNamedAfterProductWhenProcessedThenFirstSectionOfCoreFamilyIsUsed) {
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "first", iOpenCL::CURRENT_ICBE_VERSION, 1u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "second", iOpenCL::CURRENT_ICBE_VERSION, 2u);
+    auto elfBinary = resolveElfBinary();
+
+    uint32_t binaryVersion = 0;
+    cl_int retVal = program->processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, reinterpret_cast<SProgramBinaryHeader *>(program->genBinary)->SteppingId);
+}
+
+TEST_F(ProcessMultiTargetElfBinaryTests, givenInvalidSectionBeforeValidOneWhenProcessedThenValidSectionIsUsed) {
+    ASSERT_NE(nullptr, productName);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + productName, iOpenCL::CURRENT_ICBE_VERSION - 3u, 1u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "other", iOpenCL::CURRENT_ICBE_VERSION, 2u);
+    auto elfBinary = resolveElfBinary();
+
+    uint32_t binaryVersion = 0;
+    cl_int retVal = program->processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, reinterpret_cast<SProgramBinaryHeader *>(program->genBinary)->SteppingId);
+}
+
+TEST_F(ProcessMultiTargetElfBinaryTests, givenOnlyInvalidSectionsWhenProcessedThenInvalidBinaryAndVersionOfFirstSectionAreReturned) {
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "first", iOpenCL::CURRENT_ICBE_VERSION - 3u, 1u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "second", iOpenCL::CURRENT_ICBE_VERSION - 2u, 2u);
+    auto elfBinary = resolveElfBinary();
+
+    uint32_t binaryVersion = 0;
+    cl_int retVal = program->processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion);
+
+    EXPECT_EQ(CL_INVALID_BINARY, retVal);
+    EXPECT_EQ(iOpenCL::CURRENT_ICBE_VERSION - 3u, binaryVersion);
+}
+
+TEST_F(ProcessMultiTargetElfBinaryTests, givenMultiTargetBinaryWhenProgramBinaryIsResolvedThenOnlySelectedSectionIsStored) {
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "first", iOpenCL::CURRENT_ICBE_VERSION, 1u);
+    addDevBinarySection(std::string(CLElfLib::devBinarySectionNamePrefix) + "second", iOpenCL::CURRENT_ICBE_VERSION, 2u);
+    auto elfBinary = resolveElfBinary();
+
+    uint32_t binaryVersion = 0;
+    cl_int retVal = program->processElfBinary(elfBinary.data(), elfBinary.size(), binaryVersion);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(program->isProgramBinaryResolved);
+
+    EXPECT_TRUE(program->elfBinary.empty());
+    EXPECT_FALSE(program->genBinaryIsElfView);
+
+    retVal = program->resolveProgramBinary();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    CLElfLib::CElfReader elfReader(program->elfBinary);
+    size_t devBinarySectionsCount = 0;
+    for (const auto &sectionHeader : elfReader.getSectionHeaders()) {
+        if (sectionHeader.Type == CLElfLib::E_SH_TYPE::SH_TYPE_OPENCL_DEV_BINARY) {
+            devBinarySectionsCount++;
+            EXPECT_EQ(1u, reinterpret_cast<SProgramBinaryHeader *>(elfReader.getSectionData(sectionHeader.DataOffset))->SteppingId);
+        }
+    }
+    EXPECT_EQ(1u, devBinarySectionsCount);
+}
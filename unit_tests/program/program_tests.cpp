@@ -21,7 +21,9 @@
 #include "runtime/memory_manager/allocations_list.h"
 #include "runtime/memory_manager/graphics_allocation.h"
 #include "runtime/memory_manager/surface.h"
+#include "runtime/platform/platform.h"
 #include "runtime/program/create.inl"
+#include "runtime/utilities/worker_pool.h"
 #include "unit_tests/fixtures/device_fixture.h"
 #include "unit_tests/fixtures/program_fixture.inl"
 #include "unit_tests/global_environment.h"
@@ -37,9 +39,12 @@
 #include "gmock/gmock.h"
 #include "test.h"
 
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace OCLRT;
@@ -650,6 +655,56 @@ TEST_P(ProgramFromBinaryTest, givenProgramWhenItIsBeingBuildThenItContainsGraphi
     }
 }
 
+TEST_P(ProgramFromBinaryTest, givenLazyKernelMaterializationWhenGenBinaryIsProcessedThenPatchTokensAndIsaAreHandledOnFirstKernelInfoQuery) {
+    DebugManagerStateRestore dbgRestorer;
+    cl_device_id device = pDevice;
+    pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    size_t genBinarySize = 0;
+    auto genBinary = pProgram->getGenBinary(genBinarySize);
+
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(1);
+    MockProgram program(*pDevice->getExecutionEnvironment(), pContext, false);
+    program.storeGenBinary(genBinary, genBinarySize);
+    EXPECT_EQ(CL_SUCCESS, program.processGenBinary());
+
+    ASSERT_EQ(1u, program.getNumKernels());
+    auto pendingKernelInfo = program.getKernelInfoArray()[0];
+    EXPECT_FALSE(pendingKernelInfo->isMaterialized);
+    EXPECT_EQ(nullptr, pendingKernelInfo->getGraphicsAllocation());
+    EXPECT_EQ(nullptr, pendingKernelInfo->patchInfo.executionEnvironment);
+    EXPECT_NE(nullptr, pendingKernelInfo->heapInfo.pKernelHeap);
+
+    auto kernelInfo = program.getKernelInfo(KernelName);
+    ASSERT_EQ(pendingKernelInfo, kernelInfo);
+    EXPECT_TRUE(kernelInfo->isMaterialized);
+    EXPECT_TRUE(kernelInfo->isValid);
+    EXPECT_NE(nullptr, kernelInfo->patchInfo.executionEnvironment);
+    auto graphicsAllocation = kernelInfo->getGraphicsAllocation();
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(0, memcmp(graphicsAllocation->getUnderlyingBuffer(), kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.pKernelHeader->KernelHeapSize));
+
+    EXPECT_EQ(kernelInfo, program.getKernelInfo(size_t(0)));
+    EXPECT_EQ(graphicsAllocation, kernelInfo->getGraphicsAllocation());
+}
+
+TEST_P(ProgramFromBinaryTest, givenLazyKernelMaterializationDisabledWhenGenBinaryIsProcessedThenKernelsAreMaterializedAtLoad) {
+    DebugManagerStateRestore dbgRestorer;
+    cl_device_id device = pDevice;
+    pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    size_t genBinarySize = 0;
+    auto genBinary = pProgram->getGenBinary(genBinarySize);
+
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    MockProgram program(*pDevice->getExecutionEnvironment(), pContext, false);
+    program.storeGenBinary(genBinary, genBinarySize);
+    EXPECT_EQ(CL_SUCCESS, program.processGenBinary());
+
+    ASSERT_EQ(1u, program.getNumKernels());
+    auto kernelInfo = program.getKernelInfoArray()[0];
+    EXPECT_TRUE(kernelInfo->isMaterialized);
+    EXPECT_NE(nullptr, kernelInfo->getGraphicsAllocation());
+}
+
 TEST_P(ProgramFromBinaryTest, givenProgramWhenCleanKernelInfoIsCalledThenKernelAllocationIsFreed) {
     cl_device_id device = pDevice;
     pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
@@ -658,6 +713,213 @@ TEST_P(ProgramFromBinaryTest, givenProgramWhenCleanKernelInfoIsCalledThenKernelA
     EXPECT_EQ(0u, pProgram->getNumKernels());
 }
 
+typedef Test<ProgramSimpleFixture> ProgramKernelIsaPoolTests;
+
+TEST_F(ProgramKernelIsaPoolTests, givenProgramWithManyKernelsWhenBuiltThenIsaOfAllKernelsIsPackedIntoOneAllocation) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+    ASSERT_LT(1u, pProgram->getNumKernels());
+
+    auto sharedAllocation = pProgram->getKernelInfo(size_t(0))->getGraphicsAllocation();
+    ASSERT_NE(nullptr, sharedAllocation);
+    size_t expectedAllocationSize = 0;
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        auto isaSize = kernelInfo->heapInfo.pKernelHeader->KernelHeapSize;
+        EXPECT_TRUE(kernelInfo->isKernelAllocationShared);
+        EXPECT_EQ(sharedAllocation, kernelInfo->getGraphicsAllocation());
+        EXPECT_EQ(0u, kernelInfo->kernelAllocationOffset % KernelIsaPool::isaAlignment);
+        EXPECT_EQ(0, memcmp(ptrOffset(sharedAllocation->getUnderlyingBuffer(), kernelInfo->kernelAllocationOffset), kernelInfo->heapInfo.pKernelHeap, isaSize));
+        expectedAllocationSize += KernelIsaPool::getSlotSize(isaSize);
+    }
+    EXPECT_EQ(expectedAllocationSize, sharedAllocation->getUnderlyingBufferSize());
+}
+
+TEST_F(ProgramKernelIsaPoolTests, givenKernelIsaPoolDisabledWhenProgramWithManyKernelsIsBuiltThenEachKernelHasOwnAllocation) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    DebugManager.flags.EnableKernelIsaPool.set(false);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+    ASSERT_LT(1u, pProgram->getNumKernels());
+
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        EXPECT_FALSE(kernelInfo->isKernelAllocationShared);
+        EXPECT_EQ(0u, kernelInfo->kernelAllocationOffset);
+        EXPECT_EQ(kernelInfo->heapInfo.pKernelHeader->KernelHeapSize, kernelInfo->getGraphicsAllocation()->getUnderlyingBufferSize());
+    }
+    EXPECT_NE(pProgram->getKernelInfo(size_t(0))->getGraphicsAllocation(), pProgram->getKernelInfo(size_t(1))->getGraphicsAllocation());
+}
+
+typedef Test<ProgramSimpleFixture> ProgramParallelBuildTests;
+
+TEST_F(ProgramParallelBuildTests, givenProgramWithManyKernelsWhenPatchTokensAreParsedInParallelThenKernelInfosMatchSerialParsing) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(-1);
+    DebugManager.flags.ParallelKernelParsingThreshold.set(-1);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+    ASSERT_LT(1u, pProgram->getNumKernels());
+
+    std::vector<std::string> serialNames;
+    std::vector<uint32_t> serialOffsets;
+    std::vector<uint32_t> serialCrossThreadDataSizes;
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        serialNames.push_back(kernelInfo->name);
+        serialOffsets.push_back(kernelInfo->kernelAllocationOffset);
+        serialCrossThreadDataSizes.push_back(kernelInfo->getConstantBufferSize());
+    }
+
+    DebugManager.flags.ParallelKernelParsingThreshold.set(2);
+    DebugManager.flags.ProgramBuildWorkersCount.set(4);
+    ASSERT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+    ASSERT_EQ(serialNames.size(), pProgram->getNumKernels());
+    EXPECT_EQ(4u, platform()->getBuildWorkerPool()->getWorkersCount());
+
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        EXPECT_EQ(serialNames[i], kernelInfo->name);
+        EXPECT_EQ(serialOffsets[i], kernelInfo->kernelAllocationOffset);
+        EXPECT_EQ(serialCrossThreadDataSizes[i], kernelInfo->getConstantBufferSize());
+        EXPECT_TRUE(kernelInfo->isValid);
+        EXPECT_TRUE(kernelInfo->isMaterialized);
+        ASSERT_NE(nullptr, kernelInfo->getGraphicsAllocation());
+        EXPECT_EQ(0, memcmp(ptrOffset(kernelInfo->getGraphicsAllocation()->getUnderlyingBuffer(), kernelInfo->kernelAllocationOffset),
+                            kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.pKernelHeader->KernelHeapSize));
+    }
+}
+
+TEST_F(ProgramParallelBuildTests, givenLazyMaterializationWhenPatchTokensAreParsedInParallelThenKernelsAreMaterializedOnFirstUse) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.LazyKernelMaterializationThreshold.set(1);
+    DebugManager.flags.ParallelKernelParsingThreshold.set(2);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+    ASSERT_LT(1u, pProgram->getNumKernels());
+
+    auto kernelInfo = pProgram->getKernelInfo(size_t(0));
+    ASSERT_NE(nullptr, kernelInfo);
+    EXPECT_TRUE(kernelInfo->isMaterialized);
+    EXPECT_NE(nullptr, kernelInfo->getGraphicsAllocation());
+}
+
+namespace {
+struct AsyncBuildNotification {
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool notified = false;
+    std::thread::id notifyingThread;
+    cl_build_status buildStatus = CL_BUILD_NONE;
+
+    static void CL_CALLBACK notify(cl_program program, void *userData) {
+        auto notification = reinterpret_cast<AsyncBuildNotification *>(userData);
+        std::lock_guard<std::mutex> lock(notification->mtx);
+        notification->notifyingThread = std::this_thread::get_id();
+        notification->buildStatus = castToObject<Program>(program)->getBuildStatus();
+        notification->notified = true;
+        notification->condition.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mtx);
+        condition.wait(lock, [this] { return notified; });
+    }
+};
+} // namespace
+
+TEST_F(ProgramParallelBuildTests, givenNotifyFunctionWhenProgramIsBuiltThenNotifyIsCalledFromBuildWorkerAfterBuildCompletes) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(true);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    auto initialInternalRefCount = pProgram->getRefInternalCount();
+
+    AsyncBuildNotification notification;
+    EXPECT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, AsyncBuildNotification::notify, &notification, false));
+    notification.wait();
+
+    EXPECT_NE(std::this_thread::get_id(), notification.notifyingThread);
+    EXPECT_EQ(CL_BUILD_SUCCESS, notification.buildStatus);
+    EXPECT_EQ(CL_BUILD_SUCCESS, pProgram->getBuildStatus());
+    EXPECT_LT(0u, pProgram->getNumKernels());
+
+    // build worker drops its reference right after notify returns
+    while (pProgram->getRefInternalCount() != initialInternalRefCount) {
+        std::this_thread::yield();
+    }
+}
+
+TEST_F(ProgramParallelBuildTests, givenAsyncBuildDisabledWhenProgramIsBuiltWithNotifyFunctionThenNotifyIsCalledBeforeBuildReturns) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(false);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+
+    AsyncBuildNotification notification;
+    EXPECT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, AsyncBuildNotification::notify, &notification, false));
+
+    EXPECT_TRUE(notification.notified);
+    EXPECT_EQ(std::this_thread::get_id(), notification.notifyingThread);
+    EXPECT_EQ(CL_BUILD_SUCCESS, notification.buildStatus);
+}
+
+TEST_F(ProgramParallelBuildTests, givenAsyncBuildInProgressWhenProgramIsBuiltAgainThenInvalidOperationIsReturnedAndBuildStateIsGuarded) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(true);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<MockProgram>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    auto mockProgram = static_cast<MockProgram *>(pProgram);
+
+    AsyncBuildNotification notification;
+    {
+        // build worker waits for the lock, so the build stays in progress
+        std::lock_guard<std::mutex> lock(mockProgram->buildMutex);
+        EXPECT_EQ(CL_SUCCESS, pProgram->build(1, &device, nullptr, AsyncBuildNotification::notify, &notification, false));
+        EXPECT_EQ(CL_BUILD_IN_PROGRESS, pProgram->getBuildStatus());
+
+        EXPECT_EQ(CL_INVALID_OPERATION, pProgram->build(1, &device, nullptr, nullptr, nullptr, false));
+        EXPECT_EQ(CL_BUILD_IN_PROGRESS, pProgram->getBuildStatus());
+        EXPECT_FALSE(notification.notified);
+    }
+    notification.wait();
+    EXPECT_EQ(CL_BUILD_SUCCESS, notification.buildStatus);
+
+    size_t binarySize = 0;
+    EXPECT_EQ(CL_SUCCESS, pProgram->getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr));
+    EXPECT_NE(0u, binarySize);
+}
+
+TEST_F(ProgramParallelBuildTests, givenInvalidDeviceWhenProgramIsBuiltWithNotifyFunctionThenErrorIsReturnedWithoutGoingAsync) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(true);
+    cl_device_id device = pDevice;
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+
+    cl_device_id invalidDevice = reinterpret_cast<cl_device_id>(pContext);
+    AsyncBuildNotification notification;
+    EXPECT_EQ(CL_INVALID_DEVICE, pProgram->build(1, &invalidDevice, nullptr, AsyncBuildNotification::notify, &notification, false));
+
+    EXPECT_TRUE(notification.notified);
+    EXPECT_EQ(std::this_thread::get_id(), notification.notifyingThread);
+    EXPECT_EQ(CL_BUILD_ERROR, pProgram->getBuildStatus());
+}
+
 TEST_P(ProgramFromBinaryTest, givenProgramWhenCleanCurrentKernelInfoIsCalledButGpuIsNotYetDoneThenKernelAllocationIsPutOnDefferedFreeList) {
     cl_device_id device = pDevice;
     auto &csr = pDevice->getCommandStreamReceiver();
@@ -778,6 +1040,8 @@ TEST_P(ProgramFromSourceTest, CreateWithSource_Build) {
     EXPECT_EQ(CL_SUCCESS, retVal);
 
     // build successfully with notifyFunc - duplicate build (kernel already built), do not build and just take it
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(false);
     retVal = pProgram->build(0, nullptr, nullptr, notifyFunc, &data[0], false);
     EXPECT_EQ(CL_SUCCESS, retVal);
     EXPECT_EQ('a', data[0]);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/async_file_writer.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+using namespace OCLRT;
+
+TEST(AsyncFileWriterTest, givenDataSmallerThanBufferWhenFlushIsCalledThenDataIsWrittenToOutput) {
+    std::stringstream output;
+    AsyncFileWriter writer(output, 64);
+
+    std::string data = "data";
+    writer.write(data.c_str(), data.size());
+    EXPECT_EQ(0u, writer.peekBuffersSubmitted());
+
+    writer.flush();
+    EXPECT_EQ(1u, writer.peekBuffersSubmitted());
+    EXPECT_EQ(data.size(), writer.peekBytesWritten());
+    EXPECT_EQ(data, output.str());
+}
+
+TEST(AsyncFileWriterTest, givenDataLargerThanBufferWhenWriteIsCalledThenDataIsSplitAcrossBuffersInOrder) {
+    std::stringstream output;
+    AsyncFileWriter writer(output, 16);
+
+    std::string expected;
+    for (int i = 0; i < 100; i++) {
+        std::string chunk(static_cast<size_t>(i % 40), static_cast<char>('a' + i % 26));
+        expected += chunk;
+        writer.write(chunk.c_str(), chunk.size());
+    }
+    writer.flush();
+
+    EXPECT_LT(1u, writer.peekBuffersSubmitted());
+    EXPECT_EQ(expected.size(), writer.peekBytesWritten());
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(AsyncFileWriterTest, givenPendingDataWhenWriterIsDestroyedThenDataIsWrittenToOutput) {
+    std::stringstream output;
+    std::string data(100, 'x');
+    {
+        AsyncFileWriter writer(output, 32);
+        writer.write(data.c_str(), data.size());
+    }
+    EXPECT_EQ(data, output.str());
+}
+
+TEST(AsyncFileWriterTest, givenNoDataWhenFlushIsCalledThenNothingIsSubmitted) {
+    std::stringstream output;
+    AsyncFileWriter writer(output, 32);
+    writer.flush();
+    EXPECT_EQ(0u, writer.peekBuffersSubmitted());
+    EXPECT_TRUE(output.str().empty());
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/block_codec.h"
+#include "runtime/utilities/lz4_block_codec.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+std::vector<char> createPseudoRandomData(size_t size) {
+    std::vector<char> data(size);
+    uint32_t seed = 0x12345678;
+    for (auto &byte : data) {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<char>(seed >> 24);
+    }
+    return data;
+}
+
+void expectRoundTrip(const std::vector<char> &data, size_t *compressedSizeOut = nullptr) {
+    Lz4BlockCodec codec;
+    std::vector<char> compressed(data.size() + data.size() / 255 + 16);
+    auto compressedSize = codec.compress(data.data(), data.size(), compressed.data(), compressed.size());
+    ASSERT_NE(0u, compressedSize);
+
+    std::vector<char> decompressed(data.size());
+    EXPECT_TRUE(codec.decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+    EXPECT_EQ(data, decompressed);
+    if (compressedSizeOut) {
+        *compressedSizeOut = compressedSize;
+    }
+}
+} // namespace
+
+TEST(BlockCodecTest, givenKnownCodecTypeWhenCreateBlockCodecIsCalledThenCodecIsReturned) {
+    auto codec = createBlockCodec(static_cast<uint32_t>(BlockCodecType::Lz4));
+    ASSERT_NE(nullptr, codec.get());
+    EXPECT_EQ(BlockCodecType::Lz4, codec->getType());
+}
+
+TEST(BlockCodecTest, givenUnknownCodecTypeWhenCreateBlockCodecIsCalledThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, createBlockCodec(0u).get());
+    EXPECT_EQ(nullptr, createBlockCodec(static_cast<uint32_t>(BlockCodecType::MaxCodecType)).get());
+}
+
+TEST(Lz4BlockCodecTest, givenZeroedDataWhenCompressedThenOutputIsMuchSmallerAndDecompressesToInput) {
+    std::vector<char> data(64 * 1024, 0);
+    size_t compressedSize = 0;
+    expectRoundTrip(data, &compressedSize);
+    EXPECT_GT(data.size() / 100, compressedSize);
+}
+
+TEST(Lz4BlockCodecTest, givenRepeatedPatternWhenCompressedThenDataDecompressesToInput) {
+    std::vector<char> data(10000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>("pattern"[i % 7]);
+    }
+    expectRoundTrip(data);
+}
+
+TEST(Lz4BlockCodecTest, givenIncompressibleDataWhenCompressedIntoLargeEnoughBufferThenDataDecompressesToInput) {
+    expectRoundTrip(createPseudoRandomData(4096));
+}
+
+TEST(Lz4BlockCodecTest, givenMixedDataWhenCompressedThenDataDecompressesToInput) {
+    auto data = createPseudoRandomData(100000);
+    for (size_t i = 1000; i < 50000; i++) {
+        data[i] = 0;
+    }
+    for (size_t i = 70000; i < 70300; i++) {
+        data[i] = data[i - 2000];
+    }
+    expectRoundTrip(data);
+}
+
+TEST(Lz4BlockCodecTest, givenInputShorterThanMatchFindLimitWhenCompressedThenItIsStoredAsLiterals) {
+    for (size_t size = 0; size <= Lz4BlockCodec::matchFindLimit + 1; size++) {
+        std::vector<char> data(size, 'a');
+        size_t compressedSize = 0;
+        expectRoundTrip(data, &compressedSize);
+        if (size <= Lz4BlockCodec::matchFindLimit) {
+            EXPECT_EQ(size + 1, compressedSize);
+        }
+    }
+}
+
+TEST(Lz4BlockCodecTest, givenTooSmallOutputBufferWhenCompressIsCalledThenZeroIsReturned) {
+    Lz4BlockCodec codec;
+    auto data = createPseudoRandomData(4096);
+    std::vector<char> compressed(data.size() - 1);
+    EXPECT_EQ(0u, codec.compress(data.data(), data.size(), compressed.data(), compressed.size()));
+}
+
+TEST(Lz4BlockCodecTest, givenCorruptedInputWhenDecompressIsCalledThenFalseIsReturned) {
+    Lz4BlockCodec codec;
+    std::vector<char> data(4096, 0);
+    std::vector<char> compressed(data.size());
+    auto compressedSize = codec.compress(data.data(), data.size(), compressed.data(), compressed.size());
+    ASSERT_NE(0u, compressedSize);
+
+    std::vector<char> decompressed(data.size());
+    EXPECT_FALSE(codec.decompress(compressed.data(), compressedSize - 1, decompressed.data(), decompressed.size()));
+    EXPECT_FALSE(codec.decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size() - 1));
+
+    // offset pointing before the beginning of output
+    compressed[2] = static_cast<char>(0xFF);
+    compressed[3] = static_cast<char>(0xFF);
+    EXPECT_FALSE(codec.decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/compressed_file_reader.h"
+#include "runtime/utilities/compressed_file_writer.h"
+#include "runtime/utilities/lz4_block_codec.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+using namespace OCLRT;
+
+TEST(CompressedFileWriterTest, givenWrittenDataWhenContainerIsReadThenOriginalDataIsReturned) {
+    std::stringstream container;
+    std::string expected;
+    {
+        CompressedFileWriter writer(container, 256, std::make_unique<Lz4BlockCodec>());
+        for (int i = 0; i < 100; i++) {
+            std::string chunk(static_cast<size_t>(i % 40), static_cast<char>('a' + i % 26));
+            expected += chunk;
+            writer.write(chunk.c_str(), chunk.size());
+        }
+        writer.flush();
+        EXPECT_EQ(expected.size(), writer.peekBytesWritten());
+        EXPECT_GT(expected.size(), writer.peekCompressedBytesWritten());
+    }
+
+    CompressedFileReader reader(container);
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_EQ(256u, reader.getHeader().blockSize);
+    EXPECT_EQ(static_cast<uint32_t>(BlockCodecType::Lz4), reader.getHeader().codecType);
+
+    std::stringstream output;
+    EXPECT_TRUE(reader.decompress(output));
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(CompressedFileWriterTest, givenIncompressibleBlockWhenWrittenThenBlockIsStoredUncompressed) {
+    std::stringstream container;
+    std::string data = "abcdefgh";
+    {
+        CompressedFileWriter writer(container, 64, std::make_unique<Lz4BlockCodec>());
+        writer.write(data.c_str(), data.size());
+    }
+    EXPECT_EQ(sizeof(CompressedFileHeader) + sizeof(CompressedBlockHeader) + data.size(), container.str().size());
+
+    CompressedFileReader reader(container);
+    std::vector<char> block;
+    EXPECT_TRUE(reader.readBlock(block));
+    EXPECT_EQ(data, std::string(block.begin(), block.end()));
+    EXPECT_FALSE(reader.readBlock(block));
+    EXPECT_FALSE(reader.isCorrupted());
+}
+
+TEST(CompressedFileReaderTest, givenStreamWithoutContainerHeaderWhenReaderIsCreatedThenItIsNotValid) {
+    std::stringstream input(std::string(64, 'x'));
+    CompressedFileReader reader(input);
+    EXPECT_FALSE(reader.isValid());
+
+    std::stringstream output;
+    EXPECT_FALSE(reader.decompress(output));
+    EXPECT_TRUE(output.str().empty());
+}
+
+TEST(CompressedFileReaderTest, givenTruncatedContainerWhenDecompressIsCalledThenFalseIsReturned) {
+    std::stringstream container;
+    {
+        CompressedFileWriter writer(container, 1024, std::make_unique<Lz4BlockCodec>());
+        std::string data(4096, 'z');
+        writer.write(data.c_str(), data.size());
+    }
+    auto truncated = container.str();
+    truncated.resize(truncated.size() - 3);
+
+    std::stringstream input(truncated);
+    CompressedFileReader reader(input);
+    ASSERT_TRUE(reader.isValid());
+    std::stringstream output;
+    EXPECT_FALSE(reader.decompress(output));
+    EXPECT_TRUE(reader.isCorrupted());
+}
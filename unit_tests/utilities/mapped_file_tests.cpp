@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/mapped_file.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace OCLRT;
+
+TEST(MappedFile, givenMissingFileWhenOpenedThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, MappedFile::open("mapped_file_that_does_not_exist.tmp"));
+}
+
+TEST(MappedFile, givenEmptyFileWhenOpenedThenNullptrIsReturned) {
+    const char *fileName = "mapped_file_empty.tmp";
+    std::ofstream(fileName).close();
+
+    EXPECT_EQ(nullptr, MappedFile::open(fileName));
+    std::remove(fileName);
+}
+
+TEST(MappedFile, givenFileWhenOpenedThenWholeContentIsMappedAndWritesDoNotReachFile) {
+    const char *fileName = "mapped_file_content.tmp";
+    const char content[] = "0123456789abcdef";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content, sizeof(content));
+    }
+
+    auto mappedFile = MappedFile::open(fileName);
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_EQ(sizeof(content), mappedFile->size());
+    EXPECT_EQ(0, memcmp(content, mappedFile->data(), sizeof(content)));
+
+    mappedFile->data()[0] = 'X';
+    auto secondMapping = MappedFile::open(fileName);
+    ASSERT_NE(nullptr, secondMapping);
+    EXPECT_EQ('0', secondMapping->data()[0]);
+
+    mappedFile.reset();
+    secondMapping.reset();
+    std::remove(fileName);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/heap_allocator.h"
+#include "runtime/utilities/segregated_heap_allocator.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+const uint64_t heapBase = 0x100000llu;
+const size_t heapSize = 1024 * MemoryConstants::pageSize;
+const size_t threshold = 16 * MemoryConstants::pageSize;
+
+class SegregatedHeapAllocatorUnderTest : public SegregatedHeapAllocator {
+  public:
+    using SegregatedHeapAllocator::SegregatedHeapAllocator;
+    using SegregatedHeapAllocator::freeBlocksCount;
+    using SegregatedHeapAllocator::getBinIndex;
+};
+
+// Allocations of random sizes are made and freed in random order, returned ranges are checked against each other
+template <typename AllocatorT>
+void runRandomAllocations(AllocatorT &allocator, uint64_t base, uint64_t size, uint32_t seed, uint32_t iterations) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> smallSizes(1, threshold);
+    std::uniform_int_distribution<size_t> bigSizes(threshold + 1, 8 * threshold);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+
+    std::map<uint64_t, size_t> allocations;
+    uint64_t allocatedSize = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (allocations.empty() || percent(generator) < 55) {
+            size_t sizeToAllocate = percent(generator) < 80 ? smallSizes(generator) : bigSizes(generator);
+            auto ptr = allocator.allocate(sizeToAllocate);
+            if (ptr == 0llu) {
+                continue;
+            }
+            ASSERT_GE(ptr, base);
+            ASSERT_LE(ptr + sizeToAllocate, base + size);
+            auto next = allocations.lower_bound(ptr);
+            if (next != allocations.end()) {
+                ASSERT_LE(ptr + sizeToAllocate, next->first);
+            }
+            if (next != allocations.begin()) {
+                auto previous = std::prev(next);
+                ASSERT_LE(previous->first + previous->second, ptr);
+            }
+            allocations[ptr] = sizeToAllocate;
+            allocatedSize += sizeToAllocate;
+        } else {
+            auto allocation = allocations.begin();
+            std::advance(allocation, std::uniform_int_distribution<size_t>(0, allocations.size() - 1)(generator));
+            allocator.free(allocation->first, allocation->second);
+            allocatedSize -= allocation->second;
+            allocations.erase(allocation);
+        }
+        ASSERT_EQ(allocatedSize, allocator.getUsedSize());
+    }
+
+    for (auto &allocation : allocations) {
+        allocator.free(allocation.first, allocation.second);
+    }
+    EXPECT_EQ(size, allocator.getLeftSize());
+}
+} // namespace
+
+TEST(SegregatedHeapAllocatorTest, givenSizeWhenBinIndexIsComputedThenBinsAreOrderedBySize) {
+    uint32_t previousFirstLevel = 0;
+    uint32_t previousSecondLevel = 0;
+    for (uint64_t units = 1; units < 4096; units++) {
+        uint32_t firstLevel = 0;
+        uint32_t secondLevel = 0;
+        SegregatedHeapAllocatorUnderTest::getBinIndex(units, firstLevel, secondLevel);
+        EXPECT_GT(16u, secondLevel);
+        EXPECT_TRUE(firstLevel > previousFirstLevel || (firstLevel == previousFirstLevel && secondLevel >= previousSecondLevel));
+        previousFirstLevel = firstLevel;
+        previousSecondLevel = secondLevel;
+    }
+}
+
+TEST(SegregatedHeapAllocatorTest, givenSmallAndBigAllocationsWhenAllocatedThenSmallAreTakenFromTopAndBigFromBottomOfHeap) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+
+    size_t smallSize = 4096;
+    size_t bigSize = 2 * threshold;
+    auto smallPtr = allocator.allocate(smallSize);
+    auto bigPtr = allocator.allocate(bigSize);
+
+    EXPECT_EQ(heapBase + heapSize - MemoryConstants::pageSize, smallPtr);
+    EXPECT_EQ(heapBase, bigPtr);
+    EXPECT_EQ(2 * threshold, bigSize);
+    EXPECT_EQ(heapSize - 2 * threshold - MemoryConstants::pageSize, allocator.getLeftSize());
+    EXPECT_EQ(1u, allocator.freeBlocksCount);
+}
+
+TEST(SegregatedHeapAllocatorTest, givenUnalignedSizeWhenAllocatedThenSizeIsAlignedToPage) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+
+    size_t size = 10;
+    auto ptr = allocator.allocate(size);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_EQ(MemoryConstants::pageSize, size);
+}
+
+TEST(SegregatedHeapAllocatorTest, givenZeroSizeOrTooBigSizeWhenAllocatedThenZeroIsReturned) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+
+    size_t size = 0;
+    EXPECT_EQ(0llu, allocator.allocate(size));
+    size = heapSize + MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, allocator.allocate(size));
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenWholeHeapSizeWhenAllocatedThenWholeHeapIsReturned) {
+    const size_t oddHeapSize = 1023 * MemoryConstants::pageSize;
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, oddHeapSize, threshold);
+
+    size_t size = oddHeapSize;
+    EXPECT_EQ(heapBase, allocator.allocate(size));
+    EXPECT_EQ(0u, allocator.getLeftSize());
+    EXPECT_EQ(0u, allocator.freeBlocksCount);
+
+    size = MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, allocator.allocate(size));
+}
+
+TEST(SegregatedHeapAllocatorTest, givenAllocationsFreedInAnyOrderWhenFreedThenNeighbouringFreeBlocksAreCoalescedImmediately) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+
+    uint64_t ptrs[4];
+    for (auto &ptr : ptrs) {
+        size_t size = MemoryConstants::pageSize;
+        ptr = allocator.allocate(size);
+    }
+    // small allocations are taken from top of heap, the last one borders remaining free space
+    allocator.free(ptrs[0], MemoryConstants::pageSize);
+    allocator.free(ptrs[2], MemoryConstants::pageSize);
+    EXPECT_EQ(3u, allocator.freeBlocksCount);
+    EXPECT_EQ(3u, allocator.getFragmentationStats().freeBlocksCount);
+
+    allocator.free(ptrs[1], MemoryConstants::pageSize);
+    EXPECT_EQ(2u, allocator.freeBlocksCount);
+
+    allocator.free(ptrs[3], MemoryConstants::pageSize);
+    EXPECT_EQ(1u, allocator.freeBlocksCount);
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+
+    auto stats = allocator.getFragmentationStats();
+    EXPECT_EQ(heapSize, stats.largestFreeBlockSize);
+    EXPECT_EQ(0.0, stats.getFragmentation());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenFreedBlockWhenSmallerAllocationFollowsThenFreedBlockIsReused) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+
+    size_t bigSize = 4 * threshold;
+    auto bigPtr = allocator.allocate(bigSize);
+    size_t separatorSize = 2 * threshold;
+    allocator.allocate(separatorSize);
+    allocator.free(bigPtr, bigSize);
+
+    size_t size = 2 * threshold;
+    EXPECT_EQ(bigPtr, allocator.allocate(size));
+}
+
+TEST(SegregatedHeapAllocatorTest, givenScatteredFreeBlocksWhenStatsAreQueriedThenFragmentationIsReported) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, 8 * MemoryConstants::pageSize, threshold);
+
+    uint64_t ptrs[8];
+    for (auto &ptr : ptrs) {
+        size_t size = MemoryConstants::pageSize;
+        ptr = allocator.allocate(size);
+    }
+    for (uint32_t i = 0; i < 8; i += 2) {
+        allocator.free(ptrs[i], MemoryConstants::pageSize);
+    }
+
+    auto stats = allocator.getFragmentationStats();
+    EXPECT_EQ(4 * MemoryConstants::pageSize, stats.freeSize);
+    EXPECT_EQ(MemoryConstants::pageSize, stats.largestFreeBlockSize);
+    EXPECT_EQ(4u, stats.freeBlocksCount);
+    EXPECT_DOUBLE_EQ(0.75, stats.getFragmentation());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenFreeOfNullptrWhenCalledThenNothingChanges) {
+    SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+    allocator.free(0llu, MemoryConstants::pageSize);
+    EXPECT_EQ(heapSize, allocator.getLeftSize());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenRandomAllocationsAndFreesWhenExecutedThenAllocationsDoNotOverlapAndWholeHeapIsReclaimed) {
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        SegregatedHeapAllocatorUnderTest allocator(heapBase, heapSize, threshold);
+        runRandomAllocations(allocator, heapBase, heapSize, seed, 20000);
+        EXPECT_EQ(1u, allocator.freeBlocksCount);
+    }
+}
+
+TEST(SegregatedHeapAllocatorTest, givenSameRandomAllocationsWhenExecutedOnBothAllocatorsThenBothKeepConsistentState) {
+    for (uint32_t seed = 0; seed < 4; seed++) {
+        HeapAllocator heapAllocator(heapBase, heapSize, threshold);
+        runRandomAllocations(heapAllocator, heapBase, heapSize, seed, 20000);
+
+        SegregatedHeapAllocator segregatedHeapAllocator(heapBase, heapSize, threshold);
+        runRandomAllocations(segregatedHeapAllocator, heapBase, heapSize, seed, 20000);
+    }
+}
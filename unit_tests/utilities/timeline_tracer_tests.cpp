@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/timeline_tracer.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_ostime.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+size_t countOccurrences(const std::string &text, const std::string &pattern) {
+    size_t count = 0;
+    for (auto position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(TimelineTracerTest, givenSpanWhenFlushedThenCompleteEventWithMicrosecondTimesIsWritten) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    tracer.recordSpan("api", "clEnqueueNDRangeKernel", 1234567, 1236567, "taskCount", 5);
+    tracer.flush();
+
+    auto trace = output.str();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clEnqueueNDRangeKernel\",\"cat\":\"api\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":1234.567,\"dur\":2.000,\"args\":{\"taskCount\":5}}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Host thread 1\"}}"));
+    EXPECT_EQ(1u, tracer.peekRecordsWritten());
+}
+
+TEST(TimelineTracerTest, givenGpuSpanAndCounterWhenFlushedThenTheyAreWrittenToGpuTrack) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    tracer.recordGpuSpan("CL_COMMAND_NDRANGE_KERNEL", 5000, 9000, 3);
+    tracer.recordCounter("csr", "Residency size", 9500, 4096);
+    tracer.flush();
+
+    auto trace = output.str();
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":5.000,\"dur\":4.000,\"args\":{\"taskCount\":3}}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"Residency size\",\"cat\":\"csr\",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":9.500,\"args\":{\"value\":4096}}"));
+    EXPECT_EQ(1u, countOccurrences(trace, "\"args\":{\"name\":\"GPU\"}"));
+}
+
+TEST(TimelineTracerTest, givenSpanEndingBeforeStartWhenRecordedThenDurationIsZero) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    tracer.recordSpan("api", "clFinish", 2000, 1000);
+    tracer.flush();
+
+    EXPECT_NE(std::string::npos, output.str().find("\"ts\":2.000,\"dur\":0.000}"));
+}
+
+TEST(TimelineTracerTest, givenNameWithQuotesWhenFlushedThenNameIsEscaped) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    tracer.recordSpan("api", "kernel\"name\\", 0, 1);
+    tracer.flush();
+
+    EXPECT_NE(std::string::npos, output.str().find("\"name\":\"kernel\\\"name\\\\\""));
+}
+
+TEST(TimelineTracerTest, givenMoreRecordsThanChunkCapacityWhenFlushedThenAllRecordsAreWrittenInOrder) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    const uint64_t recordsCount = 3 * TimelineTracer::recordsPerChunk + 7;
+    for (uint64_t i = 0; i < recordsCount; i++) {
+        tracer.recordSpan("csr", "CSR flush", i * 1000, i * 1000 + 1, "taskCount", i);
+    }
+    tracer.flush();
+
+    EXPECT_EQ(recordsCount, tracer.peekRecordsWritten());
+    auto trace = output.str();
+    EXPECT_EQ(recordsCount, countOccurrences(trace, "\"ph\":\"X\""));
+    EXPECT_LT(trace.find("\"args\":{\"taskCount\":1023}"), trace.find("\"args\":{\"taskCount\":1024}"));
+    EXPECT_LT(trace.find("\"args\":{\"taskCount\":2048}"), trace.find("\"args\":{\"taskCount\":3078}"));
+}
+
+TEST(TimelineTracerTest, givenRecordsFromMultipleThreadsWhenFlushedThenEachThreadHasOwnTrack) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+
+    const uint32_t threadsCount = 4;
+    const uint64_t recordsPerThread = 2 * TimelineTracer::recordsPerChunk;
+    std::atomic<uint32_t> threadsDone{0};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&tracer, &threadsDone, recordsPerThread, threadsCount]() {
+            for (uint64_t j = 0; j < recordsPerThread; j++) {
+                tracer.recordSpan("api", "clFlush", j, j + 1);
+            }
+            // keep all threads alive until each one has recorded, so thread ids are not reused
+            threadsDone++;
+            while (threadsDone.load() != threadsCount) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    tracer.flush();
+
+    EXPECT_EQ(threadsCount, tracer.peekThreadBuffersCount());
+    EXPECT_EQ(threadsCount * recordsPerThread, tracer.peekRecordsWritten());
+    auto trace = output.str();
+    for (uint32_t trackId = 1; trackId <= threadsCount; trackId++) {
+        EXPECT_EQ(1u, countOccurrences(trace, "\"args\":{\"name\":\"Host thread " + std::to_string(trackId) + "\"}"));
+    }
+}
+
+TEST(TimelineTracerTest, givenPendingRecordsWhenTracerIsDestroyedThenRecordsAreWrittenAndTraceIsClosed) {
+    std::stringstream output;
+    {
+        TimelineTracer tracer(output);
+        tracer.recordSpan("api", "clReleaseEvent", 0, 1);
+    }
+    auto trace = output.str();
+    EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"clReleaseEvent\""));
+    EXPECT_EQ(trace.size() - std::string("\n],\"displayTimeUnit\":\"ns\"}\n").size(), trace.rfind("\n],\"displayTimeUnit\":\"ns\"}\n"));
+}
+
+TEST(TimelineTracerTest, givenTimeSourceWhenGettingTimestampThenCpuTimeOfTimeSourceIsReturned) {
+    std::stringstream output;
+    TimelineTracer tracer(output);
+    MockOSTime osTime;
+
+    TimelineTracer::setTimeSource(&osTime);
+    auto first = tracer.getTimestamp();
+    EXPECT_EQ(first + 1, tracer.getTimestamp());
+
+    TimelineTracer::clearTimeSource(&osTime);
+    EXPECT_NE(first + 2, tracer.getTimestamp());
+}
+
+TEST(TimelineTracerTest, givenTimelineTraceDisabledWhenGettingGlobalTracerThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableTimelineTrace.set(false);
+    EXPECT_EQ(nullptr, TimelineTracer::get());
+}
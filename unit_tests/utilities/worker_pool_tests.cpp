@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/worker_pool.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(WorkerPoolTest, givenWorkersCountWhenPoolIsCreatedThenThatManyWorkersAreStarted) {
+    WorkerPool pool(3);
+    EXPECT_EQ(3u, pool.getWorkersCount());
+    EXPECT_LE(1u, WorkerPool::getDefaultWorkersCount());
+}
+
+TEST(WorkerPoolTest, givenEnqueuedTaskWhenItCompletesThenItRanOnWorkerThread) {
+    WorkerPool pool(1);
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool done = false;
+    std::thread::id workerThreadId;
+
+    pool.enqueue([&]() {
+        std::lock_guard<std::mutex> lock(mtx);
+        workerThreadId = std::this_thread::get_id();
+        done = true;
+        condition.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock(mtx);
+    condition.wait(lock, [&done] { return done; });
+    EXPECT_NE(std::this_thread::get_id(), workerThreadId);
+}
+
+TEST(WorkerPoolTest, givenQueuedTasksWhenPoolIsDestroyedThenAllTasksAreExecuted) {
+    std::atomic<uint32_t> tasksDone{0};
+    {
+        WorkerPool pool(2);
+        for (int i = 0; i < 100; i++) {
+            pool.enqueue([&tasksDone]() { tasksDone++; });
+        }
+    }
+    EXPECT_EQ(100u, tasksDone.load());
+}
+
+TEST(WorkerPoolTest, givenRangeWhenParallelForIsCalledThenBodyIsCalledOnceForEachIndex) {
+    WorkerPool pool(4);
+    std::vector<std::atomic<uint32_t>> calls(1000);
+    for (auto &call : calls) {
+        call = 0;
+    }
+
+    pool.parallelFor(calls.size(), [&calls](size_t index) { calls[index]++; });
+
+    for (auto &call : calls) {
+        EXPECT_EQ(1u, call.load());
+    }
+}
+
+TEST(WorkerPoolTest, givenEmptyRangeWhenParallelForIsCalledThenBodyIsNotCalled) {
+    WorkerPool pool(1);
+    bool called = false;
+    pool.parallelFor(0, [&called](size_t index) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(WorkerPoolTest, givenTaskRunningOnPoolWhenItCallsParallelForThenItCompletesWithoutFreeWorkers) {
+    WorkerPool pool(1);
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool done = false;
+    std::atomic<uint32_t> calls{0};
+
+    pool.enqueue([&]() {
+        pool.parallelFor(64, [&calls](size_t index) { calls++; });
+        std::lock_guard<std::mutex> lock(mtx);
+        done = true;
+        condition.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock(mtx);
+    condition.wait(lock, [&done] { return done; });
+    EXPECT_EQ(64u, calls.load());
+}